@@ -2,32 +2,39 @@
 
 void advect_all_scalars() {
 
-  real2d dummy("dummy",nz,ncrms);
-  real1d esmt_offset("esmt_offset", ncrms);
-  YAKL_SCOPE( u_esmt  , :: u_esmt);
-  YAKL_SCOPE( v_esmt  , :: v_esmt);
-  YAKL_SCOPE( use_ESMT, :: use_ESMT );
-  real1d esmt_min("esmt_min",ncrms);
+  ScratchFrame scratch("advect_all_scalars");
+  real1d esmt_offset = scratch.get("esmt_offset", ncrms);
+  YAKL_SCOPE( t          , :: t);
+  YAKL_SCOPE( micro_field, :: micro_field);
+  YAKL_SCOPE( sgs_field  , :: sgs_field);
+  YAKL_SCOPE( mkadv      , :: mkadv);
+  YAKL_SCOPE( mkwle      , :: mkwle);
+  YAKL_SCOPE( u_esmt     , :: u_esmt);
+  YAKL_SCOPE( v_esmt     , :: v_esmt);
+  YAKL_SCOPE( use_ESMT   , :: use_ESMT );
+  YAKL_SCOPE( docolumn   , :: docolumn );
+  YAKL_SCOPE( ncrms      , :: ncrms );
+  real1d esmt_min = scratch.get("esmt_min",ncrms);
   yakl::memset(esmt_min,1.0e20);
 
-  // advection of scalars :
-  advect_scalar(t,dummy,dummy);
-
-  // Advection of microphysics prognostics:
+  // All the scalars are advected together, in one batch ordered as
+  // t, advected microphysics prognostics, sgs prognostics, scalar momentum tracers
+  intHost1d micro_adv_host("micro_adv_host",nmicro_fields);
+  int nmicro_adv = 0;
   for (int k=0; k<nmicro_fields; k++) {
     if ( k==index_water_vapor || (docloud && flag_precip(k)!=1) || (doprecip && flag_precip(k)==1) ) {
-      advect_scalar(micro_field,k,mkadv,k,mkwle,k);  
+      micro_adv_host(nmicro_adv++) = k;
     }
   }
+  int1d micro_adv("micro_adv",nmicro_fields);
+  micro_adv_host.deep_copy_to(micro_adv);
 
-  // Advection of sgs prognostics:
-  if (dosgs && advect_sgs) {
-    for (int k=0; k<nsgs_fields; k++) {
-      advect_scalar(sgs_field,k,dummy,dummy);
-    }
-  }
-
-  micro_precip_fall();
+  int nsgs_adv  = (dosgs && advect_sgs) ? nsgs_fields : 0;
+  int nesmt_adv = use_ESMT ? 2 : 0;
+  int is_micro  = 1;
+  int is_sgs    = is_micro + nmicro_adv;
+  int is_esmt   = is_sgs + nsgs_adv;
+  int nscal     = is_esmt + nesmt_adv;
 
   if (use_ESMT) {
     // the esmt_offset simply ensures that the scalar momentum
@@ -41,15 +48,66 @@ void advect_all_scalars() {
       u_esmt(k,j,i,icrm) = u_esmt(k,j,i,icrm) + esmt_offset(icrm);
       v_esmt(k,j,i,icrm) = v_esmt(k,j,i,icrm) + esmt_offset(icrm);
     });
+  }
 
-    // advection of scalar momentum tracers
-    advect_scalar(u_esmt,dummy,dummy);
-    advect_scalar(v_esmt,dummy,dummy);
+  real5d fb   = scratch.get("fb"  ,nscal,nzm,dimy_s,dimx_s,ncrms);
+  real3d fadv = scratch.get("fadv",nscal,nz,ncrms);
+  real3d flux = scratch.get("flux",nscal,nz,ncrms);
 
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms), YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      u_esmt(k,j,i,icrm) = u_esmt(k,j,i,icrm) - esmt_offset(icrm);
-      v_esmt(k,j,i,icrm) = v_esmt(k,j,i,icrm) - esmt_offset(icrm);
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<dimy_s; j++) {
+  //     for (int i=0; i<dimx_s; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    fb(0,k,j,i,icrm) = t(k,j,i,icrm);
+    for (int l=0; l<nmicro_adv; l++) {
+      fb(is_micro+l,k,j,i,icrm) = micro_field(micro_adv(l),k,j,i,icrm);
+    }
+    for (int l=0; l<nsgs_adv; l++) {
+      fb(is_sgs+l,k,j,i,icrm) = sgs_field(l,k,j,i,icrm);
+    }
+    if (nesmt_adv > 0) {
+      fb(is_esmt  ,k,j,i,icrm) = u_esmt(k,j,i,icrm);
+      fb(is_esmt+1,k,j,i,icrm) = v_esmt(k,j,i,icrm);
+    }
+  });
+
+  advect_scalars(fb,nscal,fadv,flux);
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<dimy_s; j++) {
+  //     for (int i=0; i<dimx_s; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    t(k,j,i,icrm) = fb(0,k,j,i,icrm);
+    for (int l=0; l<nmicro_adv; l++) {
+      micro_field(micro_adv(l),k,j,i,icrm) = fb(is_micro+l,k,j,i,icrm);
+    }
+    for (int l=0; l<nsgs_adv; l++) {
+      sgs_field(l,k,j,i,icrm) = fb(is_sgs+l,k,j,i,icrm);
+    }
+    if (nesmt_adv > 0) {
+      u_esmt(k,j,i,icrm) = fb(is_esmt  ,k,j,i,icrm) - esmt_offset(icrm);
+      v_esmt(k,j,i,icrm) = fb(is_esmt+1,k,j,i,icrm) - esmt_offset(icrm);
+    }
+  });
+
+  // Advective tendencies and fluxes of the microphysics prognostics
+  if (nmicro_adv > 0) {
+    // for (int l=0; l<nmicro_adv; l++) {
+    //   for (int k=0; k<nz; k++) {
+    //     for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(nmicro_adv,nz,ncrms) , YAKL_LAMBDA (int l, int k, int icrm) {
+      int m = micro_adv(l);
+      if (docolumn || k < nzm) {
+        mkwle(m,k,icrm) = flux(is_micro+l,k,icrm);
+      }
+      if (!docolumn && k < nzm) {
+        mkadv(m,k,icrm) = fadv(is_micro+l,k,icrm);
+      }
     });
   }
 
+  micro_precip_fall();
+
 }
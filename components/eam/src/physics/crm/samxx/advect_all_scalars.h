@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "scratch.h"
 #include "microphysics.h"
 #include "advect_scalar.h"
 
@@ -6,9 +6,6 @@
 #include "advect_scalar2D.h"
 #include "advect_scalar3D.h"
 
-void advect_scalar(real4d &f, real2d &fadv, real2d &flux);
-
-void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux);
-
-void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux);
-
+// Advect the nscal scalars packed in f, indexed as f(is,k,offy_s+j,offx_s+i,icrm), in a single pass.
+// fadv(is,k,icrm) and flux(is,k,icrm) are the horizontally summed change and vertical flux of each scalar.
+void advect_scalars(real5d &f, int nscal, real3d &fadv, real3d &flux);
@@ -3,12 +3,10 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "scratch.h"
 
-void advect_scalar3D(real4d &f, real2d &flux);
-
-void advect_scalar3D(real5d &f, int ind_f, real2d &flux);
-
-void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux);
+// Advect the nscal scalars f(is,...) in a single pass
+void advect_scalars3D(real5d &f, int nscal, real3d &flux);
 
 YAKL_INLINE real andiff(real x1, real x2, real a, real b) {
   return (abs(a)-a*a*b)*0.5*(x2-x1);
@@ -195,7 +195,7 @@ void VT_forcing() {
   YAKL_SCOPE( t_vt         , :: t_vt);
   YAKL_SCOPE( q_vt         , :: q_vt);
   YAKL_SCOPE( ncrms        , :: ncrms);
-  YAKL_SCOPE( dtn          , :: dtn);
+  YAKL_SCOPE( dtn_crm      , :: dtn_crm);
   YAKL_SCOPE( u            , :: u);
   YAKL_SCOPE( u_vt_pert    , :: u_vt_pert);
   YAKL_SCOPE( u_vt         , :: u_vt);
@@ -230,9 +230,9 @@ void VT_forcing() {
     real tmp_q_scale = -1.0;
     real tmp_u_scale = -1.0;
     // set scaling factors as long as there are perturbations to scale
-    if (t_vt(k,icrm)>0.0) { tmp_t_scale = 1.0 + dtn * t_vt_tend(k,icrm) / t_vt(k,icrm); }
-    if (q_vt(k,icrm)>0.0) { tmp_q_scale = 1.0 + dtn * q_vt_tend(k,icrm) / q_vt(k,icrm); }
-    if (u_vt(k,icrm)>0.0) { tmp_u_scale = 1.0 + dtn * u_vt_tend(k,icrm) / u_vt(k,icrm); }
+    if (t_vt(k,icrm)>0.0) { tmp_t_scale = 1.0 + dtn_crm(icrm) * t_vt_tend(k,icrm) / t_vt(k,icrm); }
+    if (q_vt(k,icrm)>0.0) { tmp_q_scale = 1.0 + dtn_crm(icrm) * q_vt_tend(k,icrm) / q_vt(k,icrm); }
+    if (u_vt(k,icrm)>0.0) { tmp_u_scale = 1.0 + dtn_crm(icrm) * u_vt_tend(k,icrm) / u_vt(k,icrm); }
     if (tmp_t_scale>0.0) { t_pert_scale(k,icrm) = sqrt( tmp_t_scale ); }
     if (tmp_q_scale>0.0) { q_pert_scale(k,icrm) = sqrt( tmp_q_scale ); }
     if (tmp_u_scale>0.0) { u_pert_scale(k,icrm) = sqrt( tmp_u_scale ); }
@@ -254,12 +254,12 @@ void VT_forcing() {
   //     do i = 1,nx
   //       do icrm = 1,ncrms
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    real ttend_loc = ( t_pert_scale(k,icrm) * t_vt_pert(k,j,i,icrm) - t_vt_pert(k,j,i,icrm) ) / dtn;
-    real qtend_loc = ( q_pert_scale(k,icrm) * q_vt_pert(k,j,i,icrm) - q_vt_pert(k,j,i,icrm) ) / dtn;
-    t(k,j+offy_s,i+offx_s,icrm)                  = t(k,j+offy_s,i+offx_s,icrm)                  + ttend_loc * dtn;
-    micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) + qtend_loc * dtn;
-    real utend_loc = ( u_pert_scale(k,icrm) * u_vt_pert(k,j,i,icrm) - u_vt_pert(k,j,i,icrm) ) / dtn;
-    u(k,j+offy_u,i+offx_u,icrm) = u(k,j+offy_u,i+offx_u,icrm) + utend_loc * dtn;
+    real ttend_loc = ( t_pert_scale(k,icrm) * t_vt_pert(k,j,i,icrm) - t_vt_pert(k,j,i,icrm) ) / dtn_crm(icrm);
+    real qtend_loc = ( q_pert_scale(k,icrm) * q_vt_pert(k,j,i,icrm) - q_vt_pert(k,j,i,icrm) ) / dtn_crm(icrm);
+    t(k,j+offy_s,i+offx_s,icrm)                  = t(k,j+offy_s,i+offx_s,icrm)                  + ttend_loc * dtn_crm(icrm);
+    micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) + qtend_loc * dtn_crm(icrm);
+    real utend_loc = ( u_pert_scale(k,icrm) * u_vt_pert(k,j,i,icrm) - u_vt_pert(k,j,i,icrm) ) / dtn_crm(icrm);
+    u(k,j+offy_u,i+offx_u,icrm) = u(k,j+offy_u,i+offx_u,icrm) + utend_loc * dtn_crm(icrm);
   });
 
   //----------------------------------------------------------------------------
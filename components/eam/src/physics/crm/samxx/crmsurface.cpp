@@ -3,7 +3,7 @@
 void crmsurface(real1d &bflx) {
   YAKL_SCOPE( uhl      , ::uhl);
   YAKL_SCOPE( vhl      , ::vhl);
-  YAKL_SCOPE( dtn      , ::dtn);
+  YAKL_SCOPE( dtn_crm  , ::dtn_crm);
   YAKL_SCOPE( utend    , ::utend);
   YAKL_SCOPE( vtend    , ::vtend);
   YAKL_SCOPE( taux0    , ::taux0);
@@ -21,8 +21,8 @@ void crmsurface(real1d &bflx) {
 
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
-    uhl(icrm) = uhl(icrm) + dtn*utend(0,icrm);
-    vhl(icrm) = vhl(icrm) + dtn*vtend(0,icrm);
+    uhl(icrm) = uhl(icrm) + dtn_crm(icrm)*utend(0,icrm);
+    vhl(icrm) = vhl(icrm) + dtn_crm(icrm)*vtend(0,icrm);
     taux0(icrm) = 0.0;
     tauy0(icrm) = 0.0;
   });
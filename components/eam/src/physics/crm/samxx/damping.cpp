@@ -11,7 +11,7 @@ void damping() {
   YAKL_SCOPE( dvdt           , ::dvdt );
   YAKL_SCOPE( dwdt           , ::dwdt );
   YAKL_SCOPE( w              , ::w );
-  YAKL_SCOPE( dtn            , ::dtn );
+  YAKL_SCOPE( dtn_crm        , ::dtn_crm );
   YAKL_SCOPE( micro_field    , ::micro_field );
   YAKL_SCOPE( qv             , ::qv );
   YAKL_SCOPE( qv0            , ::qv0 );
@@ -98,8 +98,8 @@ void damping() {
       dudt       (na-1,k,       j,       i,icrm) -=     (u (k,offy_u+j,offx_u+i,icrm)-u0loc(k,icrm)) * tau(k,icrm);
       dvdt       (na-1,k,       j,       i,icrm) -=     (v (k,offy_v+j,offx_v+i,icrm)-v0loc(k,icrm)) * tau(k,icrm);
       dwdt       (na-1,k,       j,       i,icrm) -=      w (k,offy_w+j,offx_w+i,icrm)                * tau(k,icrm);
-      t          (     k,offy_s+j,offx_s+i,icrm) -= dtn*(t (k,offy_s+j,offx_s+i,icrm)-t0loc(k,icrm)) * tau(k,icrm);
-      micro_field(idwv,k,offy_s+j,offx_s+i,icrm) -= dtn*(qv(k,       j,       i,icrm)-qv0  (k,icrm)) * tau(k,icrm);
+      t          (     k,offy_s+j,offx_s+i,icrm) -= dtn_crm(icrm)*(t (k,offy_s+j,offx_s+i,icrm)-t0loc(k,icrm)) * tau(k,icrm);
+      micro_field(idwv,k,offy_s+j,offx_s+i,icrm) -= dtn_crm(icrm)*(qv(k,       j,       i,icrm)-qv0  (k,icrm)) * tau(k,icrm);
     }
   });
 
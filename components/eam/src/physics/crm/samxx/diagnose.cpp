@@ -14,7 +14,7 @@ void diagnose() {
   YAKL_SCOPE( rho            , ::rho);
   YAKL_SCOPE( dz             , ::dz);
   YAKL_SCOPE( adz            , ::adz);
-  YAKL_SCOPE( dtfactor       , ::dtfactor);
+  YAKL_SCOPE( dtfactor_crm   , ::dtfactor_crm);
   YAKL_SCOPE( tabs           , ::tabs);
   YAKL_SCOPE( t              , ::t);
   YAKL_SCOPE( gamaz          , ::gamaz); 
@@ -62,7 +62,7 @@ void diagnose() {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    real coef1 = rho(k,icrm)*dz(icrm)*adz(k,icrm)*dtfactor;
+    real coef1 = rho(k,icrm)*dz(icrm)*adz(k,icrm)*dtfactor_crm(icrm);
     tabs(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm)-gamaz(k,icrm)+ fac_cond *
                        (qcl(k,j,i,icrm)+qpl(k,j,i,icrm)) + fac_sub *(qci(k,j,i,icrm) + qpi(k,j,i,icrm));
     yakl::atomicAdd(u0(k,icrm),u(k,j+offy_u,i+offx_u,icrm));
@@ -97,8 +97,8 @@ void diagnose() {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    usfc_xy(j,i,icrm) = usfc_xy(j,i,icrm) + u(0,j+offy_s,i+offx_s,icrm)*dtfactor;
-    vsfc_xy(j,i,icrm) = vsfc_xy(j,i,icrm) + v(0,j+offy_s,i+offx_s,icrm)*dtfactor;
+    usfc_xy(j,i,icrm) = usfc_xy(j,i,icrm) + u(0,j+offy_s,i+offx_s,icrm)*dtfactor_crm(icrm);
+    vsfc_xy(j,i,icrm) = vsfc_xy(j,i,icrm) + v(0,j+offy_s,i+offx_s,icrm)*dtfactor_crm(icrm);
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -116,7 +116,7 @@ void diagnose() {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    real coef1 = rho(k,icrm)*dz(icrm)*adz(k,icrm)*dtfactor;
+    real coef1 = rho(k,icrm)*dz(icrm)*adz(k,icrm)*dtfactor_crm(icrm);
     // Saturated water vapor path with respect to water. Can be used
     // with water vapor path (= pw) to compute column-average
     // relative humidity.
@@ -132,7 +132,7 @@ void diagnose() {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    psfc_xy(j,i,icrm) = psfc_xy(j,i,icrm) + (100.0*pres(0,icrm) + p(0,j+offy_p,i+offx_p,icrm))*dtfactor;
+    psfc_xy(j,i,icrm) = psfc_xy(j,i,icrm) + (100.0*pres(0,icrm) + p(0,j+offy_p,i+offx_p,icrm))*dtfactor_crm(icrm);
   });
 
   // COMPUTE CLOUD/ECHO HEIGHTS AS WELL AS CLOUD TOP TEMPERATURE
@@ -162,7 +162,7 @@ void diagnose() {
       if (tmp_lwp > 0.01) {
         cloudtopheight(j,i,icrm) = z(k,icrm);
         cloudtoptemp(j,i,icrm) = tabs(k,j,i,icrm);
-        cld_xy(j,i,icrm) = cld_xy(j,i,icrm) + dtfactor;
+        cld_xy(j,i,icrm) = cld_xy(j,i,icrm) + dtfactor_crm(icrm);
         break;
       }
     }
@@ -5,7 +5,7 @@ void forcing() {
   YAKL_SCOPE( ncrms         , ::ncrms );
   YAKL_SCOPE( t             , ::t );
   YAKL_SCOPE( ttend         , ::ttend );
-  YAKL_SCOPE( dtn           , ::dtn );
+  YAKL_SCOPE( dtn_crm       , ::dtn_crm );
   YAKL_SCOPE( micro_field   , ::micro_field );
   YAKL_SCOPE( qtend         , ::qtend );
   YAKL_SCOPE( dudt          , ::dudt );
@@ -30,9 +30,9 @@ void forcing() {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    t(k, j+offy_s, i+offx_s, icrm) = t(k, j+offy_s, i+offx_s, icrm) + ttend(k,icrm) * dtn;
+    t(k, j+offy_s, i+offx_s, icrm) = t(k, j+offy_s, i+offx_s, icrm) + ttend(k,icrm) * dtn_crm(icrm);
     micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) = 
-          micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) + qtend(k,icrm) * dtn;
+          micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) + qtend(k,icrm) * dtn_crm(icrm);
 
     if (micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) < 0.0) {
       yakl::atomicAdd(nneg(k,icrm),1);
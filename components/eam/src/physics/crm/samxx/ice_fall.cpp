@@ -7,7 +7,7 @@ void ice_fall() {
   YAKL_SCOPE( tabs          , :: tabs );
   YAKL_SCOPE( qifall        , :: qifall );
   YAKL_SCOPE( tlatqi        , :: tlatqi );
-  YAKL_SCOPE( dtn           , :: dtn );
+  YAKL_SCOPE( dtn_crm       , :: dtn_crm );
   YAKL_SCOPE( adz           , :: adz );
   YAKL_SCOPE( dz            , :: dz );
   YAKL_SCOPE( rho           , :: rho );
@@ -68,7 +68,7 @@ void ice_fall() {
       int kb = max(k-1,0    );
 
       // CFL number based on grid spacing interpolated to interface i,j,k-1/2
-      real coef = dtn/(0.5*(adz(kb,icrm)+adz(k,icrm))*dz(icrm));
+      real coef = dtn_crm(icrm)/(0.5*(adz(kb,icrm)+adz(k,icrm))*dz(icrm));
 
       // Compute cloud ice density in this cell and the ones above/below.
       // Since cloud ice is falling, the above cell is u(icrm,upwind),
@@ -115,7 +115,7 @@ void ice_fall() {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nz,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     if ( k >= max(0,kmin(icrm)-2) && k <= kmax(icrm) ) {
-      real coef = dtn/(dz(icrm)*adz(k,icrm)*rho(k,icrm));
+      real coef = dtn_crm(icrm)/(dz(icrm)*adz(k,icrm)*rho(k,icrm));
       // The cloud ice increment is the difference of the fluxes.
       real dqi  = coef*(fz(k,j,i,icrm)-fz(k+1,j,i,icrm));
       // Add this increment to both non-precipitating and total water.
@@ -139,7 +139,7 @@ void ice_fall() {
   //    for (int i=0; i<nx; i++) {
   //      for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    real coef = dtn/dz(icrm);
+    real coef = dtn_crm(icrm)/dz(icrm);
     real dqi = -coef*fz(0,j,i,icrm);
     precsfc (j,i,icrm) = precsfc (j,i,icrm)+dqi;
     precssfc(j,i,icrm) = precssfc(j,i,icrm)+dqi;
@@ -12,13 +12,16 @@ void kurant () {
   YAKL_SCOPE( dz    , ::dz );
   YAKL_SCOPE( adzw  , ::adzw );
   YAKL_SCOPE( ncrms , ::ncrms );
+  YAKL_SCOPE( ncycle_crm , ::ncycle_crm );
 
   int constexpr max_ncycle = 4;
   real cfl;
 
-  real2d wm    ("wm"   ,nz ,ncrms);
-  real2d uhm   ("uhm"  ,nz ,ncrms);
-  real2d tmpMax("uhMax",nzm,ncrms);
+  ScratchFrame scratch("kurant");
+  real2d wm      = scratch.get("wm"     ,nz ,ncrms);
+  real2d uhm     = scratch.get("uhm"    ,nz ,ncrms);
+  real2d tmpMax  = scratch.get("uhMax"  ,nzm,ncrms);
+  real1d cfl_crm = scratch.get("cfl_crm",ncrms);
 
   ncycle = 1;
   parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -42,7 +45,6 @@ void kurant () {
   });
 
 
-  cfl = 0.0;
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -53,10 +55,21 @@ void kurant () {
     tmpMax(k,icrm) = max(max(tmp1,tmp2),tmp3);
   });
 
-  yakl::ParallelMax<real,yakl::memDevice> pmax( nzm*ncrms );
-  real cfl_loc = pmax(tmpMax.data());
-  cfl = max(cfl,cfl_loc);
+  // Each CRM gets its own cfl, so that only the CRMs that need it are subcycled.
+  // Note: a NaN cfl_loc is preserved, since the comparison is false
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    real cfl_loc = 0.0;
+    for (int k=0; k<nzm; k++) {
+      if (tmpMax(k,icrm) > cfl_loc || tmpMax(k,icrm) != tmpMax(k,icrm)) { cfl_loc = tmpMax(k,icrm); }
+    }
+    cfl_crm(icrm) = cfl_loc;
+  });
+
+  kurant_sgs(cfl_crm);
 
+  yakl::ParallelMax<real,yakl::memDevice> pmax( ncrms );
+  cfl = pmax(cfl_crm.data());
 
   if(cfl != cfl) {
     std::cout << "\nkurant() - cfl is NaN." << std::endl;
@@ -64,10 +77,17 @@ void kurant () {
     exit(-1);
   }
 
-  kurant_sgs(cfl);
-
   ncycle = max(ncycle,max(1,static_cast<int>(ceil(cfl/0.7))));
 
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+#ifdef MMF_FIXED_SUBCYCLE
+    ncycle_crm(icrm) = max_ncycle;
+#else
+    ncycle_crm(icrm) = max(1,static_cast<int>(ceil(cfl_crm(icrm)/0.7)));
+#endif
+  });
+
 #ifdef MMF_FIXED_SUBCYCLE
   ncycle = max_ncycle;
 #endif
@@ -4,6 +4,7 @@
 #include "samxx_const.h"
 #include "vars.h"
 #include "sgs.h"
+#include "scratch.h"
 
 void kurant();
 
@@ -148,7 +148,7 @@ void post_timeloop() {
   YAKL_SCOPE( rhow                    , :: rhow );
   YAKL_SCOPE( rho                     , :: rho );
   YAKL_SCOPE( sgs_field               , :: sgs_field );
-  YAKL_SCOPE( dtn                     , :: dtn );
+  YAKL_SCOPE( dtn_crm                 , :: dtn_crm );
   YAKL_SCOPE( crm_output_subcycle_factor, :: crm_output_subcycle_factor );
   YAKL_SCOPE( ncrms                   , :: ncrms );
   YAKL_SCOPE( crm_output_t_vt_tend    , :: crm_output_t_vt_tend );
@@ -512,7 +512,8 @@ void post_timeloop() {
     }
 
     real tmp1 = dz(icrm)/rhow(k,icrm);
-    real tmp2 = tmp1/dtn; // dtn is calculated inside of the icyc loop. It seems wrong to use it here ???? +++mhwang
+    // dtn_crm is set inside of the icyc loop, to the last time step of this CRM
+    real tmp2 = tmp1/dtn_crm(icrm);
 
     for (int l=0; l<nmicro_fields; l++) {                                           
       mkwsb(l,k,icrm) = mkwsb(l,k,icrm) * tmp1*rhow(k,icrm) * factor_xy/((real) nstop);     //kg/m3/s --> kg/m2/s
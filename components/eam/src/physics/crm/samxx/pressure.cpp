@@ -49,8 +49,13 @@ void pressure() {
 
   #ifndef USE_ORIG_FFT
 
-    pressure_fftx.forward_real(f, 2, nx);
-    if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
+    if (pressure_fft_batched) {
+      // All slabs, rows and CRMs in one kernel per direction (see pressure_fft.h)
+      pressure_fft_forward(f, nzslab, ncrms);
+    } else {
+      pressure_fftx.forward_real(f, 2, nx);
+      if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
+    }
 
   #else
 
@@ -174,8 +179,12 @@ void pressure() {
 
   #ifndef USE_ORIG_FFT
 
-    if (RUN3D) { pressure_ffty.inverse_real(f); }
-    pressure_fftx.inverse_real(f);
+    if (pressure_fft_batched) {
+      pressure_fft_inverse(f, nzslab, ncrms);
+    } else {
+      if (RUN3D) { pressure_ffty.inverse_real(f); }
+      pressure_fftx.inverse_real(f);
+    }
 
   #else
 
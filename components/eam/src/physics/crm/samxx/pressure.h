@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "YAKL_fft.h"
+#include "pressure_fft.h"
 #include "vars.h"
 #include "press_rhs.h"
 #include "press_grad.h"
@@ -0,0 +1,171 @@
+
+#include "pressure_fft.h"
+
+namespace {
+
+// Twiddles of the x and y transforms, computed once by pressure_fft_allocate
+real2d twiddles_x;
+real2d twiddles_y;
+
+// Twiddle factors tw(k,:) = (cos,sin)(-2*pi*k/n), for k=0..n/2-1
+real2d make_twiddles(int n) {
+  int nh = max(n/2,1);
+  real2d tw("tw",nh,2);
+  parallel_for( nh , YAKL_LAMBDA (int k) {
+    real pii = 3.14159265358979323846;
+    real ang = -2.0*pii*k/n;
+    tw(k,0) = cos(ang);
+    tw(k,1) = sin(ang);
+  });
+  return tw;
+}
+
+// In-place radix-2 complex FFT of length M. tw holds the twiddles of length 2*M.
+// sgn=1: forward (exp(-i...)), sgn=-1: inverse (exp(+i...)), both unnormalized.
+template <int M>
+YAKL_INLINE void cfft(SArray<real,1,M> &zr, SArray<real,1,M> &zi, real2d const &tw, real sgn) {
+  // Bit reversal permutation
+  for (int i=1, j=0; i<M; i++) {
+    int bit = M >> 1;
+    for (; j & bit; bit >>= 1) { j ^= bit; }
+    j ^= bit;
+    if (i < j) {
+      real tr = zr(i); zr(i) = zr(j); zr(j) = tr;
+      real ti = zi(i); zi(i) = zi(j); zi(j) = ti;
+    }
+  }
+  // Butterflies. Stage of length len uses the roots exp(-2*pi*i*k/len) = tw(2*k*M/len)
+  for (int len=2; len<=M; len<<=1) {
+    int half = len/2;
+    int step = 2*(M/len);
+    for (int i=0; i<M; i+=len) {
+      for (int k=0; k<half; k++) {
+        real wr = tw(k*step,0);
+        real wi = sgn*tw(k*step,1);
+        int a = i+k;
+        int b = i+k+half;
+        real tr = zr(b)*wr - zi(b)*wi;
+        real ti = zr(b)*wi + zi(b)*wr;
+        zr(b) = zr(a) - tr;
+        zi(b) = zi(a) - ti;
+        zr(a) = zr(a) + tr;
+        zi(a) = zi(a) + ti;
+      }
+    }
+  }
+}
+
+// Forward real FFT of x(0:N-1), normalized by 1/N, computed with a complex FFT
+// of length N/2. On output, (x(2*m),x(2*m+1)) is mode m, for m=0..N/2.
+template <int N>
+YAKL_INLINE void rfft_forward(SArray<real,1,N+2> &x, real2d const &tw) {
+  int constexpr M = N > 1 ? N/2 : 1;
+  SArray<real,1,M> zr, zi;
+  for (int j=0; j<M; j++) {
+    zr(j) = x(2*j);
+    zi(j) = x(2*j+1);
+  }
+  cfft<M>(zr,zi,tw,1.);
+  real rn = 1./N;
+  for (int m=0; m<=M; m++) {
+    int mk = m % M;
+    int mc = (M-m) % M;
+    // Even/odd sub-sequences transforms: E = (Z_m + conj(Z_{M-m}))/2, O = (Z_m - conj(Z_{M-m}))/(2i)
+    real er = 0.5*(zr(mk) + zr(mc));
+    real ei = 0.5*(zi(mk) - zi(mc));
+    real or_ = 0.5*(zi(mk) + zi(mc));
+    real oi = -0.5*(zr(mk) - zr(mc));
+    // X_m = (E + w^m O)/N, with w^M = -1
+    real wr = m < M ? tw(m,0) : -1.;
+    real wi = m < M ? tw(m,1) :  0.;
+    x(2*m  ) = (er + wr*or_ - wi*oi)*rn;
+    x(2*m+1) = (ei + wr*oi + wi*or_)*rn;
+  }
+}
+
+// Inverse of rfft_forward: from modes (x(2*m),x(2*m+1)), m=0..N/2, to x(0:N-1)
+template <int N>
+YAKL_INLINE void rfft_inverse(SArray<real,1,N+2> &x, real2d const &tw) {
+  int constexpr M = N > 1 ? N/2 : 1;
+  SArray<real,1,M> zr, zi;
+  for (int m=0; m<M; m++) {
+    // E = (X_m + conj(X_{M-m}))/2, O = (X_m - conj(X_{M-m}))*w^{-m}/2, Z_m = E + i*O
+    real xr  = x(2*m);
+    real xi  = x(2*m+1);
+    real xcr =  x(2*(M-m));
+    real xci = -x(2*(M-m)+1);
+    real er = 0.5*(xr + xcr);
+    real ei = 0.5*(xi + xci);
+    real dr = 0.5*(xr - xcr);
+    real di = 0.5*(xi - xci);
+    real wr =  tw(m,0);
+    real wi = -tw(m,1);
+    real or_ = dr*wr - di*wi;
+    real oi  = dr*wi + di*wr;
+    zr(m) = er - oi;
+    zi(m) = ei + or_;
+  }
+  cfft<M>(zr,zi,tw,-1.);
+  for (int j=0; j<M; j++) {
+    x(2*j  ) = 2.*zr(j);
+    x(2*j+1) = 2.*zi(j);
+  }
+}
+
+} // namespace
+
+void pressure_fft_allocate() {
+  twiddles_x = make_twiddles(nx);
+  twiddles_y = make_twiddles(ny);
+}
+
+void pressure_fft_finalize() {
+  twiddles_x = real2d();
+  twiddles_y = real2d();
+}
+
+void pressure_fft_forward(real4d &f, int nzslab, int ncrms) {
+  YAKL_SCOPE( twx , twiddles_x );
+  YAKL_SCOPE( twy , twiddles_y );
+  // for (int k=0; k<nzslab; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nzslab,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
+    SArray<real,1,nx+2> x;
+    for (int i=0; i<nx; i++) { x(i) = f(k,j,i,icrm); }
+    rfft_forward<nx>(x,twx);
+    for (int i=0; i<nx+2; i++) { f(k,j,i,icrm) = x(i); }
+  });
+
+  if (RUN3D) {
+    // for (int k=0; k<nzslab; k++) {
+    //   for (int i=0; i<nx+2; i++) {
+    //     for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(nzslab,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+      SArray<real,1,ny+2> y;
+      for (int j=0; j<ny; j++) { y(j) = f(k,j,i,icrm); }
+      rfft_forward<ny>(y,twy);
+      for (int j=0; j<ny+2; j++) { f(k,j,i,icrm) = y(j); }
+    });
+  }
+}
+
+void pressure_fft_inverse(real4d &f, int nzslab, int ncrms) {
+  YAKL_SCOPE( twx , twiddles_x );
+  YAKL_SCOPE( twy , twiddles_y );
+  if (RUN3D) {
+    parallel_for( SimpleBounds<3>(nzslab,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+      SArray<real,1,ny+2> y;
+      for (int j=0; j<ny+2; j++) { y(j) = f(k,j,i,icrm); }
+      rfft_inverse<ny>(y,twy);
+      for (int j=0; j<ny; j++) { f(k,j,i,icrm) = y(j); }
+    });
+  }
+
+  parallel_for( SimpleBounds<3>(nzslab,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
+    SArray<real,1,nx+2> x;
+    for (int i=0; i<nx+2; i++) { x(i) = f(k,j,i,icrm); }
+    rfft_inverse<nx>(x,twx);
+    for (int i=0; i<nx; i++) { f(k,j,i,icrm) = x(i); }
+  });
+}
@@ -0,0 +1,34 @@
+
+#pragma once
+
+#include "samxx_const.h"
+
+// Batched real FFTs for the pressure solver.
+//
+// All the rows (or columns) of all slabs of all CRMs are transformed by a single
+// kernel, with one thread per transform. The transform length is a compile-time
+// constant, so the radix-2 stages are fully known to the compiler for the usual
+// CRM sizes (32, 64, 128). Only power-of-two lengths are supported; see
+// pressure_fft_batched below.
+//
+// The output of the forward transform of a row of length n has the same packing
+// as fft991_crm: entries (2*m,2*m+1) hold the real and imaginary part of mode m,
+// for m=0..n/2, for a total of n+2 entries. The forward transform includes the
+// 1/n normalization, so that inverse(forward(x))==x.
+
+YAKL_INLINE constexpr bool is_pow2(int n) { return n > 0 && (n & (n-1)) == 0; }
+
+// Whether the batched FFTs can be used for the current CRM dimensions
+bool constexpr pressure_fft_batched = is_pow2(nx) && (RUN2D || is_pow2(ny));
+
+// Computes the twiddle factors of the batched FFTs. Called from allocate() (see vars.cpp),
+// so that they are not recomputed at every call of pressure()
+void pressure_fft_allocate();
+
+void pressure_fft_finalize();
+
+// Forward transform of f(0:nzslab-1,0:ny-1,0:nx-1,:) along x, then (if RUN3D) along y
+void pressure_fft_forward(real4d &f, int nzslab, int ncrms);
+
+// Inverse of pressure_fft_forward
+void pressure_fft_inverse(real4d &f, int nzslab, int ncrms);
@@ -247,7 +247,7 @@ void scalar_momentum_tend() {
    * Purpose: Calculate pressure gradient effects on scalar momentum
    * Author: Walter Hannah - Lawrence Livermore National Lab
    *------------------------------------------------------------------*/
-   YAKL_SCOPE( dtn       , :: dtn );
+   YAKL_SCOPE( dtn_crm   , :: dtn_crm );
    YAKL_SCOPE( ncrms     , :: ncrms );
    YAKL_SCOPE( u_esmt    , :: u_esmt );
    YAKL_SCOPE( v_esmt    , :: v_esmt );
@@ -265,8 +265,8 @@ void scalar_momentum_tend() {
    //    for (int i=0; i<nx; i++) {
    //      for (int icrm=0; icrm<ncrms; icrm++) {
    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-     u_esmt(k,j+offy_s,i+offx_s,icrm) = u_esmt(k,j+offy_s,i+offx_s,icrm) + u_esmt_pgf_3D(k,j,i,icrm)*dtn;
-     v_esmt(k,j+offy_s,i+offx_s,icrm) = v_esmt(k,j+offy_s,i+offx_s,icrm) + v_esmt_pgf_3D(k,j,i,icrm)*dtn;
+     u_esmt(k,j+offy_s,i+offx_s,icrm) = u_esmt(k,j+offy_s,i+offx_s,icrm) + u_esmt_pgf_3D(k,j,i,icrm)*dtn_crm(icrm);
+     v_esmt(k,j+offy_s,i+offx_s,icrm) = v_esmt(k,j+offy_s,i+offx_s,icrm) + v_esmt_pgf_3D(k,j,i,icrm)*dtn_crm(icrm);
    });
 
 }
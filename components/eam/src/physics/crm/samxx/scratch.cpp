@@ -0,0 +1,91 @@
+
+#include "scratch.h"
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace {
+
+real1d scratch_buffer;
+size_t scratch_top  = 0;
+size_t scratch_peak = 0;
+#ifdef MMF_SCRATCH_STATS
+std::map<std::string,size_t> scratch_hwm;
+#endif
+
+// Total (padded) size of arrays with the given number of elements
+size_t need(std::initializer_list<size_t> sizes) {
+  size_t n = 0;
+  for (size_t s : sizes) { n += ScratchFrame::padded(s); }
+  return n;
+}
+
+} // namespace
+
+size_t scratch_size(int ncrms) {
+  size_t const n = ncrms;
+  // Largest batch of scalars advected by advect_all_scalars
+  size_t const nscal = 1 + nmicro_fields + nsgs_fields + 2;
+
+  size_t accelerate = 10*need({nzm*n});
+
+  size_t kurant = need({nz*n, nz*n, nzm*n, n});
+
+  size_t mom_z = need({nz*ny*nx*n, nz*ny*nx*n, nzm*ny*nx*n});
+
+  size_t scalars = RUN3D ?
+    need({nscal*nzm*(ny+2)*(nx+2)*n, nscal*nzm*(ny+2)*(nx+2)*n, nscal*nzm*(ny+4)*(nx+5)*n,
+          nscal*nzm*(ny+5)*(nx+4)*n, nscal*nz*(ny+4)*(nx+4)*n, nzm*n, nzm*n, nzm*n}) :
+    need({nscal*nzm*(nx+2)*n, nscal*nzm*(nx+2)*n, nscal*nzm*(nx+5)*n,
+          nscal*nz*(nx+4)*n, nzm*n, nzm*n, nzm*n});
+  // advect_all_scalars holds its own temporaries while advect_scalars runs
+  size_t all_scalars = need({n, n, nscal*nzm*dimy_s*dimx_s*n, nscal*nz*n, nscal*nz*n}) + scalars;
+
+  return max(max(accelerate,kurant),max(mom_z,all_scalars));
+}
+
+void scratch_allocate(int ncrms) {
+  scratch_buffer = real1d("scratch_buffer", scratch_size(ncrms));
+  scratch_top  = 0;
+  scratch_peak = 0;
+}
+
+void scratch_finalize() {
+#ifdef MMF_SCRATCH_STATS
+  scratch_report(std::cout);
+#endif
+  scratch_buffer = real1d();
+}
+
+void scratch_report(std::ostream &os) {
+  os << "samxx scratch arena: " << scratch_peak << " of " << scratch_buffer.get_totElems() << " reals used\n";
+#ifdef MMF_SCRATCH_STATS
+  for (auto const &kv : scratch_hwm) {
+    os << "  " << kv.first << ": " << kv.second << " reals\n";
+  }
+#endif
+}
+
+ScratchFrame::ScratchFrame(char const *routine) : routine(routine), base(scratch_top) {}
+
+ScratchFrame::~ScratchFrame() {
+  scratch_top = base;
+}
+
+real *ScratchFrame::push(char const *label, size_t n) {
+  size_t top = scratch_top + padded(n);
+  if (top > scratch_buffer.get_totElems()) {
+    std::cout << "\nScratchFrame::get() - " << routine << ": not enough scratch for " << label
+              << " (" << n << " reals, " << scratch_buffer.get_totElems() - scratch_top << " available)."
+              << " Update scratch_size()." << std::endl;
+    exit(-1);
+  }
+  real *ptr = scratch_buffer.data() + scratch_top;
+  scratch_top = top;
+  scratch_peak = max(scratch_peak, top);
+#ifdef MMF_SCRATCH_STATS
+  size_t &hwm = scratch_hwm[routine];
+  hwm = max(hwm, top - base);
+#endif
+  return ptr;
+}
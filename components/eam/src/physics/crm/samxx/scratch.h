@@ -0,0 +1,63 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
+
+// Persistent device scratch arena for the per-call temporaries of the CRM routines.
+//
+// The arena is allocated at crm() entry (see allocate() in vars.cpp), sized for the
+// largest need of the routines that use it (see scratch_size), and released in
+// finalize(). Routines take their temporaries from it through a ScratchFrame, which
+// behaves as a stack frame: temporaries are carved from the top of the arena, and
+// are all released when the frame goes out of scope, so frames can be nested (e.g.,
+// advect_all_scalars -> advect_scalars3D). All the kernels run on the same stream,
+// so memory released by a frame can be reused by the next one without a fence.
+//
+// The arrays returned by ScratchFrame::get are unmanaged: they must not outlive
+// their frame, and they are not initialized.
+//
+// The arena records its high-water mark, printed by scratch_report(). When
+// MMF_SCRATCH_STATS is defined, it also records the high-water mark of each routine
+// (the largest amount of scratch held by any of its frames), and prints the report
+// at finalize().
+
+// Number of reals needed by the routines that use the arena, for ncrms CRMs
+size_t scratch_size(int ncrms);
+
+void scratch_allocate(int ncrms);
+
+void scratch_finalize();
+
+void scratch_report(std::ostream &os);
+
+class ScratchFrame {
+public:
+  // Allocations are padded to a multiple of 256 bytes, so that all the temporaries
+  // are aligned for coalesced accesses
+  static size_t constexpr align = 256 / sizeof(real);
+
+  static size_t constexpr padded(size_t n) { return (n + align - 1) / align * align; }
+
+  explicit ScratchFrame(char const *routine);
+  ~ScratchFrame();
+
+  ScratchFrame(ScratchFrame const &) = delete;
+  ScratchFrame &operator=(ScratchFrame const &) = delete;
+
+  // Unmanaged device array of the given dimensions, taken from the top of the arena
+  template <class... Dims>
+  yakl::Array<real,sizeof...(Dims),yakl::memDevice,yakl::styleC> get(char const *label, Dims... dims) {
+    size_t n = 1;
+    for (size_t d : {static_cast<size_t>(dims)...}) { n *= d; }
+    return yakl::Array<real,sizeof...(Dims),yakl::memDevice,yakl::styleC>(label, push(label, n), dims...);
+  }
+
+private:
+  real *push(char const *label, size_t n);
+
+  char const *routine;
+  size_t      base;
+};
@@ -1,7 +1,7 @@
 
 #include "sgs.h"
 
-void kurant_sgs(real &cfl) {
+void kurant_sgs(real1d &cfl) {
   YAKL_SCOPE( sgs_field_diag , :: sgs_field_diag );
   YAKL_SCOPE( dz             , :: dz );
   YAKL_SCOPE( dy             , :: dy );
@@ -39,10 +39,15 @@ void kurant_sgs(real &cfl) {
     tkhmax(k,icrm) = max( max( xdir , ydir ) , zdir );
   });
 
-  // Perform a max reduction over tkhmax
-  yakl::ParallelMax<real,yakl::memDevice> pmax( nzm*ncrms );
-  real cfl_loc = pmax( tkhmax.data() );
-  cfl = max(cfl , cfl_loc);
+  // Perform a max reduction over tkhmax for each CRM
+  // for (int icrm=0; icrm < ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    real cfl_loc = cfl(icrm);
+    for (int k=0; k<nzm; k++) {
+      if (tkhmax(k,icrm) > cfl_loc) { cfl_loc = tkhmax(k,icrm); }
+    }
+    cfl(icrm) = cfl_loc;
+  });
 }
 
 
@@ -0,0 +1,85 @@
+
+#include "subcycle.h"
+
+// Slot holding role r (0:na, 1:nb, 2:nc) after k rotations of the Adams-Bashforth
+// indices, starting from (na0,nb0,nc0). Each rotation maps (na,nb,nc) to (nc,na,nb).
+YAKL_INLINE int rotated_slot(int r, int k, int na0, int nb0, int nc0) {
+  int s = (r - k%3 + 3) % 3;
+  return s == 0 ? na0 : (s == 1 ? nb0 : nc0);
+}
+
+
+// arr has the slot as its first (slowest varying) dimension, and the CRM as its last
+template <class T, int N>
+void align_slots(yakl::Array<T,N,yakl::memDevice,yakl::styleC> &arr, int na0, int nb0, int nc0) {
+  YAKL_SCOPE( ncrms      , ::ncrms );
+  YAKL_SCOPE( ncycle     , ::ncycle );
+  YAKL_SCOPE( ncycle_crm , ::ncycle_crm );
+  int nrest = arr.get_totElems() / (3*ncrms);
+  auto tmp = arr.createDeviceCopy();
+  T *src = tmp.data();
+  T *dst = arr.data();
+
+  parallel_for( SimpleBounds<3>(3,nrest,ncrms) , YAKL_LAMBDA (int r, int m, int icrm) {
+    int k = ncycle_crm(icrm);
+    if (k < ncycle) {
+      int s_src = rotated_slot(r,k     ,na0,nb0,nc0) - 1;
+      int s_dst = rotated_slot(r,ncycle,na0,nb0,nc0) - 1;
+      dst[(s_dst*nrest+m)*ncrms+icrm] = src[(s_src*nrest+m)*ncrms+icrm];
+    }
+  });
+}
+
+
+void order_crms_by_ncycle(std::vector<int> &nactive) {
+  auto ncycle_host = ncycle_crm.createHostCopy();
+
+  nactive.assign(ncycle,0);
+  bool sorted = true;
+  for (int icrm=0; icrm<ncrms; icrm++) {
+    for (int icyc=0; icyc<ncycle_host(icrm); icyc++) { nactive[icyc]++; }
+    if (icrm > 0 && ncycle_host(icrm) > ncycle_host(icrm-1)) { sorted = false; }
+  }
+  if (sorted) { return; }
+
+  // Stable counting sort by non-increasing ncycle_crm
+  intHost1d perm_host("perm_host",ncrms);
+  int pos = 0;
+  for (int icyc=ncycle; icyc>=1; icyc--) {
+    for (int icrm=0; icrm<ncrms; icrm++) {
+      if (ncycle_host(icrm) == icyc) { perm_host(pos++) = icrm; }
+    }
+  }
+  int1d perm("perm",ncrms);
+  perm_host.deep_copy_to(perm);
+  permute_crm_arrays(perm);
+}
+
+
+void align_ab_slots(int na0, int nb0, int nc0) {
+  align_slots(dudt,na0,nb0,nc0);
+  align_slots(dvdt,na0,nb0,nc0);
+  align_slots(dwdt,na0,nb0,nc0);
+  align_slots(dt3 ,na0,nb0,nc0);
+}
+
+
+void restore_crm_order() {
+  YAKL_SCOPE( crm_perm , ::crm_perm );
+
+  // Skip the permutation altogether if the CRMs were never reordered
+  auto perm_host = crm_perm.createHostCopy();
+  bool identity = true;
+  for (int icrm=0; icrm<ncrms; icrm++) {
+    if (perm_host(icrm) != icrm) { identity = false; }
+  }
+  if (identity) { return; }
+
+  int1d inv("inv",ncrms);
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    inv(crm_perm(icrm)) = icrm;
+  });
+  permute_crm_arrays(inv);
+}
+
@@ -0,0 +1,25 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include "vars.h"
+#include <vector>
+
+// Per-CRM subcycling. Rather than running every CRM with the worst-case ncycle,
+// each CRM takes ncycle_crm(icrm) subcycles of size dt/ncycle_crm(icrm). The CRMs
+// are reordered by non-increasing ncycle_crm, so that the CRMs active during cycle
+// icyc are a prefix of length nactive[icyc-1]; setting ncrms to that length lets
+// all the kernels of the cycle launch over the active CRMs only.
+// crm_perm(icrm) holds the original index of the CRM currently stored at icrm.
+
+// Reorder the CRMs by non-increasing ncycle_crm, and compute the number of active CRMs per cycle
+void order_crms_by_ncycle(std::vector<int> &nactive);
+
+// For the CRMs that took fewer than ncycle subcycles, move the Adams-Bashforth
+// tendencies (and time steps) to the slots the global na/nb/nc point to.
+// na0, nb0, nc0 are the slot indices at the start of the icycle loop.
+void align_ab_slots(int na0, int nb0, int nc0);
+
+// Bring the CRMs back to their original order
+void restore_crm_order();
+
@@ -0,0 +1,101 @@
+
+#include "advect_scalar.h"
+
+#include <cstdlib>
+#include <iostream>
+
+// Checks that advecting several scalars in one batch with advect_scalars is bit-for-bit
+// equal to advecting each of them on its own, i.e., that the batched kernels do not
+// couple the scalars, nor change the order of the operations done for each of them.
+//   usage: advect_scalars_bfb [ncrms]
+
+int count_diffs(real5d const &a, int is_a, real5d const &b, int is_b) {
+  yakl::ScalarLiveOut<int> ndiff(0);
+  parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    if (a(is_a,k,j,i,icrm) != b(is_b,k,j,i,icrm)) { yakl::atomicAdd(ndiff(),1); }
+  });
+  return ndiff.hostRead();
+}
+
+int count_diffs(real3d const &a, int is_a, real3d const &b, int is_b, int nlev) {
+  yakl::ScalarLiveOut<int> ndiff(0);
+  parallel_for( SimpleBounds<2>(nlev,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    if (a(is_a,k,icrm) != b(is_b,k,icrm)) { yakl::atomicAdd(ndiff(),1); }
+  });
+  return ndiff.hostRead();
+}
+
+int main(int argc, char **argv) {
+  int constexpr nscal = 4;
+
+  yakl::init();
+  int nfail = 0;
+  {
+    ncrms = argc > 1 ? atoi(argv[1]) : NCRMS;
+    allocate();
+    init_values();
+
+    YAKL_SCOPE( u    , ::u );
+    YAKL_SCOPE( v    , ::v );
+    YAKL_SCOPE( w    , ::w );
+    YAKL_SCOPE( rho  , ::rho );
+    YAKL_SCOPE( rhow , ::rhow );
+    YAKL_SCOPE( adz  , ::adz );
+
+    // Smooth, non-trivial velocities (as Courant numbers) and density profiles
+    parallel_for( SimpleBounds<4>(nzm,dimy_u,dimx_u,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      u(k,j,i,icrm) = 0.3*sin(0.7*i + 0.3*j + 0.2*k + icrm);
+    });
+    parallel_for( SimpleBounds<4>(nzm,dimy_v,dimx_v,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      v(k,j,i,icrm) = 0.2*YES3D*cos(0.5*i + 0.9*j + 0.1*k + icrm);
+    });
+    parallel_for( SimpleBounds<4>(nz,dimy_w,dimx_w,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      w(k,j,i,icrm) = (k == 0 || k == nz-1) ? 0. : 0.1*sin(0.4*i + 0.6*j + 0.5*k + icrm);
+    });
+    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+      rhow(k,icrm) = 1.2*exp(-0.05*k) + 0.01*icrm;
+      if (k < nzm) {
+        rho(k,icrm) = 1.2*exp(-0.05*(k+0.5)) + 0.01*icrm;
+        adz(k,icrm) = 1. + 0.02*k;
+      }
+    });
+
+    // Positive scalars, with different shapes
+    real5d fb("fb", nscal, nzm, dimy_s, dimx_s, ncrms);
+    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      for (int is=0; is<nscal; is++) {
+        fb(is,k,j,i,icrm) = 2. + sin((is+1)*(0.9*i + 0.4*j) + 0.3*k) + 0.1*is*icrm;
+      }
+    });
+    real5d f1 = fb.createDeviceCopy();
+
+    // All the scalars in one batch
+    real3d fadv("fadv", nscal, nz, ncrms);
+    real3d flux("flux", nscal, nz, ncrms);
+    advect_scalars(fb, nscal, fadv, flux);
+
+    // One scalar at a time
+    real5d fs   ("fs"   , 1, nzm, dimy_s, dimx_s, ncrms);
+    real3d fadvs("fadvs", 1, nz, ncrms);
+    real3d fluxs("fluxs", 1, nz, ncrms);
+    for (int is=0; is<nscal; is++) {
+      parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        fs(0,k,j,i,icrm) = f1(is,k,j,i,icrm);
+      });
+      advect_scalars(fs, 1, fadvs, fluxs);
+
+      int nf    = count_diffs(fb, is, fs, 0);
+      int nfadv = count_diffs(fadv, is, fadvs, 0, nzm);
+      int nflux = count_diffs(flux, is, fluxs, 0, nz);
+      std::cout << "scalar " << is << ": " << nf << " diffs in f, " << nfadv << " in fadv, "
+                << nflux << " in flux" << std::endl;
+      nfail += nf + nfadv + nflux;
+    }
+
+    finalize();
+  }
+  yakl::finalize();
+
+  std::cout << (nfail == 0 ? "PASS" : "FAIL") << std::endl;
+  return nfail == 0 ? 0 : 1;
+}
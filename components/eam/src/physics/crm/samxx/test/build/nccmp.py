@@ -10,15 +10,20 @@ import netCDF4, sys, numpy as np
 # conda create --name crm_test_env --channel conda-forge netcdf4 numpy
 #
 # Usage:
-# python nccmp.py file1.nc file2.nc
+# python nccmp.py file1.nc file2.nc [--bfb]
+#
+# With --bfb, the script exits with an error if any variable differs, e.g., to
+# check that a change is bit-for-bit against the output of a baseline build.
 #
 ################################################################################
 ################################################################################
 
 # Complain if there aren't two arguments
 if (len(sys.argv) < 3) :
-  print("Usage: python nccmp.py file1.nc file2.nc")
+  print("Usage: python nccmp.py file1.nc file2.nc [--bfb]")
   sys.exit(1)
+bfb = "--bfb" in sys.argv[3:]
+ndiff = 0
 
 # Open the two files
 nc1 = netCDF4.Dataset(sys.argv[1])
@@ -64,5 +69,10 @@ for v in nc1.variables.keys() :
 
     # Print to terminal
     print(f'{v:<20}:  {norm2:20.10e}  {normi:20.10e}  {avg_abs_err:20.10e}  {max_abs_err:20.10e}')
+    ndiff += 1
+
+if bfb and ndiff > 0 :
+  print(f"\nERROR: {ndiff} variables are not bit-for-bit")
+  sys.exit(1)
 
 
@@ -0,0 +1,82 @@
+import netCDF4, sys, numpy as np
+################################################################################
+################################################################################
+# ncsubcycle.py: Regression test of the per-CRM subcycling of the C++ CRM.
+#
+# Each CRM takes its own number of subcycles, so the result of a CRM must not
+# depend on the other CRMs run with it, nor on its position in the batch. The
+# "make" step writes two input files from a standalone input file:
+#  - input_fast.nc: the odd CRMs get a strong uniform wind (+du m/s in u), so
+#    that they take more subcycles than the even ones
+#  - input_rev.nc : the original CRMs, in reverse order
+# The "check" step then requires the outputs of the even CRMs of both runs to
+# be bit-for-bit equal (CPU builds only: the GPU builds use atomics, so they are
+# not reproducible). Run both with a single MPI task.
+#
+# Usage:
+# python ncsubcycle.py make input.nc [ncrms] [du]
+# python ncsubcycle.py check output_fast.nc output_rev.nc
+#
+################################################################################
+################################################################################
+
+# Write the first ncrms CRMs of nc1 to fname, in reverse order if rev
+def write_crms(nc1, fname, ncrms, rev=False, du=0.) :
+  nc2 = netCDF4.Dataset(fname,"w")
+  for d in nc1.dimensions.keys() :
+    dim = nc1.dimensions[d]
+    nc2.createDimension(dim.name, 0 if dim.isunlimited() else dim.size)
+  for v in nc1.variables.keys() :
+    var1 = nc1.variables[v]
+    var2 = nc2.createVariable(v,var1.datatype,var1.dimensions)
+    if ( var1.ndim == 0 or not nc1.dimensions[var1.dimensions[0]].isunlimited() ) :
+      var2[:] = var1[:]
+    else :
+      a = var1[0:ncrms,...]
+      if (rev) : a = a[::-1,...]
+      if (du != 0. and v in ["state_u_wind","in_ul","in_ul_esmt"]) :
+        a[1::2,...] += du
+      var2[:] = a
+  nc2.close()
+
+
+if (len(sys.argv) < 3) :
+  print("Usage: python ncsubcycle.py make input.nc [ncrms] [du]")
+  print("       python ncsubcycle.py check output_fast.nc output_rev.nc")
+  sys.exit(1)
+
+if (sys.argv[1] == "make") :
+  nc1 = netCDF4.Dataset(sys.argv[2])
+  ncrms = [len(d) for d in nc1.dimensions.values() if d.isunlimited()][0]
+  if (len(sys.argv) > 3 and sys.argv[3] != "") : ncrms = min(ncrms,int(sys.argv[3]))
+  du = float(sys.argv[4]) if len(sys.argv) > 4 else 150.
+  if (ncrms < 2) :
+    print("ERROR: at least two CRMs are needed")
+    sys.exit(1)
+  # Only the first ncrms CRMs are read by the standalone driver
+  write_crms(nc1, "input_fast.nc", ncrms, du=du)
+  write_crms(nc1, "input_rev.nc" , ncrms, rev=True)
+  print(f"Wrote input_fast.nc and input_rev.nc with {ncrms} CRMs")
+
+elif (sys.argv[1] == "check" and len(sys.argv) > 3) :
+  nc1 = netCDF4.Dataset(sys.argv[2])
+  nc2 = netCDF4.Dataset(sys.argv[3])
+  ndiff = 0
+  for v in nc1.variables.keys() :
+    var1 = nc1.variables[v]
+    if (var1.ndim == 0 or not nc1.dimensions[var1.dimensions[0]].isunlimited()) : continue
+    if (var1.dtype != np.float64 and var1.dtype != np.float32) : continue
+    a1 = var1[:]
+    a2 = nc2.variables[v][:][::-1,...]
+    adiff = abs(a2[0::2,...] - a1[0::2,...])
+    if (np.amax(adiff) != 0) :
+      print(f'{v:<20}:  max abs diff {np.amax(adiff):20.10e}')
+      ndiff += 1
+  if ndiff > 0 :
+    print(f"\nERROR: {ndiff} variables of the CRMs with fewer subcycles depend on the other CRMs")
+    sys.exit(1)
+  print("PASS")
+
+else :
+  print("Unknown step: "+sys.argv[1])
+  sys.exit(1)
@@ -0,0 +1,29 @@
+#!/bin/bash
+
+# Per-CRM subcycling regression run (see ncsubcycle.py), with the 3-D C++ code.
+# Run after runtest.sh, from the same directory. CPU builds only.
+
+printf "\nRebuilding\n\n"
+
+make -j8 cpp3d || exit -1
+
+################################################################################
+################################################################################
+
+printf "\n\nRunning 3-D per-CRM subcycling test\n\n"
+
+mkdir -p cpp3d_subcycle
+cd cpp3d_subcycle
+python ../ncsubcycle.py make ../cpp3d/input.nc $NCRMS || exit -1
+
+for case in fast rev; do
+  printf "\nRunning C++ code: $case\n\n"
+  rm -f input.nc cpp_output_000001.nc
+  ln -s input_$case.nc input.nc
+  mpirun -n 1 ../cpp3d/cpp3d || exit -1
+  mv cpp_output_000001.nc output_$case.nc
+done
+
+printf "\nComparing results\n\n"
+python ../ncsubcycle.py check output_fast.nc output_rev.nc || exit -1
+cd ..
@@ -0,0 +1,101 @@
+
+#include "pressure_fft.h"
+#include "YAKL_fft.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+// Times forward+inverse pressure FFTs over all slabs and CRMs, with the YAKL RealFFT1D
+// path used by pressure() for general CRM sizes, and with the batched FFTs used for
+// power-of-two sizes. Also checks that both round trips recover the input, and that the
+// batched forward transform gives the same modes as the YAKL one, for the same input.
+//   usage: pressure_fft_bench [ncrms] [niter]
+
+// Max abs difference over f(0:nzslab-1,0:nj-1,0:ni-1,:)
+real max_diff(real4d const &f, real4d const &f0, int nzslab, int nj, int ni, int ncrms) {
+  real4d d("d", nzslab, nj, ni, ncrms);
+  parallel_for( SimpleBounds<4>(nzslab,nj,ni,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    d(k,j,i,icrm) = abs(f(k,j,i,icrm) - f0(k,j,i,icrm));
+  });
+  return yakl::intrinsics::maxval(d);
+}
+
+int main(int argc, char **argv) {
+  int ncrms  = argc > 1 ? atoi(argv[1]) : NCRMS;
+  int niter  = argc > 2 ? atoi(argv[2]) : 100;
+  int nzslab = nzm;
+
+  // Both transforms are normalized, and the input is O(1)
+  real tol = 1000*std::numeric_limits<real>::epsilon();
+  int nfail = 0;
+
+  yakl::init();
+  {
+    pressure_fft_allocate();
+
+    real4d f0("f0", nzslab, nyp2, nxp2, ncrms);
+    real4d f ("f" , nzslab, nyp2, nxp2, ncrms);
+    parallel_for( SimpleBounds<4>(nzslab,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      f0(k,j,i,icrm) = sin(0.1*i + 0.2*j + 0.3*k) + 0.01*icrm;
+    });
+
+    auto time_it = [&] (std::string const &label, auto const &fft_roundtrip) {
+      f0.deep_copy_to(f);
+      fft_roundtrip();  // warmup
+      yakl::fence();
+      real err = max_diff(f, f0, nzslab, ny, nx, ncrms);
+      auto t0 = std::chrono::high_resolution_clock::now();
+      for (int n=0; n<niter; n++) { fft_roundtrip(); }
+      yakl::fence();
+      auto t1 = std::chrono::high_resolution_clock::now();
+      double ms = std::chrono::duration<double,std::milli>(t1-t0).count() / niter;
+      std::cout << std::setw(8) << label << ": " << std::scientific << std::setprecision(4)
+                << ms << " ms per forward+inverse, round trip error: " << err << std::endl;
+    };
+
+    std::cout << "nx=" << nx << " ny=" << ny << " nzslab=" << nzslab << " ncrms=" << ncrms
+              << " niter=" << niter << std::endl;
+
+    yakl::RealFFT1D<real> fftx, ffty;
+
+    if (pressure_fft_batched) {
+      // Modes are in f(:,0:ny+1,0:nx+1,:) in 3D, and in f(:,0,0:nx+1,:) in 2D
+      int nj = RUN3D ? ny+2 : ny;
+      real4d fy("fy", nzslab, nyp2, nxp2, ncrms);
+      f0.deep_copy_to(fy);
+      fftx.forward_real(fy, 2, nx);
+      if (RUN3D) { ffty.forward_real(fy, 1, ny); }
+      f0.deep_copy_to(f);
+      pressure_fft_forward(f, nzslab, ncrms);
+      real err = max_diff(f, fy, nzslab, nj, nx+2, ncrms);
+      std::cout << " forward: max difference between yakl and batched modes: " << err << std::endl;
+      if (! (err <= tol)) { nfail++; }
+    }
+
+    time_it("yakl", [&] () {
+      fftx.forward_real(f, 2, nx);
+      if (RUN3D) { ffty.forward_real(f, 1, ny); }
+      if (RUN3D) { ffty.inverse_real(f); }
+      fftx.inverse_real(f);
+    });
+    fftx.cleanup();
+    ffty.cleanup();
+
+    if (pressure_fft_batched) {
+      time_it("batched", [&] () {
+        pressure_fft_forward(f, nzslab, ncrms);
+        pressure_fft_inverse(f, nzslab, ncrms);
+      });
+    } else {
+      std::cout << " batched: not available for these CRM sizes" << std::endl;
+    }
+
+    pressure_fft_finalize();
+  }
+  yakl::finalize();
+
+  std::cout << (nfail == 0 ? "PASS" : "FAIL") << std::endl;
+  return nfail == 0 ? 0 : 1;
+}
@@ -5,13 +5,23 @@ void timeloop() {
   YAKL_SCOPE( crm_output_subcycle_factor , :: crm_output_subcycle_factor );
   YAKL_SCOPE( t                        , :: t );
   YAKL_SCOPE( crm_rad_qrad             , :: crm_rad_qrad );
-  YAKL_SCOPE( dtn                      , :: dtn );
-  YAKL_SCOPE( ncrms                    , :: ncrms );
-  YAKL_SCOPE( na                       , :: na );
+  YAKL_SCOPE( dt                       , :: dt );
+  YAKL_SCOPE( dtn_crm                  , :: dtn_crm );
+  YAKL_SCOPE( dtfactor_crm             , :: dtfactor_crm );
+  YAKL_SCOPE( ncycle_crm               , :: ncycle_crm );
+  YAKL_SCOPE( crm_perm                 , :: crm_perm );
   YAKL_SCOPE( dt3                      , :: dt3 );
   YAKL_SCOPE( use_VT                   , :: use_VT );
   YAKL_SCOPE( use_ESMT                 , :: use_ESMT );
 
+  int ncrms_all = ncrms;
+  std::vector<int> nactive;
+
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms_all , YAKL_LAMBDA (int icrm) {
+    crm_perm(icrm) = icrm;
+  });
+
   nstep = 0;
 
   do {
@@ -23,15 +33,25 @@ void timeloop() {
     //------------------------------------------------------------------
     kurant();
 
+    //------------------------------------------------------------------
+    //  Each CRM takes its own number of subcycles. Order the CRMs so that
+    //  the ones still active at each cycle come first (see subcycle.h)
+    //------------------------------------------------------------------
+    order_crms_by_ncycle(nactive);
+    int na0 = na;
+    int nb0 = nb;
+    int nc0 = nc;
+
     for(int icyc=1; icyc<=ncycle; icyc++) {
       icycle = icyc;
       dtn = dt/ncycle;
-      parallel_for( 1 , YAKL_LAMBDA ( int i ) {
-        dt3(na-1) = dtn;
-      });
-      dtfactor = dtn/dt;
-
+      ncrms = nactive[icyc-1];
+      int na_loc = na;
+      // for (int icrm=0; icrm<ncrms; icrm++) {
       parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+        dtn_crm(icrm) = dt/ncycle_crm(icrm);
+        dtfactor_crm(icrm) = 1.0/ncycle_crm(icrm);
+        dt3(na_loc-1,icrm) = dtn_crm(icrm);
         crm_output_subcycle_factor(icrm) = crm_output_subcycle_factor(icrm)+1;
       });
 
@@ -66,7 +86,7 @@ void timeloop() {
       parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
         int i_rad = i / (nx/crm_nx_rad);
         int j_rad = j / (ny/crm_ny_rad);
-        t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
+        t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn_crm(icrm);
       });
 
       //----------------------------------------------------------
@@ -188,8 +208,15 @@ void timeloop() {
       nb=nn;
     } // icycle
 
+    ncrms = ncrms_all;
+    if (nactive[ncycle-1] < ncrms) {
+      align_ab_slots(na0,nb0,nc0);
+    }
+
     post_icycle();
 
   } while (nstep < nstop);
 
+  restore_crm_order();
+
 }
@@ -7,7 +7,7 @@ void tke_full(real5d &tke, int ind_tke, real5d &tk, int ind_tk, real5d &tkh, int
   YAKL_SCOPE( adzw           , :: adzw );
   YAKL_SCOPE( adz            , :: adz );
   YAKL_SCOPE( dt             , :: dt );
-  YAKL_SCOPE( dtn            , :: dtn );
+  YAKL_SCOPE( dtn_crm        , :: dtn_crm );
   YAKL_SCOPE( dx             , :: dx );
   YAKL_SCOPE( dy             , :: dy );
   YAKL_SCOPE( tabs           , :: tabs );
@@ -230,7 +230,7 @@ void tke_full(real5d &tke, int ind_tke, real5d &tk, int ind_tk, real5d &tkh, int
       // cap the diss rate (useful for large time steps)
       a_diss = min(tke(ind_tke,k,j+offy_s,i+offx_s,icrm)/(4.0*dt),Cee/smix*pow(tke(ind_tke,k,j+offy_s,i+offx_s,icrm),1.5));
       tke(ind_tke,k,j+offy_s,i+offx_s,icrm) = max(0.0,tke(ind_tke,k,j+offy_s,i+offx_s,icrm)+
-                                                      dtn*(max(0.0,a_prod_sh+a_prod_bu)-a_diss));
+                                                      dtn_crm(icrm)*(max(0.0,a_prod_sh+a_prod_bu)-a_diss));
       tk(ind_tk,k,j+offy_d,i+offx_d,icrm)  = Ck*smix*sqrt(tke(ind_tke,k,j+offy_s,i+offx_s,icrm));
     }
     tk(ind_tk,k,j+offy_d,i+offx_d,icrm)  = min(tk(ind_tk,k,j+offy_d,i+offx_d,icrm),tkmax);
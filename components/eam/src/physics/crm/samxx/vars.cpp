@@ -1,5 +1,7 @@
 
 #include "vars.h"
+#include "scratch.h"
+#include "pressure_fft.h"
 
 void allocate() {
   t00              = real2d( "t00                "      , nzm, ncrms);
@@ -86,7 +88,14 @@ void allocate() {
   adz              = real2d( "adz             "                        , nzm    , ncrms ); 
   adzw             = real2d( "adzw            "                        , nz     , ncrms ); 
   dz               = real1d( "dz              "                                 , ncrms ); 
-  dt3              = real1d( "dt3             " , 3                                     ); 
+  dt3              = real2d( "dt3             " , 3                             , ncrms ); 
+  ncycle_crm       = int1d ( "ncycle_crm      "                                 , ncrms ); 
+  crm_perm         = int1d ( "crm_perm        "                                 , ncrms ); 
+  dtn_crm          = real1d( "dtn_crm         "                                 , ncrms ); 
+  dtfactor_crm     = real1d( "dtfactor_crm    "                                 , ncrms ); 
+  at               = real1d( "at              "                                 , ncrms ); 
+  bt               = real1d( "bt              "                                 , ncrms ); 
+  ct               = real1d( "ct              "                                 , ncrms ); 
   u                = real4d( "u               "     , nzm , dimy_u     , dimx_u , ncrms ); 
   v                = real4d( "v               "     , nzm , dimy_v     , dimx_v , ncrms ); 
   w                = real4d( "w               "     , nz  , dimy_w     , dimx_w , ncrms ); 
@@ -268,6 +277,12 @@ void allocate() {
   yakl::memset(adzw              ,0.);
   yakl::memset(dz                ,0.);
   yakl::memset(dt3               ,0.);
+  yakl::memset(ncycle_crm        ,1);
+  yakl::memset(dtn_crm           ,0.);
+  yakl::memset(dtfactor_crm      ,0.);
+  yakl::memset(at                ,0.);
+  yakl::memset(bt                ,0.);
+  yakl::memset(ct                ,0.);
   yakl::memset(u                 ,0.);
   yakl::memset(v                 ,0.);
   yakl::memset(w                 ,0.);
@@ -382,6 +397,9 @@ void allocate() {
   yakl::memset(t_vt              ,0.);
   yakl::memset(q_vt              ,0.);
   yakl::memset(u_vt              ,0.);
+
+  scratch_allocate(ncrms);
+  pressure_fft_allocate();
 }
 
 
@@ -551,7 +569,15 @@ void finalize() {
   adz              = real2d(); 
   adzw             = real2d(); 
   dz               = real1d(); 
-  dt3              = real1d(); 
+  dt3              = real2d(); 
+  ncycle_crm       = int1d(); 
+  crm_perm         = int1d(); 
+  crm_perm_buffer  = real1d(); 
+  dtn_crm          = real1d(); 
+  dtfactor_crm     = real1d(); 
+  at               = real1d(); 
+  bt               = real1d(); 
+  ct               = real1d(); 
   u                = real4d();
   v                = real4d();
   w                = real4d();
@@ -669,6 +695,9 @@ void finalize() {
 
   yakl::fence();
 
+  scratch_finalize();
+  pressure_fft_finalize();
+
   pressure_fftx.cleanup();
   pressure_ffty.cleanup();
   vt_fftx.cleanup();
@@ -1375,6 +1404,312 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
 }
 
 
+void permute_crm_arrays(int1d const &perm) {
+  permute_crms( t00                        , perm , ncrms );
+  permute_crms( tln                        , perm , ncrms );
+  permute_crms( qln                        , perm , ncrms );
+  permute_crms( qccln                      , perm , ncrms );
+  permute_crms( qiiln                      , perm , ncrms );
+  permute_crms( uln                        , perm , ncrms );
+  permute_crms( vln                        , perm , ncrms );
+  permute_crms( uln_esmt                   , perm , ncrms );
+  permute_crms( vln_esmt                   , perm , ncrms );
+  permute_crms( cwp                        , perm , ncrms );
+  permute_crms( cwph                       , perm , ncrms );
+  permute_crms( cwpm                       , perm , ncrms );
+  permute_crms( cwpl                       , perm , ncrms );
+  permute_crms( cltemp                     , perm , ncrms );
+  permute_crms( cmtemp                     , perm , ncrms );
+  permute_crms( chtemp                     , perm , ncrms );
+  permute_crms( cttemp                     , perm , ncrms );
+  permute_crms( dd_crm                     , perm , ncrms );
+  permute_crms( mui_crm                    , perm , ncrms );
+  permute_crms( mdi_crm                    , perm , ncrms );
+  permute_crms( ustar                      , perm , ncrms );
+  permute_crms( wnd                        , perm , ncrms );
+  permute_crms( qtot                       , perm , ncrms );
+  permute_crms( colprec                    , perm , ncrms );
+  permute_crms( colprecs                   , perm , ncrms );
+  permute_crms( bflx                       , perm , ncrms );
+  permute_crms( flag_top                   , perm , ncrms );
+  permute_crms( accrsc                     , perm , ncrms );
+  permute_crms( accrsi                     , perm , ncrms );
+  permute_crms( accrrc                     , perm , ncrms );
+  permute_crms( coefice                    , perm , ncrms );
+  permute_crms( accrgc                     , perm , ncrms );
+  permute_crms( accrgi                     , perm , ncrms );
+  permute_crms( evaps1                     , perm , ncrms );
+  permute_crms( evaps2                     , perm , ncrms );
+  permute_crms( evapr1                     , perm , ncrms );
+  permute_crms( evapr2                     , perm , ncrms );
+  permute_crms( evapg1                     , perm , ncrms );
+  permute_crms( evapg2                     , perm , ncrms );
+  permute_crms( micro_field                , perm , ncrms );
+  permute_crms( fluxbmk                    , perm , ncrms );
+  permute_crms( fluxtmk                    , perm , ncrms );
+  permute_crms( mkwle                      , perm , ncrms );
+  permute_crms( mkwsb                      , perm , ncrms );
+  permute_crms( mkadv                      , perm , ncrms );
+  permute_crms( mkdiff                     , perm , ncrms );
+  permute_crms( qn                         , perm , ncrms );
+  permute_crms( qpsrc                      , perm , ncrms );
+  permute_crms( qpevp                      , perm , ncrms );
+  permute_crms( u_esmt                     , perm , ncrms );
+  permute_crms( v_esmt                     , perm , ncrms );
+  permute_crms( u_esmt_sgs                 , perm , ncrms );
+  permute_crms( v_esmt_sgs                 , perm , ncrms );
+  permute_crms( u_esmt_diff                , perm , ncrms );
+  permute_crms( v_esmt_diff                , perm , ncrms );
+  permute_crms( fluxb_u_esmt               , perm , ncrms );
+  permute_crms( fluxb_v_esmt               , perm , ncrms );
+  permute_crms( fluxt_u_esmt               , perm , ncrms );
+  permute_crms( fluxt_v_esmt               , perm , ncrms );
+  permute_crms( fcorz                      , perm , ncrms );
+  permute_crms( fcor                       , perm , ncrms );
+  permute_crms( longitude0                 , perm , ncrms );
+  permute_crms( latitude0                  , perm , ncrms );
+  permute_crms( z0                         , perm , ncrms );
+  permute_crms( uhl                        , perm , ncrms );
+  permute_crms( vhl                        , perm , ncrms );
+  permute_crms( taux0                      , perm , ncrms );
+  permute_crms( tauy0                      , perm , ncrms );
+  permute_crms( sgs_field                  , perm , ncrms );
+  permute_crms( sgs_field_diag             , perm , ncrms );
+  permute_crms( grdf_x                     , perm , ncrms );
+  permute_crms( grdf_y                     , perm , ncrms );
+  permute_crms( grdf_z                     , perm , ncrms );
+  permute_crms( tkesbbuoy                  , perm , ncrms );
+  permute_crms( tkesbshear                 , perm , ncrms );
+  permute_crms( tkesbdiss                  , perm , ncrms );
+  permute_crms( z                          , perm , ncrms );
+  permute_crms( pres                       , perm , ncrms );
+  permute_crms( zi                         , perm , ncrms );
+  permute_crms( presi                      , perm , ncrms );
+  permute_crms( adz                        , perm , ncrms );
+  permute_crms( adzw                       , perm , ncrms );
+  permute_crms( dz                         , perm , ncrms );
+  permute_crms( dt3                        , perm , ncrms );
+  permute_crms( ncycle_crm                 , perm , ncrms );
+  permute_crms( crm_perm                   , perm , ncrms );
+  permute_crms( dtn_crm                    , perm , ncrms );
+  permute_crms( dtfactor_crm               , perm , ncrms );
+  permute_crms( at                         , perm , ncrms );
+  permute_crms( bt                         , perm , ncrms );
+  permute_crms( ct                         , perm , ncrms );
+  permute_crms( u                          , perm , ncrms );
+  permute_crms( v                          , perm , ncrms );
+  permute_crms( w                          , perm , ncrms );
+  permute_crms( t                          , perm , ncrms );
+  permute_crms( p                          , perm , ncrms );
+  permute_crms( tabs                       , perm , ncrms );
+  permute_crms( qv                         , perm , ncrms );
+  permute_crms( qcl                        , perm , ncrms );
+  permute_crms( qpl                        , perm , ncrms );
+  permute_crms( qci                        , perm , ncrms );
+  permute_crms( qpi                        , perm , ncrms );
+  permute_crms( tke2                       , perm , ncrms );
+  permute_crms( tk2                        , perm , ncrms );
+  permute_crms( dudt                       , perm , ncrms );
+  permute_crms( dvdt                       , perm , ncrms );
+  permute_crms( dwdt                       , perm , ncrms );
+  permute_crms( misc                       , perm , ncrms );
+  permute_crms( fluxbu                     , perm , ncrms );
+  permute_crms( fluxbv                     , perm , ncrms );
+  permute_crms( fluxbt                     , perm , ncrms );
+  permute_crms( fluxbq                     , perm , ncrms );
+  permute_crms( fluxtu                     , perm , ncrms );
+  permute_crms( fluxtv                     , perm , ncrms );
+  permute_crms( fluxtt                     , perm , ncrms );
+  permute_crms( fluxtq                     , perm , ncrms );
+  permute_crms( fzero                      , perm , ncrms );
+  permute_crms( precsfc                    , perm , ncrms );
+  permute_crms( precssfc                   , perm , ncrms );
+  permute_crms( t0                         , perm , ncrms );
+  permute_crms( q0                         , perm , ncrms );
+  permute_crms( qv0                        , perm , ncrms );
+  permute_crms( tabs0                      , perm , ncrms );
+  permute_crms( tv0                        , perm , ncrms );
+  permute_crms( u0                         , perm , ncrms );
+  permute_crms( v0                         , perm , ncrms );
+  permute_crms( tg0                        , perm , ncrms );
+  permute_crms( qg0                        , perm , ncrms );
+  permute_crms( ug0                        , perm , ncrms );
+  permute_crms( vg0                        , perm , ncrms );
+  permute_crms( p0                         , perm , ncrms );
+  permute_crms( tke0                       , perm , ncrms );
+  permute_crms( t01                        , perm , ncrms );
+  permute_crms( q01                        , perm , ncrms );
+  permute_crms( qp0                        , perm , ncrms );
+  permute_crms( qn0                        , perm , ncrms );
+  permute_crms( prespot                    , perm , ncrms );
+  permute_crms( rho                        , perm , ncrms );
+  permute_crms( rhow                       , perm , ncrms );
+  permute_crms( bet                        , perm , ncrms );
+  permute_crms( gamaz                      , perm , ncrms );
+  permute_crms( wsub                       , perm , ncrms );
+  permute_crms( qtend                      , perm , ncrms );
+  permute_crms( ttend                      , perm , ncrms );
+  permute_crms( utend                      , perm , ncrms );
+  permute_crms( vtend                      , perm , ncrms );
+  permute_crms( sstxy                      , perm , ncrms );
+  permute_crms( fcory                      , perm , ncrms );
+  permute_crms( fcorzy                     , perm , ncrms );
+  permute_crms( latitude                   , perm , ncrms );
+  permute_crms( longitude                  , perm , ncrms );
+  permute_crms( prec_xy                    , perm , ncrms );
+  permute_crms( pw_xy                      , perm , ncrms );
+  permute_crms( cw_xy                      , perm , ncrms );
+  permute_crms( iw_xy                      , perm , ncrms );
+  permute_crms( cld_xy                     , perm , ncrms );
+  permute_crms( u200_xy                    , perm , ncrms );
+  permute_crms( usfc_xy                    , perm , ncrms );
+  permute_crms( v200_xy                    , perm , ncrms );
+  permute_crms( vsfc_xy                    , perm , ncrms );
+  permute_crms( w500_xy                    , perm , ncrms );
+  permute_crms( w_max                      , perm , ncrms );
+  permute_crms( u_max                      , perm , ncrms );
+  permute_crms( twsb                       , perm , ncrms );
+  permute_crms( precflux                   , perm , ncrms );
+  permute_crms( uwle                       , perm , ncrms );
+  permute_crms( uwsb                       , perm , ncrms );
+  permute_crms( vwle                       , perm , ncrms );
+  permute_crms( vwsb                       , perm , ncrms );
+  permute_crms( tkelediss                  , perm , ncrms );
+  permute_crms( tdiff                      , perm , ncrms );
+  permute_crms( tlat                       , perm , ncrms );
+  permute_crms( tlatqi                     , perm , ncrms );
+  permute_crms( qifall                     , perm , ncrms );
+  permute_crms( qpfall                     , perm , ncrms );
+  permute_crms( total_water_evap           , perm , ncrms );
+  permute_crms( total_water_prec           , perm , ncrms );
+  permute_crms( CF3D                       , perm , ncrms );
+  permute_crms( u850_xy                    , perm , ncrms );
+  permute_crms( v850_xy                    , perm , ncrms );
+  permute_crms( psfc_xy                    , perm , ncrms );
+  permute_crms( swvp_xy                    , perm , ncrms );
+  permute_crms( cloudtopheight             , perm , ncrms );
+  permute_crms( echotopheight              , perm , ncrms );
+  permute_crms( cloudtoptemp               , perm , ncrms );
+  permute_crms( crm_clear_rh_cnt           , perm , ncrms );
+  permute_crms( t_vt                       , perm , ncrms );
+  permute_crms( q_vt                       , perm , ncrms );
+  permute_crms( u_vt                       , perm , ncrms );
+  permute_crms( t_vt_tend                  , perm , ncrms );
+  permute_crms( q_vt_tend                  , perm , ncrms );
+  permute_crms( u_vt_tend                  , perm , ncrms );
+  permute_crms( t_vt_pert                  , perm , ncrms );
+  permute_crms( q_vt_pert                  , perm , ncrms );
+  permute_crms( u_vt_pert                  , perm , ncrms );
+  permute_crms( crm_input_bflxls           , perm , pcols );
+  permute_crms( crm_input_wndls            , perm , pcols );
+  permute_crms( crm_input_zmid             , perm , pcols );
+  permute_crms( crm_input_zint             , perm , pcols );
+  permute_crms( crm_input_pmid             , perm , pcols );
+  permute_crms( crm_input_pint             , perm , pcols );
+  permute_crms( crm_input_pdel             , perm , pcols );
+  permute_crms( crm_input_ul               , perm , pcols );
+  permute_crms( crm_input_vl               , perm , pcols );
+  permute_crms( crm_input_tl               , perm , pcols );
+  permute_crms( crm_input_qccl             , perm , pcols );
+  permute_crms( crm_input_qiil             , perm , pcols );
+  permute_crms( crm_input_ql               , perm , pcols );
+  permute_crms( crm_input_tau00            , perm , pcols );
+  permute_crms( crm_input_ul_esmt          , perm , pcols );
+  permute_crms( crm_input_vl_esmt          , perm , pcols );
+  permute_crms( crm_input_t_vt             , perm , pcols );
+  permute_crms( crm_input_q_vt             , perm , pcols );
+  permute_crms( crm_input_u_vt             , perm , pcols );
+  permute_crms( crm_state_u_wind           , perm , pcols );
+  permute_crms( crm_state_v_wind           , perm , pcols );
+  permute_crms( crm_state_w_wind           , perm , pcols );
+  permute_crms( crm_state_temperature      , perm , pcols );
+  permute_crms( crm_state_qv               , perm , pcols );
+  permute_crms( crm_state_qp               , perm , pcols );
+  permute_crms( crm_state_qn               , perm , pcols );
+  permute_crms( crm_rad_qrad               , perm , pcols );
+  permute_crms( crm_rad_temperature        , perm , pcols );
+  permute_crms( crm_rad_qv                 , perm , pcols );
+  permute_crms( crm_rad_qc                 , perm , pcols );
+  permute_crms( crm_rad_qi                 , perm , pcols );
+  permute_crms( crm_rad_cld                , perm , pcols );
+  permute_crms( crm_output_subcycle_factor , perm , pcols );
+  permute_crms( crm_output_prectend        , perm , pcols );
+  permute_crms( crm_output_precstend       , perm , pcols );
+  permute_crms( crm_output_cld             , perm , pcols );
+  permute_crms( crm_output_cldtop          , perm , pcols );
+  permute_crms( crm_output_gicewp          , perm , pcols );
+  permute_crms( crm_output_gliqwp          , perm , pcols );
+  permute_crms( crm_output_mctot           , perm , pcols );
+  permute_crms( crm_output_mcup            , perm , pcols );
+  permute_crms( crm_output_mcdn            , perm , pcols );
+  permute_crms( crm_output_mcuup           , perm , pcols );
+  permute_crms( crm_output_mcudn           , perm , pcols );
+  permute_crms( crm_output_qc_mean         , perm , pcols );
+  permute_crms( crm_output_qi_mean         , perm , pcols );
+  permute_crms( crm_output_qs_mean         , perm , pcols );
+  permute_crms( crm_output_qg_mean         , perm , pcols );
+  permute_crms( crm_output_qr_mean         , perm , pcols );
+  permute_crms( crm_output_mu_crm          , perm , pcols );
+  permute_crms( crm_output_md_crm          , perm , pcols );
+  permute_crms( crm_output_eu_crm          , perm , pcols );
+  permute_crms( crm_output_du_crm          , perm , pcols );
+  permute_crms( crm_output_ed_crm          , perm , pcols );
+  permute_crms( crm_output_flux_qt         , perm , pcols );
+  permute_crms( crm_output_flux_u          , perm , pcols );
+  permute_crms( crm_output_flux_v          , perm , pcols );
+  permute_crms( crm_output_fluxsgs_qt      , perm , pcols );
+  permute_crms( crm_output_tkez            , perm , pcols );
+  permute_crms( crm_output_tkew            , perm , pcols );
+  permute_crms( crm_output_tkesgsz         , perm , pcols );
+  permute_crms( crm_output_tkz             , perm , pcols );
+  permute_crms( crm_output_flux_qp         , perm , pcols );
+  permute_crms( crm_output_precflux        , perm , pcols );
+  permute_crms( crm_output_qt_trans        , perm , pcols );
+  permute_crms( crm_output_qp_trans        , perm , pcols );
+  permute_crms( crm_output_qp_fall         , perm , pcols );
+  permute_crms( crm_output_qp_evp          , perm , pcols );
+  permute_crms( crm_output_qp_src          , perm , pcols );
+  permute_crms( crm_output_qt_ls           , perm , pcols );
+  permute_crms( crm_output_t_ls            , perm , pcols );
+  permute_crms( crm_output_jt_crm          , perm , pcols );
+  permute_crms( crm_output_mx_crm          , perm , pcols );
+  permute_crms( crm_output_cltot           , perm , pcols );
+  permute_crms( crm_output_clhgh           , perm , pcols );
+  permute_crms( crm_output_clmed           , perm , pcols );
+  permute_crms( crm_output_cllow           , perm , pcols );
+  permute_crms( crm_output_sltend          , perm , pcols );
+  permute_crms( crm_output_qltend          , perm , pcols );
+  permute_crms( crm_output_qcltend         , perm , pcols );
+  permute_crms( crm_output_qiltend         , perm , pcols );
+  permute_crms( crm_output_t_vt_tend       , perm , pcols );
+  permute_crms( crm_output_q_vt_tend       , perm , pcols );
+  permute_crms( crm_output_u_vt_tend       , perm , pcols );
+  permute_crms( crm_output_t_vt_ls         , perm , pcols );
+  permute_crms( crm_output_q_vt_ls         , perm , pcols );
+  permute_crms( crm_output_u_vt_ls         , perm , pcols );
+  permute_crms( crm_output_ultend          , perm , pcols );
+  permute_crms( crm_output_vltend          , perm , pcols );
+  permute_crms( crm_output_tk              , perm , pcols );
+  permute_crms( crm_output_tkh             , perm , pcols );
+  permute_crms( crm_output_qcl             , perm , pcols );
+  permute_crms( crm_output_qci             , perm , pcols );
+  permute_crms( crm_output_qpl             , perm , pcols );
+  permute_crms( crm_output_qpi             , perm , pcols );
+  permute_crms( crm_output_z0m             , perm , pcols );
+  permute_crms( crm_output_taux            , perm , pcols );
+  permute_crms( crm_output_tauy            , perm , pcols );
+  permute_crms( crm_output_precc           , perm , pcols );
+  permute_crms( crm_output_precl           , perm , pcols );
+  permute_crms( crm_output_precsc          , perm , pcols );
+  permute_crms( crm_output_precsl          , perm , pcols );
+  permute_crms( crm_output_prec_crm        , perm , pcols );
+  permute_crms( crm_clear_rh               , perm , ncrms );
+  permute_crms( lat0                       , perm , ncrms );
+  permute_crms( long0                      , perm , ncrms );
+  permute_crms( gcolp                      , perm , ncrms );
+}
+
+
 void perturb_arrays() {
   
   #ifdef __PERTURB__
@@ -1643,8 +1978,16 @@ real2d zi              ;
 real2d presi           ;
 real2d adz             ;
 real2d adzw            ;
-real1d dt3             ;
+real2d dt3             ;
 real1d dz              ;
+int1d  ncycle_crm      ;
+int1d  crm_perm        ;
+real1d crm_perm_buffer ;
+real1d dtn_crm         ;
+real1d dtfactor_crm    ;
+real1d at              ;
+real1d bt              ;
+real1d ct              ;
 
 real5d sgs_field       ;
 real5d sgs_field_diag  ;
@@ -1836,9 +2179,7 @@ int  nstep                    ;
 int  ncycle                   ;
 int  icycle                   ;
 int  na, nb, nc               ;
-real at, bt, ct               ;
 real dtn                      ;
-real dtfactor                 ;
 int  rank                     ;
 int  ranknn                   ;
 int  rankss                   ;
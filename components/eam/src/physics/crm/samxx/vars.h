@@ -54,6 +54,37 @@ extern real5d micro_field   ; // Index as sgs_field_diag(l , k , offy_s    +j ,
 void perturb_arrays();
 
 
+// Staging buffer of permute_crms, shared by all the arrays. It only grows, and it is
+// released by finalize()
+extern real1d crm_perm_buffer;
+
+
+// Reorder the first ncrms entries along the last (fastest varying) dimension of arr,
+// whose extent is ncol, so that CRM icrm of the output is CRM perm(icrm) of the input
+template <class T, int N>
+inline void permute_crms(yakl::Array<T,N,yakl::memDevice,yakl::styleC> &arr, int1d const &perm, int ncol) {
+  static_assert(sizeof(T) <= sizeof(real), "permute_crms: the staging buffer holds reals");
+  YAKL_SCOPE( ncrms , ::ncrms );
+  int nrest = arr.get_totElems() / ncol;
+  if (crm_perm_buffer.get_totElems() < nrest*ncrms) {
+    crm_perm_buffer = real1d("crm_perm_buffer", nrest*ncrms);
+  }
+  T *tmp = reinterpret_cast<T *>(crm_perm_buffer.data());
+  T *dst = arr.data();
+  // Stage the first ncrms CRMs, then gather them back in the new order
+  parallel_for( SimpleBounds<2>(nrest,ncrms) , YAKL_LAMBDA (int m, int icrm) {
+    tmp[m*ncrms+icrm] = dst[m*ncol+icrm];
+  });
+  parallel_for( SimpleBounds<2>(nrest,ncrms) , YAKL_LAMBDA (int m, int icrm) {
+    dst[m*ncol+icrm] = tmp[m*ncrms+perm(icrm)];
+  });
+}
+
+
+// Apply permute_crms to all the per-CRM arrays
+void permute_crm_arrays(int1d const &perm);
+
+
 void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p, real *crm_input_zmid_p, real *crm_input_zint_p, 
                             real *crm_input_pmid_p, real *crm_input_pint_p, real *crm_input_pdel_p, real *crm_input_ul_p, real *crm_input_vl_p, 
                             real *crm_input_tl_p, real *crm_input_qccl_p, real *crm_input_qiil_p, real *crm_input_ql_p, real *crm_input_tau00_p,
@@ -119,9 +150,7 @@ extern int  nstep                    ;
 extern int  ncycle                   ;
 extern int  icycle                   ;
 extern int  na, nb, nc               ;
-extern real at, bt, ct               ;
 extern real dtn                      ;
-extern real dtfactor                 ;
 extern int  rank                     ;
 extern int  ranknn                   ;
 extern int  rankss                   ;
@@ -353,9 +382,18 @@ extern real2d zi              ;
 extern real2d presi           ;
 extern real2d adz             ;
 extern real2d adzw            ;
-extern real1d dt3             ;
+extern real2d dt3             ;
 extern real1d dz              ;
 
+// Per-CRM subcycling (see subcycle.h)
+extern int1d  ncycle_crm      ;
+extern int1d  crm_perm        ;
+extern real1d dtn_crm         ;
+extern real1d dtfactor_crm    ;
+extern real1d at              ;
+extern real1d bt              ;
+extern real1d ct              ;
+
 extern real2d grdf_x          ;
 extern real2d grdf_y          ;
 extern real2d grdf_z          ;
@@ -11,6 +11,7 @@
 #include "share/util/scream_timing.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_fast_restart.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -891,18 +892,50 @@ void AtmosphereDriver::restart_model ()
 
   m_atm_logger->info("    [EAMxx] Restart filename: " + filename);
 
+  // Keep the file open until we are done. This way, the readers of each grid,
+  // as well as all the global attributes queries below, will not need to
+  // re-open the file (and re-inquire all its dims/vars) every time.
+  scorpio::register_file(filename,scorpio::Read);
+
+  std::vector<std::shared_ptr<const FieldManager>> restart_fms;
   for (auto& it : m_field_mgrs) {
     if (fvphyshack and it.second->get_grid()->name() == "Physics GLL") continue;
     if (not it.second->has_group("RESTART")) {
       // No field needs to be restarted on this grid.
       continue;
     }
-    const auto& restart_group = it.second->get_groups_info().at("RESTART");
-    std::vector<std::string> fnames;
-    for (const auto& fn : restart_group->m_fields_names) {
-      fnames.push_back(fn);
+    restart_fms.push_back(it.second);
+  }
+
+  // If the model restart was written with the fast_restart option, and the
+  // decomposition has not changed, we can read the fields from the per-rank
+  // binary files. If that fails (on any rank), use the restart nc file instead.
+  bool fast_restart_done = false;
+  const auto& io_params = m_atm_params.sublist("Scorpio");
+  if (io_params.isSublist("model_restart") and
+      io_params.sublist("model_restart").get("fast_restart",false)) {
+    fast_restart_done = read_fast_restart(filename,m_atm_comm,restart_fms);
+    if (fast_restart_done) {
+      m_atm_logger->info("    [EAMxx] Restart fields read from per-rank fast restart files.");
+      for (const auto& fm : restart_fms) {
+        for (const auto& fn : fm->get_groups_info().at("RESTART")->m_fields_names) {
+          fm->get_field(fn).get_header().get_tracking().update_time_stamp(m_current_ts);
+        }
+      }
+    } else {
+      m_atm_logger->warn("    [EAMxx] Could not use fast restart files. Falling back to reading restart file.");
+    }
+  }
+
+  if (not fast_restart_done) {
+    for (const auto& fm : restart_fms) {
+      const auto& restart_group = fm->get_groups_info().at("RESTART");
+      std::vector<std::string> fnames;
+      for (const auto& fn : restart_group->m_fields_names) {
+        fnames.push_back(fn);
+      }
+      read_fields_from_file (fnames,fm->get_grid(),filename,m_current_ts);
     }
-    read_fields_from_file (fnames,it.second->get_grid(),filename,m_current_ts);
   }
 
   // Restart the num steps counter in the atm time stamp
@@ -932,6 +965,8 @@ void AtmosphereDriver::restart_model ()
     }
   }
 
+  scorpio::release_file(filename);
+
   m_atm_logger->info("  [EAMxx] restart_model ... done!");
 }
 
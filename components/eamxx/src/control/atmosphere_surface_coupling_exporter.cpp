@@ -156,6 +156,9 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
 
   m_column_info_d = decltype(m_column_info_d) ("m_info", m_num_scream_exports);
   m_column_info_h = Kokkos::create_mirror_view(m_column_info_d);
+
+  m_cpl_to_scream_idx_d = decltype(m_cpl_to_scream_idx_d) ("cpl_to_scream_idx", m_num_cpl_exports);
+  m_cpl_to_scream_idx_h = Kokkos::create_mirror_view(m_cpl_to_scream_idx_d);
 }
 // =========================================================================================
 void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
@@ -197,6 +200,22 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   // Copy data to device for use in do_export()
   Kokkos::deep_copy(m_column_info_d, m_column_info_h);
 
+  // Build the inverse map cpl_indx->scream export index, so that do_export_to_cpl
+  // can fill every entry of the cpl buffer (exported or not) in one pass.
+  Kokkos::deep_copy(m_cpl_to_scream_idx_h, -1);
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    const int icpl = m_column_info_h(i).cpl_indx;
+    EKAT_REQUIRE_MSG (icpl>=0 && icpl<m_num_cpl_exports,
+        "Error! Invalid cpl index for export field " + m_export_field_names_vector[i] + ".\n"
+        "  - cpl index: " + std::to_string(icpl) + "\n"
+        "  - num cpl exports: " + std::to_string(m_num_cpl_exports) + "\n");
+    EKAT_REQUIRE_MSG (m_cpl_to_scream_idx_h(icpl)==-1,
+        "Error! Multiple scream exports map to the same cpl index.\n"
+        "  - cpl index: " + std::to_string(icpl) + "\n");
+    m_cpl_to_scream_idx_h(icpl) = i;
+  }
+  Kokkos::deep_copy(m_cpl_to_scream_idx_d, m_cpl_to_scream_idx_h);
+
   // Set the number of exports from eamxx or set to a constant, default type = FROM_MODEL
   using vos_type = std::vector<std::string>;
   using vor_type = std::vector<Real>;
@@ -295,6 +314,15 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   }
   // Copy host view back to device view
   Kokkos::deep_copy(m_export_source,m_export_source_h);
+
+  // Store constants in a device view, so that all constant exports can be set in one kernel
+  m_export_constants_d = view_1d<DefaultDevice,Real>("export_constants",m_num_scream_exports);
+  auto export_constants_h = Kokkos::create_mirror_view(m_export_constants_d);
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    const auto it = m_export_constants.find(m_export_field_names_vector[i]);
+    export_constants_h(i) = it==m_export_constants.end() ? 0 : it->second;
+  }
+  Kokkos::deep_copy(m_export_constants_d,export_constants_h);
   // Final sanity check
   EKAT_REQUIRE_MSG(m_num_scream_exports = m_num_from_file_exports+m_num_const_exports+m_num_from_model_exports,"Error! surface_coupling_exporter - Something went wrong set the type of export for all variables.");
   EKAT_REQUIRE_MSG(m_num_from_model_exports>=0,"Error! surface_coupling_exporter - The number of exports derived from EAMxx < 0, something must have gone wrong in assigning the types of exports for all variables.");
@@ -328,19 +356,33 @@ void SurfaceCouplingExporter::do_export(const double dt, const bool called_durin
 // =========================================================================================
 void SurfaceCouplingExporter::set_constant_exports()
 {
-  // Cycle through those fields that will be set to a constant value:
-  int num_set = 0; // Checker to make sure we got all the fields we wanted.
+  using policy_type = KT::RangePolicy;
+
+  // Checker to make sure we got all the fields we wanted.
+  int num_set = 0;
   for (int i=0; i<m_num_scream_exports; ++i) {
     if (m_export_source_h(i)==CONSTANT) {
-      std::string fname = m_export_field_names[i];
-      const auto field_view = m_helper_fields.at(fname).get_view<Real*>();
-      Kokkos::deep_copy(field_view,m_export_constants.at(fname));
-      num_set++;
+      ++num_set;
     }
   }
   // Gotta catch em all
   EKAT_REQUIRE_MSG(num_set==m_num_const_exports,"ERROR! SurfaceCouplingExporter::set_constant_exports() - Number of fields set to a constant (" + std::to_string(num_set) +") doesn't match the number recorded at initialization (" + std::to_string(m_num_const_exports) +").  Something went wrong.");
 
+  // Set all constant exports at once, rather than launching one deep_copy per field
+  const auto export_source    = m_export_source;
+  const auto export_constants = m_export_constants_d;
+  const auto col_info         = m_column_info_d;
+  const int  num_exports      = m_num_scream_exports;
+  const int  num_cols         = m_num_cols;
+  auto policy = policy_type(0,num_exports*num_cols);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& i) {
+    const int ifield = i / num_cols;
+    const int icol   = i % num_cols;
+    if (export_source(ifield)==CONSTANT) {
+      const auto& info = col_info(ifield);
+      info.data[icol*info.col_stride + info.col_offset] = export_constants(ifield);
+    }
+  });
 }
 // =========================================================================================
 void SurfaceCouplingExporter::set_from_file_exports(const int dt)
@@ -512,6 +554,14 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
       Sa_pslv(i) = PF::calculate_psl(T_int_bot, p_int_i(num_levs), phis(i));
     }
 
+    // Variables that are already surface vars in the ATM can just be copied directly.
+    if (export_source(idx_Faxa_swndr)==FROM_MODEL) { Faxa_swndr(i) = sfc_flux_dir_nir(i); }
+    if (export_source(idx_Faxa_swvdr)==FROM_MODEL) { Faxa_swvdr(i) = sfc_flux_dir_vis(i); }
+    if (export_source(idx_Faxa_swndf)==FROM_MODEL) { Faxa_swndf(i) = sfc_flux_dif_nir(i); }
+    if (export_source(idx_Faxa_swvdf)==FROM_MODEL) { Faxa_swvdf(i) = sfc_flux_dif_vis(i); }
+    if (export_source(idx_Faxa_swnet)==FROM_MODEL) { Faxa_swnet(i) = sfc_flux_sw_net(i);  }
+    if (export_source(idx_Faxa_lwdn )==FROM_MODEL) { Faxa_lwdn(i)  = sfc_flux_lw_dn(i);   }
+
     if (not called_during_initialization) {
       // Precipitation has units of kg/m2, and Faxa_rainl/snowl
       // need units mm/s. Here, 1000 converts m->mm, dt has units s, and
@@ -520,39 +570,38 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
       if (export_source(idx_Faxa_snowl)==FROM_MODEL) { Faxa_snowl(i) = precip_ice_surf_mass(i)/dt*(1000.0/PC::RHO_H2O); }
     }
   });
-  // Variables that are already surface vars in the ATM can just be copied directly.
-  if (m_export_source_h(idx_Faxa_swndr)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swndr, sfc_flux_dir_nir); }
-  if (m_export_source_h(idx_Faxa_swvdr)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swvdr, sfc_flux_dir_vis); }
-  if (m_export_source_h(idx_Faxa_swndf)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swndf, sfc_flux_dif_nir); }
-  if (m_export_source_h(idx_Faxa_swvdf)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swvdf, sfc_flux_dif_vis); }
-  if (m_export_source_h(idx_Faxa_swnet)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swnet, sfc_flux_sw_net); }
-  if (m_export_source_h(idx_Faxa_lwdn )==FROM_MODEL) { Kokkos::deep_copy(Faxa_lwdn,  sfc_flux_lw_dn); }
-
 }
 // =========================================================================================
 void SurfaceCouplingExporter::do_export_to_cpl(const bool called_during_initialization)
 {
   using policy_type = KT::RangePolicy;
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
+
   const auto cpl_exports_view_d = m_cpl_exports_view_d;
-  const int  num_exports        = m_num_scream_exports;
+  const auto cpl_to_scream_idx  = m_cpl_to_scream_idx_d;
+  const int  num_cpl_exports    = m_num_cpl_exports;
   const int  num_cols           = m_num_cols;
   const auto col_info           = m_column_info_d;
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
-  Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
 
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
+  // Export to cpl data. We loop over the whole cpl buffer, with the field index
+  // striding fastest (to match the buffer layout), so that every entry is written
+  // exactly once. Any field not exported by scream, or not exported during
+  // initialization, is set to 0.0
+  auto export_policy   = policy_type (0,num_cols*num_cpl_exports);
+  Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
+    const int icol = i / num_cpl_exports;
+    const int icpl = i % num_cpl_exports;
+    const int ifield = cpl_to_scream_idx(icpl);
+
+    Real val = 0;
+    if (ifield>=0) {
+      const auto& info = col_info(ifield);
+      // if this is during initialization, check whether or not the field should be exported
+      bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+      if (do_export) {
+        val = info.constant_multiple*info.data[icol*info.col_stride + info.col_offset];
+      }
     }
+    cpl_exports_view_d(icol,icpl) = val;
   });
 
   // Deep copy fields from device to cpl host array
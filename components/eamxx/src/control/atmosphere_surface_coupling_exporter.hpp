@@ -155,6 +155,14 @@ protected:
   view_1d<DefaultDevice, SurfaceCouplingColumnInfo> m_column_info_d;
   decltype(m_column_info_d)::HostMirror             m_column_info_h;
 
+  // Map from cpl field index to scream export index (-1 if the cpl field is not
+  // exported by scream). Allows to fill the whole cpl buffer in a single kernel.
+  view_1d<DefaultDevice, int>   m_cpl_to_scream_idx_d;
+  decltype(m_cpl_to_scream_idx_d)::HostMirror m_cpl_to_scream_idx_h;
+
+  // Constant value for each export (only meaningful for exports of type CONSTANT)
+  view_1d<DefaultDevice, Real>  m_export_constants_d;
+
 }; // class SurfaceCouplingExporter
 
 } // namespace scream
@@ -5,6 +5,7 @@
 
 #include "ekat/ekat_assert.hpp"
 #include "ekat/util/ekat_units.hpp"
+#include "ekat/util/ekat_math_utils.hpp"
 
 #include <array>
 
@@ -87,6 +88,9 @@ void SurfaceCouplingImporter::set_grids(const std::shared_ptr<const GridsManager
 
   m_column_info_d = decltype(m_column_info_d) ("m_info", m_num_scream_imports);
   m_column_info_h = Kokkos::create_mirror_view(m_column_info_d);
+
+  m_iop_col_vals_d = decltype(m_iop_col_vals_d) ("iop_col_vals", m_num_scream_imports);
+  m_iop_col_vals_h = Kokkos::create_mirror_view(m_iop_col_vals_d);
 }
 // =========================================================================================
 void SurfaceCouplingImporter::initialize_impl (const RunType /* run_type */)
@@ -187,19 +191,21 @@ void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_in
   static constexpr Real stebol = C::stebol;
 
   const auto& col_info_h = m_column_info_h;
-  const auto& col_info_d = m_column_info_d;
 
+  bool any_overwrite = false;
   for (int ifield=0; ifield<m_num_scream_imports; ++ifield) {
     const std::string fname = m_import_field_names[ifield];
     const auto& info_h = col_info_h(ifield);
 
+    // Store IOP surf data into col_val (NaN means this import is not overwritten)
+    Real& col_val = m_iop_col_vals_h(ifield);
+    col_val = std::nan("");
+
     // If we are in initialization and field should not be imported, skip
     if (called_during_initialization && not info_h.transfer_during_initialization) {
       continue;
     }
 
-    // Store IOP surf data into col_val
-    Real col_val(std::nan(""));
     if (fname == "surf_evap" && has_lhflx) {
       const auto f = m_iop->get_iop_field("lhflx");
       f.sync_to_host();
@@ -220,15 +226,29 @@ void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_in
       // If import field doesn't satisify above, skip
       continue;
     }
+    any_overwrite = true;
+  }
+
+  if (not any_overwrite) {
+    return;
+  }
 
-    // Overwrite iop imports with col_val for each column
-    auto policy = policy_type(0, m_num_cols);
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& icol) {
+  // Overwrite iop imports with col_val for each column, for all fields at once
+  Kokkos::deep_copy(m_iop_col_vals_d,m_iop_col_vals_h);
+  const auto col_info_d   = m_column_info_d;
+  const auto iop_col_vals = m_iop_col_vals_d;
+  const int  num_cols     = m_num_cols;
+  auto policy = policy_type(0, m_num_scream_imports*num_cols);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& i) {
+    const int ifield = i / num_cols;
+    const int icol   = i % num_cols;
+    const Real col_val = iop_col_vals(ifield);
+    if (not ekat::is_invalid(col_val)) {
       const auto& info_d = col_info_d(ifield);
       const auto offset = icol*info_d.col_stride + info_d.col_offset;
       info_d.data[offset] = col_val;
-    });
-  }
+    }
+  });
 }
 // =========================================================================================
 void SurfaceCouplingImporter::finalize_impl()
@@ -96,6 +96,11 @@ protected:
   view_1d<DefaultDevice, SurfaceCouplingColumnInfo> m_column_info_d;
   decltype(m_column_info_d)::HostMirror             m_column_info_h;
 
+  // Per-import column value used to overwrite imports in IOP cases (NaN means no overwrite).
+  // Stored in a view so that all overwrites are done in a single kernel.
+  view_1d<DefaultDevice, Real>           m_iop_col_vals_d;
+  decltype(m_iop_col_vals_d)::HostMirror m_iop_col_vals_h;
+
   // The grid is needed for property checks
   std::shared_ptr<const AbstractGrid> m_grid;
 }; // class SurfaceCouplingImporter
@@ -2,7 +2,6 @@
 #include "share/util/scream_universal_constants.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
-#include "ekat/util/ekat_upper_bound.hpp"
 #include "ekat/util/ekat_units.hpp"
 
 namespace scream
@@ -109,100 +108,26 @@ initialize_impl (const RunType /*run_type*/)
   for (const auto& [name, val] : src_atts) {
     dst_atts[name] = val;
   }
+
+  // The interpolation plan, from the src pressure to the single tgt pressure level
+  FieldLayout p_tgt_layout ({LEV},{1});
+  FieldIdentifier p_tgt_fid ("p_tgt",p_tgt_layout,ekat::units::Pa,gname);
+  Field p_tgt (p_tgt_fid);
+  p_tgt.allocate_view();
+  p_tgt.deep_copy(m_pressure_level);
+
+  m_interp_plan = std::make_shared<VerticalInterpPlan>(get_field_in(m_pressure_name),p_tgt);
+  m_interp_plan->add_field(f,m_diagnostic_output,m_mask_val);
+  m_interp_plan->add_mask(diag_mask);
 }
 
 // =========================================================================================
 void FieldAtPressureLevel::compute_diagnostic_impl()
 {
-  using KT = KokkosTypes<DefaultDevice>;
-  using MemberType = typename KT::MemberType;
-
-  //This is 2D source pressure
-  const Field& p_src = get_field_in(m_pressure_name);
-  const auto p_src_v = p_src.get_view<const Real**>();
-  const Field& f = get_field_in(m_field_name);
-
-  // The setup for interpolation varies depending on the rank of the input field:
-  const int rank = f.rank();
-
-  const auto& pl = p_src.get_header().get_identifier().get_layout();
-  const int ncols = pl.dim(0);
-  const int nlevs = pl.dim(1);
-
-  auto p_tgt = m_pressure_level;
-  auto mval = m_mask_val;
-  if (rank==2) {
-    auto policy = KT::RangePolicy(0,ncols);
-    auto diag = m_diagnostic_output.get_view<Real*>();
-    auto mask = m_diagnostic_output.get_header().get_extra_data<Field>("mask_data").get_view<Real*>();
-    auto f_v  = f.get_view<const Real**>();
-    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int icol) {
-      auto x1 = ekat::subview(p_src_v,icol);
-      auto y1 = ekat::subview(f_v,icol);
-      auto beg = x1.data();
-      auto end = beg + nlevs;
-      auto last = beg + (nlevs-1);
-      if (p_tgt<*beg or p_tgt>*last) {
-        diag(icol) = mval;
-        mask(icol) = 0;
-      } else {
-        auto ub = ekat::upper_bound(beg,end,p_tgt);     
-        auto k1 = ub - beg;
-        if (k1==0) {
-          // Corner case: p_tgt==y1(0)
-          diag(icol) = y1(icol);
-        } else if (k1==nlevs) {
-          // Corner case: p_tgt==y1(nlevs-1)
-          diag(icol) = y1(nlevs-1);
-        } else {
-          // General case: interpolate between k1 and k1-1
-          diag(icol) = y1(k1-1) + (y1(k1)-y1(k1-1))/(x1(k1) - x1(k1-1)) * (p_tgt-x1(k1-1));
-        }
-        mask(icol) = 1;
-      }
-    });
-  } else if (rank==3) {
-    const int ndims = f.get_header().get_identifier().get_layout().get_vector_dim();
-    auto policy = KT::TeamPolicy(ncols,ndims);
-    auto diag = m_diagnostic_output.get_view<Real**>();
-    auto mask = m_diagnostic_output.get_header().get_extra_data<Field>("mask_data").get_view<Real*>();
-    auto f_v  = f.get_view<const Real***>();
-    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
-      int icol = team.league_rank();
-      auto x1 = ekat::subview(p_src_v,icol);
-      auto beg = x1.data();
-      auto end = beg + nlevs;
-      auto last = beg + (nlevs-1);
-      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims),[&](const int idim) {
-        if (p_tgt<*beg or p_tgt>*last) {
-          diag(icol,idim) = mval;
-          Kokkos::single(Kokkos::PerTeam(team),[&]{
-            mask(icol) = 0;
-          });
-        } else {
-          auto y1 = ekat::subview(f_v,icol,idim);
-          auto ub = ekat::upper_bound(beg,end,p_tgt);     
-          auto k1 = ub - beg;
-          if (k1==0) {
-            // Corner case: p_tgt==y1(0)
-            diag(icol,idim) = y1(icol);
-          } else if (k1==nlevs) {
-            // Corner case: p_tgt==y1(nlevs-1)
-            diag(icol,idim) = y1(nlevs-1);
-          } else {
-            // General case: interpolate between k1 and k1-1
-            diag(icol,idim) = y1(k1-1) + (y1(k1)-y1(k1-1))/(x1(k1) - x1(k1-1)) * (p_tgt-x1(k1-1));
-          }
-          Kokkos::single(Kokkos::PerTeam(team),[&]{
-            mask(icol) = 1;
-          });
-        }
-      });
-    });
-  } else {
-    EKAT_ERROR_MSG("Error! field at pressure level only supports fields ranks 2 and 3 \n");
-  }
-
+  // Target levels outside the src pressure bounds are set to m_mask_val,
+  // and the corresponding entry of the mask is set to 0
+  m_interp_plan->setup();
+  m_interp_plan->apply();
 }
 
 } //namespace scream
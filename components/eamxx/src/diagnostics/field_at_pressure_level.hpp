@@ -2,6 +2,7 @@
 #define EAMXX_FIELD_AT_PRESSURE_LEVEL_HPP
 
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/util/eamxx_vertical_interp_plan.hpp"
 
 #include <ekat/ekat_pack.hpp>
 
@@ -26,11 +27,7 @@ public:
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
 protected:
-#ifdef KOKKOS_ENABLE_CUDA
-public:
-#endif
   void compute_diagnostic_impl ();
-protected:
   void initialize_impl (const RunType /*run_type*/);
 
   std::string         m_pressure_name;
@@ -41,6 +38,8 @@ protected:
   int                 m_num_levs;
   Real                m_mask_val;
 
+  std::shared_ptr<VerticalInterpPlan> m_interp_plan;
+
 }; // class FieldAtPressureLevel
 
 } //namespace scream
@@ -31,6 +31,8 @@
 #include "physics/share/physics_constants.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
 #include "share/util/scream_column_ops.hpp"
+#include "share/util/eamxx_column_cost.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
 #include "share/property_checks/field_lower_bound_check.hpp"
 
 // Ekat includes
@@ -69,6 +71,9 @@ HommeDynamics::HommeDynamics (const ekat::Comm& comm, const ekat::ParameterList&
   m_bfb_hash_nstep = 0;
   if (params.isParameter("BfbHash"))
     m_bfb_hash_nstep = std::max(0, params.get<int>("BfbHash"));
+
+  m_partition_weights_file = params.get<std::string>("partition_weights_output_file","");
+  m_column_cost_nsteps = 0;
 }
 
 HommeDynamics::~HommeDynamics ()
@@ -87,6 +92,30 @@ void HommeDynamics::set_grids (const std::shared_ptr<const GridsManager> grids_m
 
   fv_phys_set_grids();
 
+  if (m_partition_weights_file!="") {
+    // Homme only knows the elements of the columns of the non-rebalanced physics grid,
+    // whose name is "Physics <type>" (a rebalanced grid name also has the rebalance type)
+    const auto& pg_name = m_phys_grid->name();
+    EKAT_REQUIRE_MSG (pg_name.find(' ',std::string("Physics ").size())==std::string::npos,
+        "Error! Partition weights output is not supported with a rebalanced physics grid.\n"
+        "  - physics grid: " + pg_name + "\n"
+        "  - partition weights output file: " + m_partition_weights_file + "\n");
+
+    // Physics processes add their per-column cost to this accumulator
+    const int ncols = m_phys_grid->get_num_local_dofs();
+    enable_column_cost(m_phys_grid->name(),ncols);
+
+    // Store the col->elem map now, since Homme's elements are gone at finalization
+    const int pg_type = fv_phys_active() ? m_phys_grid_pgN : 0;
+    EKAT_REQUIRE_MSG (get_num_local_columns_f90(pg_type)==ncols,
+        "Error! Physics grid and Homme disagree on the number of local columns.\n"
+        "  - physics grid: " + std::to_string(ncols) + "\n"
+        "  - homme: " + std::to_string(get_num_local_columns_f90(pg_type)) + "\n");
+    m_phys_col2elem.resize(ncols);
+    int* col2elem_ptr = m_phys_col2elem.data();
+    get_phys_grid_col_elems_f90(pg_type,col2elem_ptr);
+  }
+
   // Init prim structures
   // TODO: they should not be inited yet; should we error out if they are?
   //       I'm gonna say 'no', for now, cause it might be a pb with unit tests.
@@ -519,6 +548,10 @@ void HommeDynamics::run_impl (const double dt)
     // Post process Homme's output, to produce what the rest of Atm expects
     Kokkos::fence();
     homme_post_process (dt);
+
+    if (m_partition_weights_file!="") {
+      ++m_column_cost_nsteps;
+    }
   } catch (std::exception& e) {
     EKAT_ERROR_MSG(e.what());
   } catch (...) {
@@ -528,6 +561,10 @@ void HommeDynamics::run_impl (const double dt)
 
 void HommeDynamics::finalize_impl (/* what inputs? */)
 {
+  if (m_partition_weights_file!="") {
+    write_partition_weights();
+  }
+
   prim_finalize_f90();
 
   // This class is done needing Homme's context, so remove myself as customer
@@ -535,6 +572,34 @@ void HommeDynamics::finalize_impl (/* what inputs? */)
 }
 
 
+void HommeDynamics::write_partition_weights () const
+{
+  using gid_type = AbstractGrid::gid_type;
+
+  const int nlelems = m_dyn_grid->get_partitioned_dim_local_size();
+  const int ngelems = m_dyn_grid->get_partitioned_dim_global_size();
+  const auto cost = get_column_cost(m_phys_grid->name());
+  const auto weights = compute_elem_weights(cost,m_column_cost_nsteps,m_phys_col2elem,nlelems);
+
+  // Elements gids are 1-based
+  auto elgids_h = m_dyn_grid->get_partitioned_dim_gids().get_view<const gid_type*,Host>();
+  std::vector<scorpio::offset_t> offsets(nlelems);
+  for (int ie=0; ie<nlelems; ++ie) {
+    offsets[ie] = elgids_h(ie) - 1;
+  }
+
+  const auto& filename = m_partition_weights_file;
+  scorpio::register_file(filename,scorpio::FileMode::Write);
+  scorpio::define_dim(filename,"elem",ngelems);
+  scorpio::define_var(filename,"elem_weight",{"elem"},"real");
+  scorpio::set_dim_decomp(filename,"elem",offsets);
+  scorpio::enddef(filename);
+  scorpio::write_var(filename,"elem_weight",weights.data());
+  scorpio::release_file(filename);
+
+  m_atm_logger->info("[EAMxx::homme] Element partition weights written to " + filename);
+}
+
 void HommeDynamics::set_computed_group_impl (const FieldGroup& group)
 {
   const auto& c = Homme::Context::singleton();
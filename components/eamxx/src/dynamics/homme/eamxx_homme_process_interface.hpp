@@ -112,6 +112,10 @@ protected:
   // IOP functions
   void apply_iop_forcing(const Real dt);
 
+  // Turn the physics column cost accumulated during the run into element
+  // weights, and write them to file, to be used to partition the next run.
+  void write_partition_weights () const;
+
   KOKKOS_FUNCTION
   static void advance_iop_subsidence(const KT::MemberType& team,
                                      const int nlevs,
@@ -202,6 +206,12 @@ protected:
                     // if set to 0, no rayleigh friction is applied
 
   int m_bfb_hash_nstep;
+
+  // If not empty, track the physics column cost, and write element weights
+  // to this file at finalization
+  std::string       m_partition_weights_file;
+  std::vector<int>  m_phys_col2elem;
+  int               m_column_cost_nsteps;
 };
 
 } // namespace scream
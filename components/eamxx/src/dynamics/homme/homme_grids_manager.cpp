@@ -12,6 +12,7 @@
 #endif
 
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
 #include "share/grid/se_grid.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/grid/remap/inverse_remapper.hpp"
@@ -100,6 +101,13 @@ build_grids ()
     m_pg_codes["GLL"]["None"],  // We always need this to read/write dyn grid stuff
     m_pg_codes[pg_type][pg_rebalance]
   };
+  // If requested, partition the elements using weights (e.g., computed from the
+  // physics column cost of a previous run), rather than equal weights
+  const auto& weights_file = m_params.get<std::string>("partition_weights_file","NONE");
+  if (weights_file!="NONE") {
+    set_partition_weights(weights_file);
+  }
+
   // In case the two pg codes are the same...
   auto it = std::unique(pg_codes.begin(),pg_codes.end());
   const int* codes_ptr = pg_codes.data();
@@ -133,6 +141,31 @@ build_grids ()
   cleanup_grid_init_data_f90 ();
 }
 
+void HommeGridsManager::
+set_partition_weights (const std::string& filename)
+{
+  // The file is small (one real per element), so each rank reads all of it
+  scorpio::register_file(filename,scorpio::FileMode::Read);
+  EKAT_REQUIRE_MSG (scorpio::has_var(filename,"elem_weight"),
+      "Error! Partition weights file does not contain the 'elem_weight' variable.\n"
+      "  - file name: " + filename + "\n");
+  const int nelem = scorpio::get_dimlen(filename,"elem");
+  EKAT_REQUIRE_MSG (nelem>=m_comm.size(),
+      "Error! Partition weights file has fewer elements than MPI ranks.\n"
+      "  - file name   : " + filename + "\n"
+      "  - num elems   : " + std::to_string(nelem) + "\n"
+      "  - num MPI ranks: " + std::to_string(m_comm.size()) + "\n");
+
+  // The weights are stored as Real, but Homme takes them as double
+  scorpio::change_var_dtype(filename,"elem_weight","double");
+  std::vector<double> weights(nelem);
+  scorpio::read_var(filename,"elem_weight",weights.data());
+  scorpio::release_file(filename);
+
+  const double* weights_ptr = weights.data();
+  set_partition_weights_f90 (weights_ptr,nelem);
+}
+
 void HommeGridsManager::build_dynamics_grid () {
   const std::string name = "Dynamics";
   if (has_grid(name)) {
@@ -39,6 +39,9 @@ protected:
 
   void build_pg_codes ();
 
+  // Read element weights from file, and pass them to Homme, to be used for the partition
+  void set_partition_weights (const std::string& filename);
+
   // Read vertical coordinates and set them in hommexx's structures
   void initialize_vertical_coordinates (const nonconstgrid_ptr_type& dyn_grid);
 
@@ -38,6 +38,7 @@ bool is_hommexx_functors_inited_f90 ();
 // Generic setup
 void init_parallel_f90 (const int& f_comm);
 void init_params_f90 (const char*& fname);
+void set_partition_weights_f90 (const double*& weights, const int num_elems);
 void init_grids_f90 (const int*& pg_types, const int num_pg_types);
 void cleanup_grid_init_data_f90 ();
 void finalize_geometry_f90 ();
@@ -70,6 +71,7 @@ void get_dyn_grid_data_f90 (AbstractGrid::gid_type* const& dg_gids,
 void get_phys_grid_data_f90 (const int& pg_type,
                              AbstractGrid::gid_type* const& gids,
                              double* const& lat, double* const& lon, double* const& area);
+void get_phys_grid_col_elems_f90 (const int& pg_type, int* const& elems);
 int get_homme_nsplit_f90 (const int& atm_dt);
 double get_dx_short_f90 (const int elem_idx);
 
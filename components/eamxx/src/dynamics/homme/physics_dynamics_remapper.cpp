@@ -13,7 +13,6 @@
 #include "share/grid/se_grid.hpp"
 #include "share/util/scream_utils.hpp"
 
-#include "ekat/ekat_pack_utils.hpp"
 #include "ekat/ekat_assert.hpp"
 
 namespace {
@@ -36,6 +35,31 @@ getHommeView(const scream::Field& f) {
   }
 }
 
+// Get data pointer, strides, and extents of the view of a field
+template<typename DataType>
+void get_view_info (const scream::Field& f, const scream::Real*& data, int* strides, int* extents) {
+  auto v = f.template get_view<DataType>();
+  const int rank = f.get_header().get_identifier().get_layout().rank();
+  data = v.data();
+  for (int r=0; r<rank; ++r) {
+    strides[r] = v.stride(r);
+    extents[r] = v.extent(r);
+  }
+}
+
+void get_view_info (const scream::Field& f, const scream::Real*& data, int* strides, int* extents) {
+  using scream::Real;
+  switch (f.get_header().get_identifier().get_layout().rank()) {
+    case 1: get_view_info<const Real*    >(f,data,strides,extents); break;
+    case 2: get_view_info<const Real**   >(f,data,strides,extents); break;
+    case 3: get_view_info<const Real***  >(f,data,strides,extents); break;
+    case 4: get_view_info<const Real**** >(f,data,strides,extents); break;
+    case 5: get_view_info<const Real*****>(f,data,strides,extents); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unexpected field rank.\n");
+  }
+}
+
 } // anonymous namespace
 
 namespace scream
@@ -53,6 +77,7 @@ PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
   m_phys_grid = phys_grid;
 
   m_num_phys_cols = phys_grid->get_num_local_dofs();
+  m_num_dyn_pts   = dyn_grid->get_num_local_dofs();
   m_lid2elgp      = m_dyn_grid->get_lid_to_idx_map().get_view<const int**>();
 
   // For each phys dofs, we find a corresponding dof in the dyn grid.
@@ -192,57 +217,9 @@ do_registration_ends ()
 void PhysicsDynamicsRemapper::
 initialize_device_variables()
 {
-  m_layout              = decltype(m_layout)              ("layout", this->m_num_fields);
-  m_pack_alloc_property = decltype(m_pack_alloc_property) ("pack_alloc_property", this->m_num_fields);
-  m_num_levels          = decltype(m_num_levels)          ("num_physical_levels", this->m_num_fields);
-
-  for (auto which : {'P','D'}) {
-    auto& repo   = which=='P' ? m_phys_repo : m_dyn_repo;
-    auto& fields = which=='P' ? m_phys_fields: m_dyn_fields;
-
-    repo.views  = ViewsRepo::views_t ("views", this->m_num_fields);
-    repo.cviews = ViewsRepo::cviews_t("cviews",this->m_num_fields);
-
-    repo.h_views  = Kokkos::create_mirror_view(repo.views);
-    repo.h_cviews = Kokkos::create_mirror_view(repo.cviews);
-
-    auto get_view = [&] (const int i, const Field& f) {
-      const auto rank = f.get_header().get_identifier().get_layout().rank();
-      switch (rank) {
-        case 1: repo.h_cviews[i].v1d = f.get_view<const Real*>();      break;
-        case 2: repo.h_cviews[i].v2d = f.get_view<const Real**>();     break;
-        case 3: repo.h_cviews[i].v3d = f.get_view<const Real***>();    break;
-        case 4: repo.h_cviews[i].v4d = f.get_view<const Real****>();   break;
-        case 5: repo.h_cviews[i].v5d = f.get_view<const Real*****>();  break;
-      }
-      if (not f.is_read_only()) {
-        switch (rank) {
-          case 1: repo.h_views[i].v1d = f.get_view<Real*>();      break;
-          case 2: repo.h_views[i].v2d = f.get_view<Real**>();     break;
-          case 3: repo.h_views[i].v3d = f.get_view<Real***>();    break;
-          case 4: repo.h_views[i].v4d = f.get_view<Real****>();   break;
-          case 5: repo.h_views[i].v5d = f.get_view<Real*****>();  break;
-        }
-      }
-    };
-    for (int i=0; i<this->m_num_fields; ++i) {
-      get_view(i,fields[i]);
-    }
-    Kokkos::deep_copy(repo.views,  repo.h_views);
-    Kokkos::deep_copy(repo.cviews, repo.h_cviews);
-  }
-
-  auto h_layout              = Kokkos::create_mirror_view(m_layout);
-  auto h_pack_alloc_property = Kokkos::create_mirror_view(m_pack_alloc_property);
-  auto h_num_levels          = Kokkos::create_mirror_view(m_num_levels);
-
-  // Some info that is the same for both dyn and phys
   for (int i=0; i<this->m_num_fields; ++i) {
-    const auto& phys = m_phys_fields[i];
-    const auto& dyn  = m_dyn_fields[i];
-
-    const auto& ph = phys.get_header();
-    const auto& dh = dyn.get_header();
+    const auto& ph = m_phys_fields[i].get_header();
+    const auto& dh = m_dyn_fields[i].get_header();
 
     // A dynamic subfield will need some special treatment at runtime
     // Namely, we'll need to re-extract the view every time,
@@ -257,32 +234,60 @@ initialize_device_variables()
           "Error! We do not support remapping of subfields of other subfields.\n");
       m_subfield_info_dyn[i] = dh.get_alloc_properties().get_subview_info();
     }
+  }
+
+  create_slices();
+}
+
+void PhysicsDynamicsRemapper::
+create_slices ()
+{
+  int num_slices = 0;
+  for (int i=0; i<this->m_num_fields; ++i) {
+    const auto& pl = m_phys_fields[i].get_header().get_identifier().get_layout();
+    const auto lt = pl.type();
+    num_slices += (lt==LayoutType::Vector2D || lt==LayoutType::Vector3D) ? pl.dim(1) : 1;
+  }
+  if (static_cast<int>(m_slices.extent(0))!=num_slices) {
+    m_slices   = decltype(m_slices)("slices",num_slices);
+    m_slices_h = Kokkos::create_mirror_view(m_slices);
+  }
 
-    const auto& pl = ph.get_identifier().get_layout();
-
-    auto lt = pl.type();
-    h_layout(i) = etoi(lt);
-
-    const bool is_field_3d = lt==LayoutType::Scalar3D || lt==LayoutType::Vector3D;
-    h_num_levels(i) = is_field_3d ? pl.dims().back() : -1;
-
-    const auto& pap = ph.get_alloc_properties();
-    const auto& dap = dh.get_alloc_properties();
-    if (is_field_3d &&
-        pap.template is_compatible<pack_type>() &&
-        dap.template is_compatible<pack_type>()) {
-      h_pack_alloc_property(i) = AllocPropType::PackAlloc;
-    } else if (is_field_3d &&
-               pap.template is_compatible<small_pack_type>() &&
-               dap.template is_compatible<small_pack_type>()) {
-      h_pack_alloc_property(i) = AllocPropType::SmallPackAlloc;
-    } else {
-      h_pack_alloc_property(i) = AllocPropType::RealAlloc;
+  m_max_dyn_levs = 1;
+  int islice = 0;
+  for (int i=0; i<this->m_num_fields; ++i) {
+    const auto& pl = m_phys_fields[i].get_header().get_identifier().get_layout();
+    const auto lt = pl.type();
+    const bool is_vec = lt==LayoutType::Vector2D || lt==LayoutType::Vector3D;
+    const bool is_3d  = lt==LayoutType::Scalar3D || lt==LayoutType::Vector3D;
+
+    // The phys view is (col,[dim],[lev]), while the dyn view is (elem,[dim],gp,gp,[lev])
+    const Real* phys;
+    const Real* dyn;
+    int phys_strides[3], phys_extents[3];
+    int dyn_strides[5], dyn_extents[5];
+    get_view_info(m_phys_fields[i],phys,phys_strides,phys_extents);
+    get_view_info(m_dyn_fields[i],dyn,dyn_strides,dyn_extents);
+    const int dyn_rank = m_dyn_fields[i].get_header().get_identifier().get_layout().rank();
+    const int gp_pos = is_vec ? 2 : 1;
+
+    const int num_comps = is_vec ? pl.dim(1) : 1;
+    for (int icomp=0; icomp<num_comps; ++icomp, ++islice) {
+      auto& slice = m_slices_h(islice);
+      // Fields may be read-only, but we only write to the tgt fields of each remap direction
+      slice.phys = const_cast<Real*>(phys) + (is_vec ? icomp*phys_strides[1] : 0);
+      slice.dyn  = const_cast<Real*>(dyn)  + (is_vec ? icomp*dyn_strides[1]  : 0);
+      slice.phys_col_stride  = phys_strides[0];
+      slice.dyn_elem_stride  = dyn_strides[0];
+      slice.dyn_gp_stride[0] = dyn_strides[gp_pos];
+      slice.dyn_gp_stride[1] = dyn_strides[gp_pos+1];
+      slice.num_levs     = is_3d ? pl.dims().back() : 1;
+      slice.num_dyn_levs = is_3d ? dyn_extents[dyn_rank-1] : 1;
+
+      m_max_dyn_levs = std::max(m_max_dyn_levs,slice.num_dyn_levs);
     }
   }
-  Kokkos::deep_copy(m_layout,              h_layout             );
-  Kokkos::deep_copy(m_pack_alloc_property, h_pack_alloc_property);
-  Kokkos::deep_copy(m_num_levels,          h_num_levels         );
+  Kokkos::deep_copy(m_slices,m_slices_h);
 }
 
 bool PhysicsDynamicsRemapper::
@@ -301,96 +306,11 @@ subfields_info_has_changed (const std::map<int,SubviewInfo>& subfield_info,
 }
 
 void PhysicsDynamicsRemapper::
-update_subfields_views (const std::map<int,SubviewInfo>& subfield_info,
-                        const ViewsRepo& repo,
-                        const std::vector<field_type>& fields) const
+update_subfields_info (std::map<int,SubviewInfo>& subfield_info,
+                       const std::vector<field_type>& fields) const
 {
-  auto get_view = [&] (const int i, const Field& f) {
-    const auto rank = f.get_header().get_identifier().get_layout().rank();
-    switch (rank) {
-      case 1: repo.h_cviews[i].v1d = f.get_view<const Real*>();      break;
-      case 2: repo.h_cviews[i].v2d = f.get_view<const Real**>();     break;
-      case 3: repo.h_cviews[i].v3d = f.get_view<const Real***>();    break;
-      case 4: repo.h_cviews[i].v4d = f.get_view<const Real****>();   break;
-      case 5: repo.h_cviews[i].v5d = f.get_view<const Real*****>();  break;
-    }
-    if (not f.is_read_only()) {
-      switch (rank) {
-        case 1: repo.h_views[i].v1d = f.get_view<Real*>();      break;
-        case 2: repo.h_views[i].v2d = f.get_view<Real**>();     break;
-        case 3: repo.h_views[i].v3d = f.get_view<Real***>();    break;
-        case 4: repo.h_views[i].v4d = f.get_view<Real****>();   break;
-        case 5: repo.h_views[i].v5d = f.get_view<Real*****>();  break;
-      }
-    }
-  };
-
-  for (const auto& it : subfield_info) {
-    const auto& f = fields[it.first];
-    if ( not(it.second==f.get_header().get_alloc_properties().get_subview_info()) ){
-      get_view(it.first,fields[it.first]);
-    }
-  }
-  Kokkos::deep_copy(repo.views,  repo.h_views);
-  Kokkos::deep_copy(repo.cviews, repo.h_cviews);
-}
-
-template <typename ScalarT, typename MT>
-KOKKOS_FUNCTION
-void PhysicsDynamicsRemapper::
-set_dyn_to_zero(const MT& team) const
-{
-  const int i = team.league_rank();
-
-  switch (m_layout(i)) {
-    case etoi(LayoutType::Scalar2D):
-    {
-      auto v = m_dyn_repo.views[i].v3d;
-      int dim1 = v.extent(1);
-      int dim2 = v.extent(2);
-      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, v.size()), [&](const int& k) {
-        int k0   = (k / dim2) / dim1;
-        int k1   = (k / dim2) % dim1;
-        int k2   =  k % dim2;
-        v(k0, k1, k2) = 0;
-      });
-      break;
-    }
-    case etoi(LayoutType::Vector2D): // Fallthrough
-    case etoi(LayoutType::Scalar3D):
-    {
-      auto v = m_dyn_repo.views[i].v4d;
-      int dim1 = v.extent(1);
-      int dim2 = v.extent(2);
-      int dim3 = v.extent(3);
-      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, v.size()), [&](const int& k) {
-        int k0   = ((k / dim3) / dim2) / dim1;
-        int k1   = ((k / dim3) / dim2) % dim1;
-        int k2   =  (k / dim3) % dim2;
-        int k3   =   k % dim3;
-        v(k0, k1, k2, k3) = 0;
-      });
-      break;
-    }
-    case etoi(LayoutType::Vector3D):
-    {
-      auto v = m_dyn_repo.views[i].v5d;
-      int dim1 = v.extent(1);
-      int dim2 = v.extent(2);
-      int dim3 = v.extent(3);
-      int dim4 = v.extent(4);
-      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, v.size()), [&](const int& k) {
-        int k0   = (((k / dim4) / dim3) / dim2) / dim1;
-        int k1   = (((k / dim4) / dim3) / dim2) % dim1;
-        int k2   =  ((k / dim4) / dim3) % dim2;
-        int k3   =   (k / dim4) % dim3;
-        int k4   =    k % dim4;
-        v(k0, k1, k2, k3, k4) = 0;
-      });
-      break;
-    }
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
+  for (auto& it : subfield_info) {
+    it.second = fields[it.first].get_header().get_alloc_properties().get_subview_info();
   }
 }
 
@@ -408,60 +328,57 @@ do_remap_fwd()
       "       Note: see field.hpp and field_alloc_prop.hpp for an explanation\n"
       "       of what a subfield and subview info).\n");
 
-  // Check if we need to update the views for subfields on phys grid
-  update_subfields_views(m_subfield_info_phys,m_phys_repo,m_phys_fields);
+  // Check if we need to update the slices for subfields on phys grid
+  if (subfields_info_has_changed(m_subfield_info_phys,m_phys_fields)) {
+    update_subfields_info(m_subfield_info_phys,m_phys_fields);
+    create_slices();
+  }
 
   using TeamPolicy = typename KT::TeamTagPolicy<RemapFwdTag>;
 
+  // TeamPolicy over all (slice,elem) pairs, with each team handling all
+  // the gp/lev entries of one element
+  const int num_elems = m_num_dyn_pts / (HOMMEXX_NP*HOMMEXX_NP);
+  const int league_size = m_slices.extent(0)*num_elems;
   const auto concurrency = KT::ExeSpace().concurrency();
-#ifdef KOKKOS_ENABLE_CUDA
-#ifdef KOKKOS_ENABLE_DEBUG
-  const int team_size = std::min(256, std::min(128*m_num_phys_cols,32*(concurrency/this->m_num_fields+31)/32));
+#ifdef EAMXX_ENABLE_GPU
+  const int team_size = std::min(256,32*((HOMMEXX_NP*HOMMEXX_NP*m_max_dyn_levs+31)/32));
 #else
-  const int team_size = std::min(1024, std::min(128*m_num_phys_cols,32*(concurrency/this->m_num_fields+31)/32));
-#endif
+  const int team_size = (concurrency<league_size ? 1 : concurrency/league_size);
 #endif
 
-#ifdef KOKKOS_ENABLE_HIP
-  const int team_size = std::min(256, std::min(128*m_num_phys_cols,32*(concurrency/this->m_num_fields+31)/32));
-#endif
-
-//should exclude above cases of CUDA and HIP
-#ifndef EAMXX_ENABLE_GPU
-  const int team_size = (concurrency<this->m_num_fields ? 1 : concurrency/this->m_num_fields);
-#endif
-
-
-  // TeamPolicy over this->m_num_fields
-  const TeamPolicy policy(this->m_num_fields,team_size);
+  const TeamPolicy policy(league_size,team_size);
   Kokkos::parallel_for(policy, *this);
-  Kokkos::fence();
 
-  // Exchange element halo
+  // Exchange element halo. No need to fence first, since the BEX
+  // packing kernels run on the same execution space instance.
   m_be->exchange();
 }
 
 void PhysicsDynamicsRemapper::
 do_remap_bwd()
 {
-  // Check if we need to update the views for subfields
-  update_subfields_views(m_subfield_info_dyn,m_dyn_repo,m_dyn_fields);
-  update_subfields_views(m_subfield_info_phys,m_phys_repo,m_phys_fields);
+  // Check if we need to update the slices for subfields
+  if (subfields_info_has_changed(m_subfield_info_dyn,m_dyn_fields) ||
+      subfields_info_has_changed(m_subfield_info_phys,m_phys_fields)) {
+    update_subfields_info(m_subfield_info_dyn,m_dyn_fields);
+    update_subfields_info(m_subfield_info_phys,m_phys_fields);
+    create_slices();
+  }
 
   using TeamPolicy = typename KT::TeamTagPolicy<RemapBwdTag>;
 
+  // TeamPolicy over all (slice,col) pairs. Unlike do_remap_fwd, here we
+  // do not need to touch all dyn points, and can work on phys columns
+  const int league_size = m_slices.extent(0)*m_num_phys_cols;
   const auto concurrency = KT::ExeSpace().concurrency();
-#ifdef KOKKOS_ENABLE_CUDA
-  const int num_levs  = m_phys_grid->get_num_vertical_levels();
-  const int team_size = std::min(128,32*(int)ceil(((Real)num_levs)/32));
+#ifdef EAMXX_ENABLE_GPU
+  const int team_size = std::min(128,32*((m_max_dyn_levs+31)/32));
 #else
-  const int team_size = (concurrency<this->m_num_fields*m_num_phys_cols ? 1 : concurrency/(this->m_num_fields*m_num_phys_cols));
+  const int team_size = (concurrency<league_size ? 1 : concurrency/league_size);
 #endif
 
-  // TeamPolicy over m_num_phys_cols*this->m_num_fields. Unlike do_remap_fwd,
-  // here we do not require setting dyn=0, allowing us to extend
-  // the TeamPolicy
-  const TeamPolicy policy(this->m_num_fields*m_num_phys_cols,team_size);
+  const TeamPolicy policy(league_size,team_size);
   Kokkos::parallel_for(policy, *this);
   Kokkos::fence();
 }
@@ -557,184 +474,6 @@ setup_boundary_exchange () {
   m_be->registration_completed();
 }
 
-template <typename MT>
-KOKKOS_FUNCTION
-void PhysicsDynamicsRemapper::
-local_remap_fwd_2d (const MT& team) const
-{
-  const int i = team.league_rank();
-
-  switch (m_layout(i)) {
-    case etoi(LayoutType::Scalar2D):
-    {
-      auto phys = m_phys_repo.cviews[i].v1d;
-      auto dyn  = m_dyn_repo.views[i].v3d;
-
-      const auto tr = Kokkos::TeamVectorRange(team, m_num_phys_cols);
-      const auto f = [&] (const int icol) {
-        const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-        dyn(elgp[0],elgp[1],elgp[2]) = phys(icol);
-      };
-      Kokkos::parallel_for(tr, f);
-      break;
-    }
-    case etoi(LayoutType::Vector2D):
-    {
-      auto phys = m_phys_repo.cviews[i].v2d;
-      auto dyn  = m_dyn_repo.views[i].v4d;
-
-      const int vec_dim = phys.extent(1);
-      const auto tr = Kokkos::TeamVectorRange(team, m_num_phys_cols*vec_dim);
-      const auto f = [&] (const int idx) {
-        const int icol = idx / vec_dim;
-        const int idim = idx % vec_dim;
-
-        const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-        dyn(elgp[0],idim,elgp[1],elgp[2]) = phys(icol,idim);
-      };
-      Kokkos::parallel_for(tr, f);
-      break;
-    }
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
-  }
-}
-
-template <typename ScalarT, typename MT>
-KOKKOS_FUNCTION
-void PhysicsDynamicsRemapper::
-local_remap_fwd_3d (const MT& team) const
-{
-  const int i = team.league_rank();
-
-  constexpr int PackSize = sizeof(ScalarT) / sizeof(Real);
-  using PI = ekat::PackInfo<PackSize>;
-  const int num_packs = PI::num_packs(m_num_levels(i));
-
-  switch (m_layout(i)) {
-    case etoi(LayoutType::Scalar3D):
-    {
-      auto phys = pack_view<const ScalarT>(m_phys_repo.cviews[i].v2d);
-      auto dyn  = pack_view<      ScalarT>(m_dyn_repo.views[i].v4d);
-
-      const auto tr = Kokkos::TeamVectorRange(team, m_num_phys_cols*num_packs);
-      const auto f = [&] (const int idx) {
-        const int icol = idx / num_packs;
-        const int ilev = idx % num_packs;
-
-        const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-        dyn(elgp[0],elgp[1],elgp[2],ilev) = phys(icol,ilev);
-      };
-      Kokkos::parallel_for(tr, f);
-      break;
-    }
-    case etoi(LayoutType::Vector3D):
-    {
-      auto phys = pack_view<const ScalarT>(m_phys_repo.cviews[i].v3d);
-      auto dyn  = pack_view<      ScalarT>(m_dyn_repo.views[i].v5d);
-      const int vec_dim = phys.extent(1);
-
-      const auto tr = Kokkos::TeamVectorRange(team, m_num_phys_cols*vec_dim*num_packs);
-      const auto f = [&] (const int idx) {
-        const int icol = (idx / num_packs) / vec_dim;
-        const int idim = (idx / num_packs) % vec_dim;
-        const int ilev =  idx % num_packs;
-
-        const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-        dyn(elgp[0],idim,elgp[1],elgp[2],ilev) = phys(icol,idim,ilev);
-      };
-      Kokkos::parallel_for(tr, f);
-      break;
-    }
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
-  }
-}
-
-template <typename MT>
-KOKKOS_FUNCTION
-void PhysicsDynamicsRemapper::
-local_remap_bwd_2d (const MT& team) const
-{
-  const int rank = team.league_rank();
-  const int i    = rank % this->m_num_fields;
-  const int icol = rank / this->m_num_fields;
-  const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-
-  switch (m_layout(i)) {
-    case etoi(LayoutType::Scalar2D):
-    {
-      auto phys = m_phys_repo.views[i].v1d;
-      auto dyn  = m_dyn_repo.cviews[i].v3d;
-
-      phys(icol) = dyn(elgp[0],elgp[1],elgp[2]);
-      break;
-    }
-    case etoi(LayoutType::Vector2D):
-    {
-      auto phys = m_phys_repo.views[i].v2d;
-      auto dyn  = m_dyn_repo.cviews[i].v4d;
-      const int vec_dim = phys.extent(1);
-
-      const auto tr = Kokkos::TeamVectorRange(team, vec_dim);
-      const auto f = [&] (const int idim) {
-        phys(icol,idim) = dyn(elgp[0],idim,elgp[1],elgp[2]);
-      };
-      Kokkos::parallel_for(tr, f);
-      break;
-    }
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
-  }
-}
-
-template <typename ScalarT, typename MT>
-KOKKOS_FUNCTION
-void PhysicsDynamicsRemapper::
-local_remap_bwd_3d (const MT& team) const
-{
-  const int rank = team.league_rank();
-  const int i    = rank % this->m_num_fields;
-  const int icol = rank / this->m_num_fields;
-  const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-
-  constexpr int PackSize = sizeof(ScalarT) / sizeof(Real);
-  using PI = ekat::PackInfo<PackSize>;
-  const int num_packs = PI::num_packs(m_num_levels(i));
-
-  switch (m_layout(i)) {
-    case etoi(LayoutType::Scalar3D):
-    {
-      auto phys = pack_view<      ScalarT>(m_phys_repo.views[i].v2d);
-      auto dyn  = pack_view<const ScalarT>(m_dyn_repo.cviews[i].v4d);
-
-      const auto tr = Kokkos::TeamVectorRange(team, num_packs);
-      const auto f = [&] (const int ilev) {
-        phys(icol,ilev) = dyn(elgp[0],elgp[1],elgp[2],ilev);
-      };
-      Kokkos::parallel_for(tr, f);
-      break;
-    }
-    case etoi(LayoutType::Vector3D):
-    {
-      auto phys = pack_view<      ScalarT>(m_phys_repo.views[i].v3d);
-      auto dyn  = pack_view<const ScalarT>(m_dyn_repo.cviews[i].v5d);
-      const int vec_dim = phys.extent(1);
-
-      const auto tr = Kokkos::TeamVectorRange(team, vec_dim*num_packs);
-      const auto f = [&] (const int idx) {
-        const int idim = idx / num_packs;
-        const int ilev = idx % num_packs;
-        phys(icol,idim,ilev) = dyn(elgp[0],idim,elgp[1],elgp[2],ilev);
-      };
-      Kokkos::parallel_for(tr, f);
-      break;
-    }
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
-  }
-}
-
 void PhysicsDynamicsRemapper::
 create_p2d_map () {
   auto num_phys_dofs = m_phys_grid->get_num_local_dofs();
@@ -748,15 +487,21 @@ create_p2d_map () {
   auto phys_gids = m_phys_grid->get_dofs_gids().get_view<const gid_type*>();
 
   auto policy = KokkosTypes<DefaultDevice>::RangePolicy(0,num_phys_dofs);
-  m_p2d = decltype(m_p2d) ("",num_phys_dofs);
+  m_p2d = decltype(m_p2d) ("p2d",num_phys_dofs);
+  m_d2p = decltype(m_d2p) ("d2p",m_num_dyn_pts);
+  Kokkos::deep_copy(m_d2p,-1);
   auto p2d = m_p2d;
+  auto d2p = m_d2p;
+  auto lid2elgp = m_lid2elgp;
 
   Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idof){
     auto gid = phys_gids(idof);
     bool found = false;
     for (int i=0; i<num_dyn_dofs; ++i) {
       if (dyn_gids(i)==gid) {
-        p2d(idof) = i;
+        const int ipt = (lid2elgp(i,0)*HOMMEXX_NP + lid2elgp(i,1))*HOMMEXX_NP + lid2elgp(i,2);
+        p2d(idof) = ipt;
+        d2p(ipt) = idof;
         found = true;
         break;
       }
@@ -771,38 +516,28 @@ KOKKOS_INLINE_FUNCTION
 void PhysicsDynamicsRemapper::
 operator()(const RemapFwdTag&, const MT& team) const
 {
-  const int i = team.league_rank();
-
-  switch (m_layout(i)) {
-    case etoi(LayoutType::Scalar2D):
-    case etoi(LayoutType::Vector2D):
-      set_dyn_to_zero<Real>(team);
-      team.team_barrier();
-
-      local_remap_fwd_2d(team);
-      break;
-    case etoi(LayoutType::Scalar3D):
-    case etoi(LayoutType::Vector3D):
-      if (m_pack_alloc_property(i) == AllocPropType::PackAlloc) {
-        set_dyn_to_zero<pack_type>(team);
-        team.team_barrier();
-
-        local_remap_fwd_3d<pack_type>(team);
-      } else if (m_pack_alloc_property(i) == AllocPropType::SmallPackAlloc) {
-        set_dyn_to_zero<small_pack_type>(team);
-        team.team_barrier();
-
-        local_remap_fwd_3d<small_pack_type>(team);
-      } else {
-        set_dyn_to_zero<Real>(team);
-        team.team_barrier();
-
-        local_remap_fwd_3d<Real>(team);
-      }
-      break;
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
-  }
+  constexpr int NGP = HOMMEXX_NP*HOMMEXX_NP;
+  const int num_elems = m_num_dyn_pts / NGP;
+  const int islice = team.league_rank() / num_elems;
+  const int ie     = team.league_rank() % num_elems;
+  const auto& slice = m_slices(islice);
+
+  // Since the BEX sums contributions from all the dyn points sharing a dof,
+  // the dyn points not picked by any phys column must be set to 0 (as well
+  // as the padding, if any)
+  const int num_dyn_levs = slice.num_dyn_levs;
+  const auto tr = Kokkos::TeamVectorRange(team, NGP*num_dyn_levs);
+  const auto f = [&] (const int idx) {
+    const int igp  = idx / num_dyn_levs;
+    const int ilev = idx % num_dyn_levs;
+    const int icol = m_d2p(ie*NGP+igp);
+
+    Real* dyn = slice.dyn + ie*slice.dyn_elem_stride
+                          + (igp / HOMMEXX_NP)*slice.dyn_gp_stride[0]
+                          + (igp % HOMMEXX_NP)*slice.dyn_gp_stride[1];
+    dyn[ilev] = (icol>=0 && ilev<slice.num_levs) ? slice.phys[icol*slice.phys_col_stride+ilev] : 0;
+  };
+  Kokkos::parallel_for(tr, f);
 }
 
 template<typename MT>
@@ -810,27 +545,23 @@ KOKKOS_INLINE_FUNCTION
 void PhysicsDynamicsRemapper::
 operator()(const RemapBwdTag&, const MT& team) const
 {
-  const int rank = team.league_rank();
-  const int i = rank % this->m_num_fields;
-
-  switch (m_layout(i)) {
-    case etoi(LayoutType::Scalar2D):
-    case etoi(LayoutType::Vector2D):
-      local_remap_bwd_2d(team);
-      break;
-    case etoi(LayoutType::Scalar3D):
-    case etoi(LayoutType::Vector3D):
-      if (m_pack_alloc_property(i) == AllocPropType::PackAlloc) {
-        local_remap_bwd_3d<pack_type>(team);
-      } else if (m_pack_alloc_property(i) == AllocPropType::SmallPackAlloc) {
-        local_remap_bwd_3d<small_pack_type>(team);
-      } else {
-        local_remap_bwd_3d<Real>(team);
-      }
-      break;
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
-  }
+  constexpr int NGP = HOMMEXX_NP*HOMMEXX_NP;
+  const int num_slices = m_slices.extent(0);
+  const int islice = team.league_rank() % num_slices;
+  const int icol   = team.league_rank() / num_slices;
+  const auto& slice = m_slices(islice);
+
+  const int ipt = m_p2d(icol);
+  const Real* dyn = slice.dyn + (ipt / NGP)*slice.dyn_elem_stride
+                              + ((ipt % NGP) / HOMMEXX_NP)*slice.dyn_gp_stride[0]
+                              + (ipt % HOMMEXX_NP)*slice.dyn_gp_stride[1];
+  Real* phys = slice.phys + icol*slice.phys_col_stride;
+
+  const auto tr = Kokkos::TeamVectorRange(team, slice.num_levs);
+  const auto f = [&] (const int ilev) {
+    phys[ilev] = dyn[ilev];
+  };
+  Kokkos::parallel_for(tr, f);
 }
 
 } // namespace scream
@@ -5,8 +5,6 @@
 
 #include "share/grid/remap/abstract_remapper.hpp"
 
-#include "ekat/ekat_pack.hpp"
-
 namespace Homme {
 class BoundaryExchange;
 }
@@ -33,9 +31,6 @@ public:
   template<typename T>
   using view_1d = view_Nd<T,1>;
 
-  using pack_type = ekat::Pack<Real,SCREAM_PACK_SIZE>;
-  using small_pack_type = ekat::Pack<Real,SCREAM_SMALL_PACK_SIZE>;
-
   PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
                            const grid_ptr_type& dyn_grid);
 
@@ -80,11 +75,17 @@ protected:
   grid_ptr_type     m_phys_grid;
 
   int m_num_phys_cols;
+  int m_num_dyn_pts;
   typename Field::view_dev_t<const int**>  m_lid2elgp;
 
   std::shared_ptr<Homme::BoundaryExchange>  m_be;
 
+  // Gather maps between phys columns and dyn points, where a dyn point is
+  // the flattened (elem,gp,gp) index. Since several dyn points may correspond
+  // to the same phys column, d2p is -1 for the dyn points that are not picked
+  // by any phys column (they get 0 in fwd remap, and are fixed by the BEX).
   view_1d<int>  m_p2d;
+  view_1d<int>  m_d2p;
 
 #ifdef KOKKOS_ENABLE_CUDA
 public:
@@ -93,74 +94,27 @@ public:
 #endif
   void create_p2d_map ();
 
-  enum AllocPropType : int {
-    PackAlloc      = 0,
-    SmallPackAlloc = 1,
-    RealAlloc      = 2
-  };
-
-  // A container structure to hold the physically-shaped views for the fields.
-  // Notice that only one of the vNd will be set, while the others will be empty.
-  template<typename T>
-  struct ViewsContainer {
-    view_Nd<T,1>   v1d;
-    view_Nd<T,2>   v2d;
-    view_Nd<T,3>   v3d;
-    view_Nd<T,4>   v4d;
-    view_Nd<T,5>   v5d;
-  };
-
-  // A views repo contains a view of ViewsContainer (one per field)
-  // We have both const and non const, as well as device and host copies.
-  struct ViewsRepo {
-    using views_t  = view_1d<ViewsContainer<Real>>;
-    using cviews_t = view_1d<ViewsContainer<const Real>>;
-    using hviews_t = typename views_t::HostMirror;
-    using hcviews_t = typename cviews_t::HostMirror;
-
-    views_t   views;
-    cviews_t  cviews;
-
-    hviews_t  h_views;
-    hcviews_t h_cviews;
+  // All registered fields are split into slices, each being a 2d array (col,lev)
+  // on the phys grid, and (elem,gp,gp,lev) on the dyn grid, with contiguous levels.
+  // E.g., a vector 3d field with N components yields N slices, while a scalar 2d
+  // field yields a single slice with one level. This allows to remap all fields
+  // (as well as subfields) in a single kernel, without branching on the layout.
+  struct FieldSlice {
+    Real* phys;
+    Real* dyn;
+    int   phys_col_stride;
+    int   dyn_elem_stride;
+    int   dyn_gp_stride[2];
+    // Number of levels to copy, and allocated number of levels on the dyn grid
+    int   num_levs;
+    int   num_dyn_levs;
   };
 
 protected:
 
-  ViewsRepo   m_phys_repo;
-  ViewsRepo   m_dyn_repo;
-
-  // NOTE: one could deduce from OldViewT whether the return type
-  //       should have a const value type. But the code is a bit tedious,
-  //       so we'll just force to call this as pack_view<const T>(v).
-  template<typename NewValueT, typename OldViewT>
-  KOKKOS_INLINE_FUNCTION
-  view_Nd<NewValueT,OldViewT::rank> pack_view (const OldViewT& v) const {
-    constexpr int N = OldViewT::rank;
-    Kokkos::LayoutRight kl;
-    for (int i=0; i<N; ++i) {
-      kl.dimension[i] = v.extent(i);
-    }
-    using OldValueT = typename OldViewT::traits::value_type;
-    auto pack_size = sizeof(NewValueT) / sizeof(OldValueT);
-    kl.dimension[N-1] /= pack_size;
-    auto ptr = reinterpret_cast<NewValueT*>(v.data());
-
-    // Naively, you would return tmp directly. However, if v is a
-    // subview of another view along the second extent, you need
-    // to fix the stride, since the ctor from ptr+layout would have
-    // no knowledge about that.
-    view_Nd<NewValueT,N> tmp (ptr,kl);
-    auto vm = tmp.impl_map();
-    vm.m_impl_offset.m_stride = v.impl_map().stride_0() / pack_size;
-    return view_Nd<NewValueT,N> (tmp.impl_track(),vm);
-  }
-
-  view_1d<Int> m_layout;
-  view_1d<Int> m_pack_alloc_property;
-
-  // Only meaningful for 3d fields. Set to -1 for 2d fields, in case wrongfully used
-  view_1d<Int> m_num_levels;
+  view_1d<FieldSlice>                       m_slices;
+  typename view_1d<FieldSlice>::HostMirror  m_slices_h;
+  int                                       m_max_dyn_levs;
 
   // List of phys/dyn fields that are subfields of other fields.
   // For each field, we store the last value of subview info, to check if
@@ -171,39 +125,18 @@ protected:
 
   void initialize_device_variables();
 
+  // Recompute the slices (host and device), e.g. if some subview info changed
+  void create_slices ();
+
   bool subfields_info_has_changed (const std::map<int,SubviewInfo>& subfield_info,
                                    const std::vector<field_type>& fields) const;
-  void update_subfields_views (const std::map<int,SubviewInfo>& subfield_info,
-                               const ViewsRepo& repo,
-                               const std::vector<field_type>& fields) const;
+  void update_subfields_info (std::map<int,SubviewInfo>& subfield_info,
+                              const std::vector<field_type>& fields) const;
 
   // Remap methods
   void do_remap_fwd () override;
   void do_remap_bwd () override;
 
-  // phys->dyn requires a halo-exchange. Since not all entries in dyn
-  // are overwritten before the exchange, to avoid leftover garbage,
-  // we need to set all entries of dyn to zero.
-  template <typename ScalarT, typename MT>
-  KOKKOS_FUNCTION
-  void set_dyn_to_zero(const MT& team) const;
-
-  template <typename MT>
-  KOKKOS_FUNCTION
-  void local_remap_fwd_2d (const MT& team) const;
-
-  template <typename ScalarT, typename MT>
-  KOKKOS_FUNCTION
-  void local_remap_fwd_3d (const MT& team) const;
-
-  template <typename MT>
-  KOKKOS_FUNCTION
-  void local_remap_bwd_2d (const MT& team) const;
-
-  template <typename ScalarT, typename MT>
-  KOKKOS_FUNCTION
-  void local_remap_bwd_3d (const MT& team) const;
-
 public:
   struct RemapFwdTag {};
   struct RemapBwdTag {};
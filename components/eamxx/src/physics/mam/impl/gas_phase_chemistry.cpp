@@ -1,5 +1,7 @@
 #include <mam4xx/mam4.hpp>
 
+#include "share/util/scream_node_shared_tables.hpp"
+
 namespace scream::impl {
 
 using mam4::utils::min_max_bound;
@@ -166,9 +168,38 @@ mam4::mo_photo::PhotoTableData read_photo_table(const ekat::Comm& comm,
                                                        nump, numsza, numcolo3,
                                                        numalb);
 
+  // The largest tables (rsf_tab and xsqy) are stored once per node: replace the views
+  // allocated by mam4 with node-shared ones, which are read from file by one rank per node
+  using RsfTabView = decltype(table.rsf_tab);
+  using XsqyView   = decltype(table.xsqy);
+  const auto& rsf  = table.rsf_tab;
+  const auto& xsqy = table.xsqy;
+  table.rsf_tab = get_node_shared_table<RsfTabView>(std::string("mam4_photo_rsf_tab:") + rsf_file, comm,
+    [&](const auto& rsf_tab_h) {
+      int id;
+      int result = nc_open(rsf_file, NC_NOWRITE, &id);
+      EKAT_REQUIRE_MSG(result == 0, "Error! Couldn't open rsf_file '" << rsf_file << "'\n");
+      read_nc_var(rsf_file, id, "RSF", rsf_tab_h);
+      nc_close(id);
+    }, rsf.extent(0), rsf.extent(1), rsf.extent(2), rsf.extent(3), rsf.extent(4));
+  table.xsqy = get_node_shared_table<XsqyView>(std::string("mam4_photo_xsqy:") + xs_long_file, comm,
+    [&](const auto& xsqy_h) {
+      int id;
+      int result = nc_open(xs_long_file, NC_NOWRITE, &id);
+      EKAT_REQUIRE_MSG(result == 0, "Error! Couldn't open xs_long_file '" << xs_long_file << "'\n");
+      // read xsqy data (using lng_indexer_h for the first index)
+      int ndx = 0;
+      for (int m = 0; m < mam4::mo_photo::phtcnt; ++m) {
+        if (lng_indexer_h(m) > 0) {
+          auto xsqy_ndx_h = ekat::subview(xsqy_h, ndx);
+          read_nc_var(xs_long_file, id, lng_indexer_h(m), xsqy_ndx_h);
+          ++ndx;
+        }
+      }
+      nc_close(id);
+    }, xsqy.extent(0), xsqy.extent(1), xsqy.extent(2), xsqy.extent(3));
+
   // allocate host views for table data
-  auto rsf_tab_h = Kokkos::create_mirror_view(table.rsf_tab);
-  auto xsqy_h = Kokkos::create_mirror_view(table.xsqy);
   auto sza_h = Kokkos::create_mirror_view(table.sza);
   auto alb_h = Kokkos::create_mirror_view(table.alb);
   auto press_h = Kokkos::create_mirror_view(table.press);
@@ -184,20 +215,9 @@ mam4::mo_photo::PhotoTableData read_photo_table(const ekat::Comm& comm,
     read_nc_var(rsf_file, rsf_id, "alb", alb_h);
     read_nc_var(rsf_file, rsf_id, "colo3fact", o3rat_h);
     read_nc_var(rsf_file, rsf_id, "colo3", colo3_h);
-    read_nc_var(rsf_file, rsf_id, "RSF", rsf_tab_h);
 
     read_nc_var(xs_long_file, xs_long_id, "pressure", prs_h);
 
-    // read xsqy data (using lng_indexer_h for the first index)
-    int ndx = 0;
-    for (int m = 0; m < mam4::mo_photo::phtcnt; ++m) {
-      if (lng_indexer_h(m) > 0) {
-        auto xsqy_ndx_h = ekat::subview(xsqy_h, ndx);
-        read_nc_var(xs_long_file, xs_long_id, lng_indexer_h(m), xsqy_ndx_h);
-        ++ndx;
-      }
-    }
-
     // populate etfphot by rebinning solar data
     HostView1D wc_h("wc", nw), wlintv_h("wlintv", nw), we_h("we", nw+1);
     read_nc_var(rsf_file, rsf_id, "wc", wc_h);
@@ -214,8 +234,6 @@ mam4::mo_photo::PhotoTableData read_photo_table(const ekat::Comm& comm,
   }
 
   // broadcast host views from MPI root to others
-  comm.broadcast(rsf_tab_h.data(), nw*numalb*numcolo3*numsza*nump, mpi_root);
-  comm.broadcast(xsqy_h.data(),    numj*nw*nt*np_xs,               mpi_root);
   comm.broadcast(sza_h.data(),     numsza,                         mpi_root);
   comm.broadcast(alb_h.data(),     numalb,                         mpi_root);
   comm.broadcast(press_h.data(),   nump,                           mpi_root);
@@ -225,8 +243,6 @@ mam4::mo_photo::PhotoTableData read_photo_table(const ekat::Comm& comm,
   comm.broadcast(prs_h.data(),     np_xs,                          mpi_root);
 
   // copy host photolysis table into place on device
-  Kokkos::deep_copy(table.rsf_tab,          rsf_tab_h);
-  Kokkos::deep_copy(table.xsqy,             xsqy_h);
   Kokkos::deep_copy(table.sza,              sza_h);
   Kokkos::deep_copy(table.alb,              alb_h);
   Kokkos::deep_copy(table.press,            press_h);
@@ -1,4 +1,5 @@
 #include "eamxx_ml_correction_process_interface.hpp"
+#include "ml_correction_zenith.hpp"
 #include "ekat/ekat_assert.hpp"
 #include "ekat/util/ekat_units.hpp"
 #include "share/field/field_utils.hpp"
@@ -6,7 +7,79 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 
+#include <ekat/std_meta/ekat_std_utils.hpp>
+#include <ekat/util/ekat_string_utils.hpp>
+
 namespace scream {
+
+namespace {
+
+bool is_none (const std::string& model_path) {
+  return model_path=="NONE" or model_path=="None";
+}
+
+// Offset of a variable in the ML model input/output vector. Names are aliases of the same variable.
+int find_var (const std::vector<ColumnMLP::Variable>& vars,
+              const std::vector<std::string>& names,
+              const int size, const std::string& model_file)
+{
+  for (const auto& var : vars) {
+    if (ekat::contains(names,var.name)) {
+      EKAT_REQUIRE_MSG (var.size==size,
+          "Error! Wrong size for ML model output.\n"
+          " - model file : " + model_file + "\n"
+          " - output name: " + var.name + "\n"
+          " - output size: " + std::to_string(var.size) + "\n"
+          " - expected   : " + std::to_string(size) + "\n");
+      return var.offset;
+    }
+  }
+  EKAT_ERROR_MSG ("Error! Could not find output in ML model.\n"
+                  " - model file : " + model_file + "\n"
+                  " - output name: " + ekat::join(names,"|") + "\n");
+}
+
+template<typename XView, typename SrcView>
+void set_input (const XView& x, const int offset, const SrcView& src, const int ncols, const int nlevs)
+{
+  const auto policy = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{ncols,nlevs});
+  Kokkos::parallel_for("MLCorrection::set_input_3d", policy,
+                       KOKKOS_LAMBDA(const int icol, const int ilev) {
+    x(icol,offset+ilev) = src(icol,ilev);
+  });
+}
+
+template<typename XView, typename SrcView>
+void set_input (const XView& x, const int offset, const SrcView& src, const int ncols)
+{
+  Kokkos::parallel_for("MLCorrection::set_input_2d", ncols,
+                       KOKKOS_LAMBDA(const int icol) {
+    x(icol,offset) = src(icol);
+  });
+}
+
+template<typename YView, typename DstView>
+void add_tendency (const YView& y, const int offset, const DstView& dst, const Real dt,
+                   const int ncols, const int nlevs)
+{
+  const auto policy = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{ncols,nlevs});
+  Kokkos::parallel_for("MLCorrection::add_tendency", policy,
+                       KOKKOS_LAMBDA(const int icol, const int ilev) {
+    dst(icol,ilev) += y(icol,offset+ilev)*dt;
+  });
+}
+
+template<typename YView, typename DstView>
+void override_field (const YView& y, const int offset, const DstView& dst, const int ncols)
+{
+  Kokkos::parallel_for("MLCorrection::override_field", ncols,
+                       KOKKOS_LAMBDA(const int icol) {
+    dst(icol) = y(icol,offset);
+  });
+}
+
+} // anonymous namespace
+
 // =========================================================================================
 MLCorrection::MLCorrection(const ekat::Comm &comm,
                            const ekat::ParameterList &params)
@@ -16,6 +89,11 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ML_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ML_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ML_correction_unit_test");
+  m_inference_backend = m_params.get<std::string>("ML_inference_backend","python");
+  EKAT_REQUIRE_MSG (m_inference_backend=="python" or m_inference_backend=="native",
+      "Error! Invalid choice for 'ML_inference_backend'.\n"
+      " - input value: " + m_inference_backend + "\n"
+      " - valid values: python, native\n");
 }
 
 // =========================================================================================
@@ -73,17 +151,36 @@ void MLCorrection::set_grids(
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
   fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy  
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_inference_backend=="native") {
+    // Load the models, and allocate their input/output arrays
+    auto load = [&](const std::string& model_path) {
+      std::shared_ptr<NativeModel> model;
+      if (not is_none(model_path)) {
+        model = std::make_shared<NativeModel>();
+        model->mlp.load(model_path);
+        model->x = view_2d<Real>("ML input",m_num_cols,model->mlp.num_inputs());
+        model->y = view_2d<Real>("ML output",m_num_cols,model->mlp.num_outputs());
+      }
+      return model;
+    };
+    m_native_tq         = load(m_ML_model_path_tq);
+    m_native_uv         = load(m_ML_model_path_uv);
+    m_native_sfc_fluxes = load(m_ML_model_path_sfc_fluxes);
+    m_cos_zenith = view_1d<Real>("cos_zenith_angle",m_num_cols);
+  } else {
+    ekat::disable_all_fpes();  // required for importing numpy  
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    ekat::enable_fpes(fpe_mask);
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
+  m_qv_old = view_2d<Real>("qv_old",m_num_cols,m_num_levs);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -98,10 +195,37 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
+  // For precipitation adjustment we need to track the change in column integrated 'qv',
+  // so we save the original qv before ML changes the state, to back out a qv_tend.
+  // This is done only if Tq ML is turned on
+  const bool do_precip_adjustment = not is_none(m_ML_model_path_tq);
+  if (do_precip_adjustment) {
+    save_qv();
+  }
+
+  if (m_inference_backend=="native") {
+    run_native(dt);
+  } else {
+    run_python(dt);
+  }
+
+  if (do_precip_adjustment) {
+    adjust_precip(m_qv_old);
+  }
+}
+
+// =========================================================================================
+void MLCorrection::run_python(const double dt) {
   // use model time to infer solar zenith angle for the ML prediction
   auto current_ts = timestamp();
   std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
 
+  // The python code works on host views
+  for (const auto& fname : {"phis","sfc_alb_dif_vis","qv","T_mid","SW_flux_dn",
+                            "sfc_flux_sw_net","sfc_flux_lw_dn","horiz_winds"}) {
+    get_field_in(fname).sync_to_host();
+  }
+
   const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
   const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
 
@@ -113,12 +237,6 @@ void MLCorrection::run_impl(const double dt) {
   const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
   const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
 
-  // For precipitation adjustment we need to track the change in column integrated 'qv'
-  // So we clone the original qv before ML changes the state so we can back out a qv_tend
-  // to use with precip adjustment.
-  auto qv_src = get_field_in("qv");
-  auto qv_in = qv_src.clone();
-
   auto h_lat  = m_lat.get_view<const Real*,Host>();
   auto h_lon  = m_lon.get_view<const Real*,Host>();
 
@@ -159,74 +277,201 @@ void MLCorrection::run_impl(const double dt) {
   pybind11::gil_scoped_release no_gil;  
   ekat::enable_fpes(fpe_mask);   
 
-  // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
-  if (m_ML_model_path_tq != "None") {
-    using PC  = scream::physics::Constants<Real>;
-    using KT  = KokkosTypes<DefaultDevice>;
-    using MT  = typename KT::MemberType;
-    using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
-    const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
-    const auto &precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real *>();
-    const auto &precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real *>();
-    constexpr Real g = PC::gravit;
-    const auto num_levs = m_num_levs;
-    const auto policy = ESU::get_default_team_policy(m_num_cols, m_num_levs);
-    
-    const auto &qv_told = qv_in.get_view<const Real **>();
-    const auto &qv_tnew = get_field_in("qv").get_view<const Real **>();
-    Kokkos::parallel_for("Compute WVP diff", policy,
-                         KOKKOS_LAMBDA(const MT& team) {
-      const int icol = team.league_rank();
-      auto qold_icol = ekat::subview(qv_told,icol);
-      auto qnew_icol = ekat::subview(qv_tnew,icol);
-      auto rho_icol  = ekat::subview(pseudo_density,icol);
-      Real net_column_moistening = 0;
-      // Compute WaterVaporPath Difference
-      // The water vapor path (WVP) is calculated as the integral of d_qv over the vertical column
-      // which is converted to the units of precipitation which are kg/m*m
-      //     WVP = sum( d_qv * pseudo_density / gravity ),
-      //       where d_qv = qv_new - qv_old
-      //       units sanity check
-      //       	d_qv = kg/kg
-      //       	pseudo_density = Pa = kg/m/s2
-      //       	gravity = m/s2
-      //       d_qv * pseduo_density / gravity = kg/kg * kg/m/s2 * s2/m = kg/m2
-      // Compute WaterVaporPath Difference
-      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, num_levs),
-                              [&] (const int& ilev, Real& lsum) {
-        lsum += (qnew_icol(ilev)-qold_icol(ilev)) * rho_icol(ilev) / g;
-      },Kokkos::Sum<Real>(net_column_moistening));
-      team.team_barrier();
-      // Adjust Precipitation
-      //  - Note, we subtract the water vapor path because positive precip represents
-      //    a descrease in qv.
-      auto tot_precip = precip_liq_surf_mass(icol)+precip_ice_surf_mass(icol);
-      if (tot_precip>0) {
-        // adjust precip by weighted avg of both phases
-        Kokkos::single(Kokkos::PerTeam(team), [&] {
-          auto liq_frac = precip_liq_surf_mass(icol)/tot_precip;
-          auto ice_frac = precip_ice_surf_mass(icol)/tot_precip;
-          precip_liq_surf_mass(icol) -= liq_frac*net_column_moistening;
-          precip_ice_surf_mass(icol) -= ice_frac*net_column_moistening;
-	});
+  for (const auto& fname : {"qv","T_mid","sfc_flux_sw_net","sfc_flux_lw_dn","horiz_winds"}) {
+    get_field_out(fname).sync_to_dev();
+  }
+}
+
+// =========================================================================================
+void MLCorrection::run_native(const double dt) {
+  compute_cos_zenith();
+
+  const auto ncols = m_num_cols;
+  const auto nlevs = m_num_levs;
+  const auto T_mid = get_field_out("T_mid").get_view<Real**>();
+  const auto qv    = get_field_out("qv").get_view<Real**>();
+  const auto u     = get_field_out("horiz_winds").get_component(0).get_view<Real**>();
+  const auto v     = get_field_out("horiz_winds").get_component(1).get_view<Real**>();
+
+  // The models are applied in sequence, each one seeing the state updated by the previous ones
+  if (m_native_tq) {
+    auto& model = *m_native_tq;
+    assemble_inputs(model);
+    model.mlp.predict(model.x,model.y);
+
+    const auto& outs = model.mlp.outputs();
+    const auto& file = model.mlp.filename();
+    add_tendency(model.y,find_var(outs,{"dQ1"},nlevs,file),T_mid,dt,ncols,nlevs);
+    add_tendency(model.y,find_var(outs,{"dQ2"},nlevs,file),qv,dt,ncols,nlevs);
+  }
+  if (m_native_uv) {
+    auto& model = *m_native_uv;
+    assemble_inputs(model);
+    model.mlp.predict(model.x,model.y);
+
+    const auto& outs = model.mlp.outputs();
+    const auto& file = model.mlp.filename();
+    add_tendency(model.y,find_var(outs,{"dQu","dQxwind"},nlevs,file),u,dt,ncols,nlevs);
+    add_tendency(model.y,find_var(outs,{"dQv","dQywind"},nlevs,file),v,dt,ncols,nlevs);
+  }
+  if (m_native_sfc_fluxes) {
+    auto& model = *m_native_sfc_fluxes;
+    assemble_inputs(model);
+    model.mlp.predict(model.x,model.y);
+
+    const auto& outs = model.mlp.outputs();
+    const auto& file = model.mlp.filename();
+    const auto sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
+    const auto lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
+    const auto sw_name = "net_shortwave_sfc_flux_via_transmissivity";
+    const auto lw_name = "override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface";
+    override_field(model.y,find_var(outs,{sw_name},1,file),sw_net,ncols);
+    override_field(model.y,find_var(outs,{lw_name},1,file),lw_dn,ncols);
+  }
+}
+
+// =========================================================================================
+void MLCorrection::compute_cos_zenith() {
+  const auto days = days_from_j2000(timestamp());
+  const auto lat  = m_lat.get_view<const Real*,Host>();
+  const auto lon  = m_lon.get_view<const Real*,Host>();
+  const auto cosz = Kokkos::create_mirror_view(m_cos_zenith);
+  for (int icol=0; icol<m_num_cols; ++icol) {
+    cosz(icol) = cos_zenith_angle(days,lon(icol),lat(icol));
+  }
+  Kokkos::deep_copy(m_cos_zenith,cosz);
+}
+
+// =========================================================================================
+void MLCorrection::assemble_inputs(const NativeModel& model) {
+  const auto ncols = m_num_cols;
+  const auto nlevs = m_num_levs;
+  const auto& file = model.mlp.filename();
+  for (const auto& var : model.mlp.inputs()) {
+    const auto& n = var.name;
+    if (n=="T_mid" or n=="qv" or n=="U" or n=="V") {
+      EKAT_REQUIRE_MSG (var.size==nlevs,
+          "Error! Wrong size for ML model input.\n"
+          " - model file: " + file + "\n"
+          " - input name: " + n + "\n"
+          " - input size: " + std::to_string(var.size) + "\n"
+          " - expected  : " + std::to_string(nlevs) + "\n");
+      view_2d<const Real> src;
+      if (n=="T_mid") {
+        src = get_field_in("T_mid").get_view<const Real**>();
+      } else if (n=="qv") {
+        src = get_field_in("qv").get_view<const Real**>();
+      } else {
+        src = get_field_in("horiz_winds").get_component(n=="U" ? 0 : 1).get_view<const Real**>();
+      }
+      set_input(model.x,var.offset,src,ncols,nlevs);
+    } else {
+      EKAT_REQUIRE_MSG (var.size==1,
+          "Error! Wrong size for ML model input.\n"
+          " - model file: " + file + "\n"
+          " - input name: " + n + "\n"
+          " - input size: " + std::to_string(var.size) + "\n"
+          " - expected  : 1\n");
+      if (n=="cos_zenith_angle") {
+        set_input(model.x,var.offset,m_cos_zenith,ncols);
+      } else if (n=="lat") {
+        set_input(model.x,var.offset,m_lat.get_view<const Real*>(),ncols);
+      } else if (n=="surface_geopotential") {
+        set_input(model.x,var.offset,get_field_in("phis").get_view<const Real*>(),ncols);
+      } else if (n=="surface_diffused_shortwave_albedo") {
+        set_input(model.x,var.offset,get_field_in("sfc_alb_dif_vis").get_view<const Real*>(),ncols);
+      } else if (n=="total_sky_downward_shortwave_flux_at_top_of_atmosphere") {
+        const auto sw_flux_dn = get_field_in("SW_flux_dn").get_view<const Real**>();
+        set_input(model.x,var.offset,Kokkos::subview(sw_flux_dn,Kokkos::ALL,0),ncols);
       } else {
-        // Apply all the adjustment to a single phase based on surface temperature
-        Kokkos::single(Kokkos::PerTeam(team), [&] {
-          auto T_icol = ekat::subview(T_mid,icol);
-          if (T_icol(num_levs-1)>273.15) {
-            precip_liq_surf_mass(icol) -= net_column_moistening;
-          } else {
-            precip_ice_surf_mass(icol) -= net_column_moistening;
-          }
-	});
+        EKAT_ERROR_MSG ("Error! Unsupported ML model input.\n"
+                        " - model file: " + file + "\n"
+                        " - input name: " + n + "\n"
+                        " - supported : T_mid, qv, U, V, cos_zenith_angle, lat, surface_geopotential,\n"
+                        "               surface_diffused_shortwave_albedo,\n"
+                        "               total_sky_downward_shortwave_flux_at_top_of_atmosphere\n");
       }
-      // Note, with the above formulation it is possible for the precipitation to go negative.
-      // We rely on the field property checker defined in the intialization function to repair
-      // any instances of negative precipitation.
-    });
+    }
   }
 }
 
+// =========================================================================================
+void MLCorrection::save_qv() {
+  const auto qv     = get_field_in("qv").get_view<const Real**>();
+  const auto qv_old = m_qv_old;
+  const auto policy = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{m_num_cols,m_num_levs});
+  Kokkos::parallel_for("MLCorrection::save_qv", policy,
+                       KOKKOS_LAMBDA(const int icol, const int ilev) {
+    qv_old(icol,ilev) = qv(icol,ilev);
+  });
+}
+
+// =========================================================================================
+void MLCorrection::adjust_precip(const view_2d<const Real>& qv_told) {
+  using PC  = scream::physics::Constants<Real>;
+  using MT  = typename KT::MemberType;
+  using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+  const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
+  const auto &T_mid                = get_field_in("T_mid").get_view<const Real**>();
+  const auto &precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real *>();
+  const auto &precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real *>();
+  constexpr Real g = PC::gravit;
+  const auto num_levs = m_num_levs;
+  const auto policy = ESU::get_default_team_policy(m_num_cols, m_num_levs);
+
+  const auto &qv_tnew = get_field_in("qv").get_view<const Real **>();
+  Kokkos::parallel_for("Compute WVP diff", policy,
+                       KOKKOS_LAMBDA(const MT& team) {
+    const int icol = team.league_rank();
+    auto qold_icol = ekat::subview(qv_told,icol);
+    auto qnew_icol = ekat::subview(qv_tnew,icol);
+    auto rho_icol  = ekat::subview(pseudo_density,icol);
+    Real net_column_moistening = 0;
+    // Compute WaterVaporPath Difference
+    // The water vapor path (WVP) is calculated as the integral of d_qv over the vertical column
+    // which is converted to the units of precipitation which are kg/m*m
+    //     WVP = sum( d_qv * pseudo_density / gravity ),
+    //       where d_qv = qv_new - qv_old
+    //       units sanity check
+    //       	d_qv = kg/kg
+    //       	pseudo_density = Pa = kg/m/s2
+    //       	gravity = m/s2
+    //       d_qv * pseduo_density / gravity = kg/kg * kg/m/s2 * s2/m = kg/m2
+    // Compute WaterVaporPath Difference
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, num_levs),
+                            [&] (const int& ilev, Real& lsum) {
+      lsum += (qnew_icol(ilev)-qold_icol(ilev)) * rho_icol(ilev) / g;
+    },Kokkos::Sum<Real>(net_column_moistening));
+    team.team_barrier();
+    // Adjust Precipitation
+    //  - Note, we subtract the water vapor path because positive precip represents
+    //    a descrease in qv.
+    auto tot_precip = precip_liq_surf_mass(icol)+precip_ice_surf_mass(icol);
+    if (tot_precip>0) {
+      // adjust precip by weighted avg of both phases
+      Kokkos::single(Kokkos::PerTeam(team), [&] {
+        auto liq_frac = precip_liq_surf_mass(icol)/tot_precip;
+        auto ice_frac = precip_ice_surf_mass(icol)/tot_precip;
+        precip_liq_surf_mass(icol) -= liq_frac*net_column_moistening;
+        precip_ice_surf_mass(icol) -= ice_frac*net_column_moistening;
+      });
+    } else {
+      // Apply all the adjustment to a single phase based on surface temperature
+      Kokkos::single(Kokkos::PerTeam(team), [&] {
+        auto T_icol = ekat::subview(T_mid,icol);
+        if (T_icol(num_levs-1)>273.15) {
+          precip_liq_surf_mass(icol) -= net_column_moistening;
+        } else {
+          precip_ice_surf_mass(icol) -= net_column_moistening;
+        }
+      });
+    }
+    // Note, with the above formulation it is possible for the precipitation to go negative.
+    // We rely on the field property checker defined in the intialization function to repair
+    // any instances of negative precipitation.
+  });
+}
+
 // =========================================================================================
 void MLCorrection::finalize_impl() {
   // Do nothing
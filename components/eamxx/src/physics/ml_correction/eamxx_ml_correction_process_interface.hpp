@@ -16,6 +16,7 @@
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "physics/ml_correction/ml_correction_column_mlp.hpp"
 
 namespace scream {
 
@@ -30,6 +31,12 @@ namespace scream {
 class MLCorrection : public AtmosphereProcess {
  public:
   using Pack = ekat::Pack<Real,SCREAM_PACK_SIZE>;
+  using KT   = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
   // Constructors
   MLCorrection(const ekat::Comm &comm, const ekat::ParameterList &params);
 
@@ -49,6 +56,26 @@ class MLCorrection : public AtmosphereProcess {
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
+  void run_python (const double dt);
+
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  // Native (Kokkos) inference: the models are evaluated on device, on all columns at once
+  struct NativeModel {
+    ColumnMLP     mlp;
+    view_2d<Real> x;  // (ncols,num_inputs)
+    view_2d<Real> y;  // (ncols,num_outputs)
+  };
+  void run_native (const double dt);
+  void compute_cos_zenith ();
+  void assemble_inputs (const NativeModel& model);
+
+  // Adjust surface precipitation to balance the change in column water vapor
+  void save_qv ();
+  void adjust_precip (const view_2d<const Real>& qv_old);
+ protected:
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
@@ -58,6 +85,7 @@ class MLCorrection : public AtmosphereProcess {
   std::string m_ML_model_path_tq;
   std::string m_ML_model_path_uv;
   std::string m_ML_model_path_sfc_fluxes;
+  std::string m_inference_backend;
   std::vector<std::string> m_fields_ml_output_variables;
   bool m_ML_correction_unit_test;
   pybind11::module py_correction;
@@ -65,6 +93,16 @@ class MLCorrection : public AtmosphereProcess {
   pybind11::object ML_model_uv;
   pybind11::object ML_model_sfc_fluxes;
   int fpe_mask;
+
+  // Native inference. Models are not allocated if the corresponding path is NONE
+  std::shared_ptr<NativeModel> m_native_tq;
+  std::shared_ptr<NativeModel> m_native_uv;
+  std::shared_ptr<NativeModel> m_native_sfc_fluxes;
+  view_1d<Real>                m_cos_zenith;
+
+  // Copy of qv before the ML correction, to back out the column moistening.
+  // Allocated once, rather than cloning qv at every step
+  view_2d<Real>                m_qv_old;
 };  // class MLCorrection
 
 }  // namespace scream
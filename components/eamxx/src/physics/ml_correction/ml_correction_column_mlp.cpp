@@ -0,0 +1,223 @@
+#include "ml_correction_column_mlp.hpp"
+
+#include <ekat/ekat_assert.hpp>
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
+#include <fstream>
+#include <sstream>
+
+namespace scream {
+
+namespace {
+
+// Read the whole file, stripping comments, and return a stream of tokens
+std::istringstream tokenize (const std::string& filename)
+{
+  std::ifstream ifs(filename);
+  EKAT_REQUIRE_MSG (ifs.good(),
+      "Error! Could not open ML model file.\n"
+      " - filename: " + filename + "\n");
+
+  std::string content, line;
+  while (std::getline(ifs,line)) {
+    content += line.substr(0,line.find('#')) + "\n";
+  }
+  return std::istringstream(content);
+}
+
+ColumnMLP::Activation str2act (const std::string& s, const std::string& filename)
+{
+  if (s=="linear" or s=="identity") return ColumnMLP::Linear;
+  if (s=="relu")                    return ColumnMLP::ReLU;
+  if (s=="tanh")                    return ColumnMLP::Tanh;
+  if (s=="sigmoid")                 return ColumnMLP::Sigmoid;
+  EKAT_ERROR_MSG ("Error! Unsupported activation function in ML model file.\n"
+                  " - filename  : " + filename + "\n"
+                  " - activation: " + s + "\n"
+                  " - supported : linear, relu, tanh, sigmoid\n");
+}
+
+KOKKOS_INLINE_FUNCTION
+Real activate (const Real x, const ColumnMLP::Activation act)
+{
+  switch (act) {
+    case ColumnMLP::ReLU:     return x>0 ? x : Real(0);
+    case ColumnMLP::Tanh:     return std::tanh(x);
+    case ColumnMLP::Sigmoid:  return 1 / (1 + std::exp(-x));
+    default:                  return x;
+  }
+}
+
+} // anonymous namespace
+
+void ColumnMLP::load (const std::string& filename)
+{
+  m_filename = filename;
+  auto tokens = tokenize(filename);
+
+  auto check = [&](const bool cond, const std::string& what) {
+    EKAT_REQUIRE_MSG (cond,
+        "Error! Bad format in ML model file.\n"
+        " - filename: " + filename + "\n"
+        " - while reading: " + what + "\n");
+  };
+  auto expect = [&](const std::string& keyword) {
+    std::string s;
+    tokens >> s;
+    check (tokens and s==keyword, "'" + keyword + "' keyword");
+  };
+  auto read_vars = [&](std::vector<Variable>& vars, const std::string& what) {
+    int n;
+    tokens >> n;
+    check (tokens and n>0, "number of " + what);
+    int offset = 0;
+    vars.resize(n);
+    for (auto& v : vars) {
+      tokens >> v.name >> v.size;
+      check (tokens and v.size>0, what + " list");
+      v.offset = offset;
+      offset += v.size;
+    }
+    return offset;
+  };
+  auto read_values = [&](const view_1d<Real>& v, const std::string& what) {
+    auto v_h = Kokkos::create_mirror_view(v);
+    for (size_t i=0; i<v.size(); ++i) {
+      tokens >> v_h(i);
+    }
+    check (static_cast<bool>(tokens), what);
+    Kokkos::deep_copy(v,v_h);
+  };
+
+  expect ("eamxx_column_mlp_v1");
+
+  // Inputs/outputs
+  expect ("inputs");
+  m_num_inputs = read_vars(m_inputs,"inputs");
+  expect ("outputs");
+  m_num_outputs = read_vars(m_outputs,"outputs");
+
+  // Scaling
+  m_in_mean  = view_1d<Real>("",m_num_inputs);
+  m_in_std   = view_1d<Real>("",m_num_inputs);
+  m_out_mean = view_1d<Real>("",m_num_outputs);
+  m_out_std  = view_1d<Real>("",m_num_outputs);
+  expect ("input_scaling");
+  read_values(m_in_mean,"input mean");
+  read_values(m_in_std,"input std");
+  expect ("output_scaling");
+  read_values(m_out_mean,"output mean");
+  read_values(m_out_std,"output std");
+
+  // Layers. Since we don't know the number of params in advance, read them in a std::vector
+  int nlayers;
+  expect ("layers");
+  tokens >> nlayers;
+  check (tokens and nlayers>0, "number of layers");
+
+  auto layers_h = Kokkos::create_mirror_view(view_1d<Layer>("",nlayers));
+  std::vector<Real> params;
+  m_max_width = std::max(m_num_inputs,m_num_outputs);
+  int prev_nout = m_num_inputs;
+  for (int l=0; l<nlayers; ++l) {
+    std::string type, act;
+    auto& layer = layers_h(l);
+    tokens >> type >> layer.nin >> layer.nout >> act;
+    check (tokens and type=="dense", "layer " + std::to_string(l) + " header (only 'dense' layers are supported)");
+    check (layer.nin==prev_nout, "layer " + std::to_string(l) + " input size (mismatch with previous layer)");
+    layer.act = str2act(act,filename);
+
+    const int nw = layer.nin*layer.nout;
+    layer.w_offset = params.size();
+    layer.b_offset = layer.w_offset + nw;
+    params.resize(layer.b_offset + layer.nout);
+    for (int i=0; i<nw+layer.nout; ++i) {
+      tokens >> params[layer.w_offset+i];
+    }
+    check (static_cast<bool>(tokens), "layer " + std::to_string(l) + " weights/bias");
+
+    m_max_width = std::max(m_max_width,layer.nout);
+    prev_nout = layer.nout;
+  }
+  check (prev_nout==m_num_outputs, "last layer output size (mismatch with outputs list)");
+
+  m_layers = view_1d<Layer>("",nlayers);
+  Kokkos::deep_copy(m_layers,layers_h);
+
+  m_params = view_1d<Real>("",params.size());
+  Kokkos::deep_copy(m_params,Kokkos::View<Real*,Kokkos::HostSpace,Kokkos::MemoryUnmanaged>(params.data(),params.size()));
+}
+
+void ColumnMLP::predict (const view_2d<const Real>& x, const view_2d<Real>& y)
+{
+  using MT  = typename KT::MemberType;
+  using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const int ncols = x.extent(0);
+  EKAT_REQUIRE_MSG (x.extent_int(1)==m_num_inputs and y.extent_int(1)==m_num_outputs and y.extent_int(0)==ncols,
+      "Error! Wrong input/output sizes for ML model.\n"
+      " - model file: " + m_filename + "\n"
+      " - x extents : (" + std::to_string(x.extent(0)) + "," + std::to_string(x.extent(1)) + ")\n"
+      " - y extents : (" + std::to_string(y.extent(0)) + "," + std::to_string(y.extent(1)) + ")\n"
+      " - model num inputs : " + std::to_string(m_num_inputs) + "\n"
+      " - model num outputs: " + std::to_string(m_num_outputs) + "\n");
+
+  if (m_work.extent_int(0)<ncols) {
+    m_work = view_2d<Real>("",ncols,2*m_max_width);
+  }
+
+  const int nin      = m_num_inputs;
+  const int nout     = m_num_outputs;
+  const int nlayers  = m_layers.size();
+  const int width    = m_max_width;
+  const auto layers   = m_layers;
+  const auto params   = m_params;
+  const auto in_mean  = m_in_mean;
+  const auto in_std   = m_in_std;
+  const auto out_mean = m_out_mean;
+  const auto out_std  = m_out_std;
+  const auto work     = m_work;
+
+  const auto policy = ESU::get_default_team_policy(ncols,width);
+  Kokkos::parallel_for("ColumnMLP::predict", policy,
+                       KOKKOS_LAMBDA(const MT& team) {
+    const int icol = team.league_rank();
+
+    // Activations of the current layer input/output. Swapped after each layer
+    Real* a_in  = &work(icol,0);
+    Real* a_out = &work(icol,width);
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nin),
+                         [&](const int i) {
+      a_in[i] = (x(icol,i)-in_mean(i)) / in_std(i);
+    });
+    team.team_barrier();
+
+    for (int l=0; l<nlayers; ++l) {
+      const auto& layer = layers(l);
+      const Real* w = &params(layer.w_offset);
+      const Real* b = &params(layer.b_offset);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,layer.nout),
+                           [&](const int o) {
+        const Real* w_o = w + o*layer.nin;
+        Real sum = b[o];
+        for (int i=0; i<layer.nin; ++i) {
+          sum += w_o[i]*a_in[i];
+        }
+        a_out[o] = activate(sum,layer.act);
+      });
+      team.team_barrier();
+
+      Real* tmp = a_in;
+      a_in  = a_out;
+      a_out = tmp;
+    }
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nout),
+                         [&](const int o) {
+      y(icol,o) = a_in[o]*out_std(o) + out_mean(o);
+    });
+  });
+}
+
+} // namespace scream
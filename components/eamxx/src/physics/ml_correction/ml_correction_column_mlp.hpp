@@ -0,0 +1,111 @@
+#ifndef SCREAM_ML_CORRECTION_COLUMN_MLP_HPP
+#define SCREAM_ML_CORRECTION_COLUMN_MLP_HPP
+
+#include "share/scream_types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A simple multilayer perceptron (MLP), applied independently to each column.
+ *
+ * This is the native (Kokkos) inference engine for MLCorrection. Inference is
+ * batched over all the columns of the rank, and runs entirely on device.
+ *
+ * The model is loaded from a text file, with the following format (tokens are
+ * separated by whitespace, and anything following a '#' is a comment):
+ *
+ *   eamxx_column_mlp_v1
+ *   inputs  N                 # followed by N lines "name size"
+ *   outputs M                 # followed by M lines "name size"
+ *   input_scaling             # followed by mean and std of each input entry
+ *   output_scaling            # followed by mean and std of each output entry
+ *   layers L                  # followed by L layers, each being
+ *   dense nin nout act        #   act is one of: linear, relu, tanh, sigmoid
+ *   W(0,0) ... W(nout-1,nin-1)  # weights, stored row-major as (nout,nin)
+ *   b(0) ... b(nout-1)          # bias
+ *
+ * The input (output) of the network is the concatenation of all the input (output)
+ * variables, in the order they are listed. Inputs are normalized as (x-mean)/std,
+ * and outputs are de-normalized as y*std+mean.
+ */
+
+class ColumnMLP {
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  enum Activation : int {
+    Linear = 0,
+    ReLU,
+    Tanh,
+    Sigmoid
+  };
+
+  // A (named) chunk of the input/output vector
+  struct Variable {
+    std::string name;
+    int size;
+    int offset;
+  };
+
+  // A layer of the network. Weights and biases are stored in a single flat array
+  struct Layer {
+    int nin;
+    int nout;
+    int w_offset;
+    int b_offset;
+    Activation act;
+  };
+
+  ColumnMLP () = default;
+  ColumnMLP (const std::string& filename) { load(filename); }
+
+  void load (const std::string& filename);
+
+  const std::vector<Variable>& inputs  () const { return m_inputs;  }
+  const std::vector<Variable>& outputs () const { return m_outputs; }
+
+  const std::string& filename () const { return m_filename; }
+
+  int num_inputs  () const { return m_num_inputs;  }
+  int num_outputs () const { return m_num_outputs; }
+
+  // Evaluate the network on all columns: x is (ncols,num_inputs), y is (ncols,num_outputs)
+  void predict (const view_2d<const Real>& x, const view_2d<Real>& y);
+
+#ifndef KOKKOS_ENABLE_CUDA
+private:
+#endif
+
+  std::string           m_filename;
+
+  std::vector<Variable> m_inputs;
+  std::vector<Variable> m_outputs;
+  int                   m_num_inputs  = 0;
+  int                   m_num_outputs = 0;
+
+  // Layers info, and all weights/biases/scaling data
+  view_1d<Layer>        m_layers;
+  view_1d<Real>         m_params;
+  view_1d<Real>         m_in_mean;
+  view_1d<Real>         m_in_std;
+  view_1d<Real>         m_out_mean;
+  view_1d<Real>         m_out_std;
+
+  // Largest width of the network (to size the work arrays)
+  int                   m_max_width = 0;
+
+  // Work arrays for the activations of two consecutive layers.
+  // Allocated the first time we call predict, and reused afterwards
+  view_2d<Real>         m_work;
+};
+
+} // namespace scream
+
+#endif // SCREAM_ML_CORRECTION_COLUMN_MLP_HPP
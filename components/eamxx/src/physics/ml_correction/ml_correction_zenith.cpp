@@ -0,0 +1,51 @@
+#include "ml_correction_zenith.hpp"
+
+#include "physics/share/physics_constants.hpp"
+
+#include <cmath>
+
+namespace scream {
+
+double days_from_j2000 (const util::TimeStamp& ts) {
+  const util::TimeStamp j2000 ({2000,1,1},{12,0,0});
+  return ts.days_from(j2000);
+}
+
+double cos_zenith_angle (const double days, const double lon, const double lat) {
+  using PC = scream::physics::Constants<double>;
+  constexpr double pi = PC::Pi;
+  constexpr double deg2rad = pi/180;
+  const double jc = days / 36525.0;
+
+  // Greenwich mean sidereal time
+  const double theta = 67310.54841 + jc*(876600*3600.0 + 8640184.812866 + jc*(0.093104 - jc*6.2*10e-6));
+  double gmst = std::fmod(theta/240.0*deg2rad,2*pi);
+  if (gmst<0) {
+    gmst += 2*pi;
+  }
+
+  // Ecliptic longitude of the sun, and obliquity of the ecliptic
+  const double mean_anomaly = deg2rad*(357.52910 + 35999.05030*jc + 0.0001559*jc*jc - 0.00000048*jc*jc*jc);
+  const double mean_lon = deg2rad*(280.46645 + 36000.76983*jc + 0.0003032*jc*jc);
+  const double d_l = deg2rad*((1.914600 - 0.004817*jc - 0.000014*jc*jc)*std::sin(mean_anomaly)
+                              + (0.019993 - 0.000101*jc)*std::sin(2*mean_anomaly)
+                              + 0.000290*std::sin(3*mean_anomaly));
+  const double eclon = mean_lon + d_l;
+  const double obliquity = deg2rad*(23.0 + 26.0/60 + 21.406/3600
+                                    - (46.836769*jc - 0.0001831*jc*jc + 0.00200340*jc*jc*jc
+                                       - 0.576e-6*std::pow(jc,4) - 4.34e-8*std::pow(jc,5))/3600);
+
+  // Right ascension and declination of the sun
+  const double x = std::cos(eclon);
+  const double y = std::cos(obliquity)*std::sin(eclon);
+  const double z = std::sin(obliquity)*std::sin(eclon);
+  const double r = std::sqrt(1 - z*z);
+  const double declination = std::atan2(z,r);
+  const double right_ascension = 2*std::atan2(y,x+r);
+
+  const double hour_angle = gmst + lon*deg2rad - right_ascension;
+  return std::sin(lat*deg2rad)*std::sin(declination)
+       + std::cos(lat*deg2rad)*std::cos(declination)*std::cos(hour_angle);
+}
+
+} // namespace scream
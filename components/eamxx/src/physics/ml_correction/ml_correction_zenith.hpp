@@ -0,0 +1,25 @@
+#ifndef SCREAM_ML_CORRECTION_ZENITH_HPP
+#define SCREAM_ML_CORRECTION_ZENITH_HPP
+
+#include "share/util/scream_time_stamp.hpp"
+
+namespace scream {
+
+/*
+ * Solar zenith angle, as used by the ML correction models.
+ *
+ * The formula is the one of vcm.cos_zenith_angle, which the python ML correction
+ * uses, and which the models were trained with. Time is measured in the model
+ * calendar (see util::TimeStamp), so that a given model date always gets the
+ * same zenith angle, regardless of the leap days since J2000.
+ */
+
+// Days (including fraction) since the J2000 epoch (2000-01-01T12:00:00), in the model calendar
+double days_from_j2000 (const util::TimeStamp& ts);
+
+// Cosine of the solar zenith angle, with lon/lat in degrees
+double cos_zenith_angle (const double days, const double lon, const double lat);
+
+} // namespace scream
+
+#endif // SCREAM_ML_CORRECTION_ZENITH_HPP
@@ -5,7 +5,6 @@
 #include "share/grid/remap/do_nothing_remapper.hpp"
 #include "share/util/scream_utils.hpp"
 
-#include <ekat/util/ekat_lin_interp.hpp>
 #include <ekat/util/ekat_math_utils.hpp>
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
 
@@ -22,6 +21,7 @@ Nudging::Nudging (const ekat::Comm& comm, const ekat::ParameterList& params)
   m_fields_nudge = m_params.get<std::vector<std::string>>("nudging_fields");
   m_use_weights   = m_params.get<bool>("use_nudging_weights",false);
   m_skip_vert_interpolation   = m_params.get<bool>("skip_vert_interpolation",false);
+  m_remap_on_read = m_params.get<bool>("remap_on_read",false);
   // If we are doing horizontal refine-remapping, we need to get the mapfile from user
   m_refine_remap_file = m_params.get<std::string>(
       "nudging_refine_remap_mapfile", "no-file-given");
@@ -236,6 +236,7 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   const auto layout_ext = grid_ext->get_3d_scalar_layout(true);
   const auto layout_tmp = grid_tmp->get_3d_scalar_layout(true);
   const auto layout_atm = m_grid->get_3d_scalar_layout(true);
+  const FieldLayout layout_padded ({COL,LEV},{m_num_cols,m_num_src_levs+2});
   m_horiz_remapper->registration_begins();
   for (auto name : m_fields_nudge) {
     std::string name_ext = name + "_ext";
@@ -259,6 +260,18 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     // Register the fields with the remapper
     m_horiz_remapper->register_field(field_ext, field_tmp);
 
+    if (m_remap_on_read) {
+      // Processed (horiz remapped and padded) data at the two time slices
+      // bracketing the current time. If we skip vert interp, no padding is needed.
+      if (m_skip_vert_interpolation) {
+        create_helper_field(name+"_slice0", layout_tmp, grid_tmp->name());
+        create_helper_field(name+"_slice1", layout_tmp, grid_tmp->name());
+      } else {
+        create_helper_field(name+"_slice0", layout_padded, "");
+        create_helper_field(name+"_slice1", layout_padded, "");
+      }
+    }
+
     if (m_timescale>0) {
       // Third copy of the field: after vert interpolation.
       // We cannot store directly in get_field_out(name),
@@ -271,10 +284,13 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     }
   }
 
-  // A helper field, where we copy each field after horiz remap, padding it
+  // Helper fields, where we copy each field after horiz remap, padding it
   // at top/bot, to allow vert lin interp to extrapolate outside the bounds of p_mid
-  FieldLayout layout_padded ({COL,LEV},{m_num_cols,m_num_src_levs+2});
-  create_helper_field("padded_field",layout_padded,"");
+  if (not m_skip_vert_interpolation) {
+    for (const auto& name : m_fields_nudge) {
+      create_helper_field(name+"_padded",layout_padded,"");
+    }
+  }
 
   if (m_src_pres_type == TIME_DEPENDENT_3D_PROFILE && !m_skip_vert_interpolation) {
     // If the pressure profile is 3d and time-dep, we need to interpolate (in time/horiz)
@@ -289,6 +305,10 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     }
     m_horiz_remapper->register_field(pmid_ext,pmid_tmp);
     create_helper_field("padded_p_mid_tmp",layout_padded,"");
+    if (m_remap_on_read) {
+      create_helper_field("p_mid_slice0",layout_padded,"");
+      create_helper_field("p_mid_slice1",layout_padded,"");
+    }
   } else if (m_src_pres_type == STATIC_1D_VERTICAL_PROFILE) {
     // For static 1D profile, we can read p_mid now
     auto pmid_ext = create_helper_field("p_mid_ext", grid_ext->get_vertical_layout(true), grid_ext->name());
@@ -303,9 +323,25 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     create_helper_field("padded_p_mid_tmp",pmid1d_padded_layout,"");
   }
 
-  // Close the registration
-  m_time_interp.initialize_data_from_files();
+  // The vertical interpolation plan, which computes the brackets/weights for
+  // the (padded) src pressure once per step, and then interpolates all fields at once
+  if (not m_skip_vert_interpolation) {
+    m_vert_interp_plan = std::make_shared<VerticalInterpPlan>(get_helper_field("padded_p_mid_tmp"),
+                                                              get_field_in("p_mid"));
+    for (const auto& name : m_fields_nudge) {
+      m_vert_interp_plan->add_field(get_helper_field(name+"_padded"),get_helper_field(name));
+    }
+  }
+
+  // Close the registration. If we remap on read, the remapper must be ready
+  // before the time interpolator reads the first two slices of data.
   m_horiz_remapper->registration_ends();
+  if (m_remap_on_read) {
+    m_time_interp.set_read_callback([this](const std::map<std::string,Field>& new_data) {
+      process_new_slice(new_data);
+    });
+  }
+  m_time_interp.initialize_data_from_files();
 
   // load nudging weights from file
   // NOTE: the regional nudging use the same grid as the run, no need to
@@ -322,82 +358,39 @@ void Nudging::run_impl (const double dt)
 {
   using KT            = KokkosTypes<DefaultDevice>;
   using RangePolicy   = typename KT::RangePolicy;
-  using MemberType    = typename KT::MemberType;
-  using ESU           = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
-  using PackT         = ekat::Pack<Real,1>;
-  using view_1d       = KT::view_1d<PackT>;
-  using view_2d       = KT::view_2d<PackT>;
 
   // Have to add dt because first time iteration is at 0 seconds where you will
   // not have any data from the field. The timestamp is only iterated at the
   // end of the full step in scream.
   auto ts = timestamp()+dt;
 
-  // Perform time interpolation
-  m_time_interp.perform_time_interpolation(ts);
+  Real weight0 = 0;
+  if (m_remap_on_read) {
+    // Read new data if needed. Each new snap is cured, remapped, and padded
+    // right after being read (see process_new_slice), so all that is left to
+    // do is to time-interpolate the processed slices.
+    weight0 = m_time_interp.update_data_and_get_weight0(ts);
+  } else {
+    // Perform time interpolation
+    m_time_interp.perform_time_interpolation(ts);
 
-  // If the input data contains "masked" values (sometimes also called "filled" values),
-  // the horiz remapping would smear them around. To prevent that, we need to "cure"
-  // these values. Masked values can only happen at top/bot of the model (with top
-  // being not common), and they must be a contiguous set of entries. So to cure them,
-  // we simply set all bot/top masked entries equal to the first non-masked value
-  // from the bot/top respectively. This corresponds to a constant extrapolation.
-  // NOTE: we need to do a tol check, since time interpolation may not return fillValue,
-  //       even if both f(t_beg)/f(t_end) are equal to fillValue (due to rounding).
-  // NOTE: if f(t_beg)==fillValue!=f(t_end), or viceversa, the time-interpolated value can
-  //       substantially differ from fillValue. Here, we assume it didn't happen.
-  auto correct_masked_values = [&](const Field f) {
-    const auto fl = f.get_header().get_identifier().get_layout();
-    const auto v  = f.get_view<Real**>();
-
-    Real var_fill_value = constants::DefaultFillValue<Real>().value;
-    // Query the helper field for the fill value, if not present use default
-    if (f.get_header().has_extra_data("mask_value")) {
-      var_fill_value = f.get_header().get_extra_data<Real>("mask_value");
+    // Correct before horiz remap
+    for (const auto& name: m_fields_nudge) {
+      const auto f  = get_helper_field(name+"_ext");
+      correct_masked_values(f);
     }
 
-    const int ncols = fl.dim(0);
-    const int nlevs = fl.dim(1);
-    const auto thresh = std::abs(var_fill_value)*0.0001;
-    auto lambda = KOKKOS_LAMBDA(const int icol) {
-      int first_good = nlevs;
-      int last_good = -1;
-      for (int k=0; k<nlevs; ++k) {
-        if (std::abs(v(icol,k)-var_fill_value)>thresh) {
-          // This entry is substantially different from var_fill_value, so it's good
-          first_good = ekat::impl::min(first_good,k);
-          last_good  = ekat::impl::max(last_good,k);
-        }
-      }
-      EKAT_KERNEL_REQUIRE_MSG (first_good<nlevs and last_good>=0,
-          "[Nudging] Error! Could not locate a non-masked entry in a column.\n");
-
-      // Fix near TOM
-      for (int k=0; k<first_good; ++k) {
-        v(icol,k) = v(icol,first_good);
-      }
-      // Fix near surf
-      for (int k=last_good+1; k<nlevs; ++k) {
-        v(icol,k) = v(icol,last_good);
-      }
-    };
-
-    Kokkos::parallel_for(RangePolicy(0,ncols),lambda);
-  };
-
-  // Correct before horiz remap
-  for (const auto& name: m_fields_nudge) {
-    const auto f  = get_helper_field(name+"_ext");
-    correct_masked_values(f);
+    // Perform horizontal remap (if needed)
+    m_horiz_remapper->remap(true);
   }
 
-  // Perform horizontal remap (if needed)
-  m_horiz_remapper->remap(true);
-
   // bypass copy_and_pad and vert_interp for skip_vert_interpolation:
   if (m_skip_vert_interpolation) {
     for (const auto& name : m_fields_nudge) {
       auto tmp_state_field = get_helper_field(name+"_tmp");
+      if (m_remap_on_read) {
+        interpolate_slices(name,tmp_state_field,weight0);
+      }
 
       if (m_timescale > 0) {
         auto atm_state_field = get_field_out_wrap(name);
@@ -410,46 +403,15 @@ void Nudging::run_impl (const double dt)
   // Copy remapper tgt fields into padded views, to allow extrapolation at top/bot,
   // then call remapping routines
 
-  const int ncols = m_num_cols;
   const int nlevs_src = m_num_src_levs;
-  auto copy_and_pad = [&](const Field from, const Field to, const bool is_pmid) {
-    auto from_view = from.get_view<const Real**>();
-    auto to_view = to.get_view<Real**>();
-    auto fl = from.get_header().get_identifier().get_layout();
-
-    auto copy_3d = KOKKOS_LAMBDA (const MemberType& team) {
-      int icol = team.league_rank();
-
-      auto copy_col = [&](const int k) {
-        to_view(icol,k+1) = from_view(icol,k);
-      };
-      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_src),copy_col);
-
-      // Set the first/last entries of data, so that linear interp
-      // can extrapolate if the p_tgt is outside the p_src bounds
-      Kokkos::single(Kokkos::PerTeam(team),[&]{
-        to_view(icol,0) = 0; // Does this make sense for *every field*?
-        if (is_pmid) {
-          // For pmid, we put a very large value, so that any p_mid_tgt
-          // that is larger than input p_mid bnds will end up in the
-          // last interval.
-          to_view(icol,nlevs_src+1) = 1e7;
-        } else {
-          // For data, we set last entry equal to second-to-last.
-          // This will cause constant extrapolation outside of
-          // the input p_mid bounds
-          to_view(icol,nlevs_src+1) = from_view(icol,nlevs_src-1);
-        }
-      });
-    };
-
-    auto policy = ESU::get_default_team_policy(ncols,nlevs_src);
-    Kokkos::parallel_for("", policy, copy_3d);
-  };
 
   // First, copy/pad p_mid, and extract the right copy (1d vs 3d)
   if (m_src_pres_type==TIME_DEPENDENT_3D_PROFILE) {
-    copy_and_pad (get_helper_field("p_mid_tmp"),get_helper_field("padded_p_mid_tmp"),true);
+    if (m_remap_on_read) {
+      interpolate_slices("p_mid",get_helper_field("padded_p_mid_tmp"),weight0);
+    } else {
+      copy_and_pad (get_helper_field("p_mid_tmp"),get_helper_field("padded_p_mid_tmp"),true);
+    }
   } else {
     // pmid is a 1d view. Just pad by hand
     auto from = get_helper_field("p_mid_tmp");
@@ -466,78 +428,184 @@ void Nudging::run_impl (const double dt)
     };
     Kokkos::parallel_for(RangePolicy(0,nlevs_src),lambda);
   }
-  const auto& p_mid_v = get_field_in("p_mid").get_view<const PackT**>();
-  view_2d p_mid_tmp_3d;
-  view_1d p_mid_tmp_1d;
-  bool src_pmid_3d;
-  if (m_src_pres_type == TIME_DEPENDENT_3D_PROFILE) {
-    p_mid_tmp_3d = get_helper_field("padded_p_mid_tmp").get_view<PackT**>();
-    src_pmid_3d = true;
-  } else {
-    p_mid_tmp_1d = get_helper_field("padded_p_mid_tmp").get_view<PackT*>();
-    src_pmid_3d = false;
-  }
 
-  // Setup the linear interpolation object
-  using LI = ekat::LinInterp<Real,1>;
-  const int nlevs_tgt = m_num_levs;
-  LI vert_interp(ncols,nlevs_src+2,nlevs_tgt);
-  const auto policy_vinterp = ESU::get_default_team_policy(ncols, nlevs_tgt);
-  auto p_tgt = get_field_in("p_mid").get_view<const PackT**>();
-  Kokkos::parallel_for("nudging_vert_interp_setup_loop", policy_vinterp,
-    KOKKOS_LAMBDA(const MemberType& team) {
-
-    const int icol = team.league_rank();
-
-    // Setup
-    if (src_pmid_3d) {
-      vert_interp.setup(team, ekat::subview(p_mid_tmp_3d,icol),
-                              ekat::subview(p_tgt,icol));
+  // Compute the brackets/weights for the vert interpolation, which are the same for all fields
+  m_vert_interp_plan->setup();
+
+  // Then loop over fields, and do copy_and_pad (or time interp of padded slices)
+  for (const auto& name : m_fields_nudge) {
+    auto padded_field = get_helper_field(name+"_padded");
+    if (m_remap_on_read) {
+      interpolate_slices(name,padded_field,weight0);
     } else {
-      vert_interp.setup(team, p_mid_tmp_1d,
-                              ekat::subview(p_tgt,icol));
+      copy_and_pad(get_helper_field(name+"_tmp"),padded_field,false);
     }
-  });
-  Kokkos::fence();
+  }
 
-  // Then loop over fields, and do copy_and_pad + vremap
-  auto padded_field = get_helper_field("padded_field");
-  for (const auto& name : m_fields_nudge) {
-    copy_and_pad(get_helper_field(name+"_tmp"),padded_field,false);
-
-    auto field_after_vinterp = get_helper_field(name);
-    auto view_in  = padded_field.get_view<const PackT**>();
-    auto view_out = field_after_vinterp.get_view<PackT**>();
-    // Now use the interpolation object in || over all variables.
-    auto vinterp = KOKKOS_LAMBDA(const MemberType& team) {
-      const int icol = team.league_rank();
-
-      view_1d x1;
-      if (src_pmid_3d) {
-        x1 = ekat::subview(p_mid_tmp_3d,icol);
-      } else {
-        x1 = p_mid_tmp_1d;
+  // Vertically interpolate all fields with a single kernel
+  m_vert_interp_plan->apply();
+
+  // If timescale==0, the call get_helper_field(name) returns the same
+  // fields as get_field_out_wrap(name) they are alias, so nothing to do.
+  // If timescale>0, then we need to back out a tendency.
+  if (m_timescale > 0) {
+    for (const auto& name : m_fields_nudge) {
+      auto atm_state_field = get_field_out_wrap(name);
+      apply_tendency(atm_state_field,get_helper_field(name),dt);
+    }
+  }
+}
+
+// =========================================================================================
+void Nudging::correct_masked_values (const Field& f) const
+{
+  using KT          = KokkosTypes<DefaultDevice>;
+  using RangePolicy = typename KT::RangePolicy;
+
+  // If the input data contains "masked" values (sometimes also called "filled" values),
+  // the horiz remapping would smear them around. To prevent that, we need to "cure"
+  // these values. Masked values can only happen at top/bot of the model (with top
+  // being not common), and they must be a contiguous set of entries. So to cure them,
+  // we simply set all bot/top masked entries equal to the first non-masked value
+  // from the bot/top respectively. This corresponds to a constant extrapolation.
+  // NOTE: we need to do a tol check, since time interpolation may not return fillValue,
+  //       even if both f(t_beg)/f(t_end) are equal to fillValue (due to rounding).
+  // NOTE: if f(t_beg)==fillValue!=f(t_end), or viceversa, the time-interpolated value can
+  //       substantially differ from fillValue. Here, we assume it didn't happen.
+  //       This is not a concern if m_remap_on_read=true, since we cure each snap of data.
+  const auto fl = f.get_header().get_identifier().get_layout();
+  const auto v  = f.get_view<Real**>();
+
+  Real var_fill_value = constants::DefaultFillValue<Real>().value;
+  // Query the helper field for the fill value, if not present use default
+  if (f.get_header().has_extra_data("mask_value")) {
+    var_fill_value = f.get_header().get_extra_data<Real>("mask_value");
+  }
+
+  const int ncols = fl.dim(0);
+  const int nlevs = fl.dim(1);
+  const auto thresh = std::abs(var_fill_value)*0.0001;
+  auto lambda = KOKKOS_LAMBDA(const int icol) {
+    int first_good = nlevs;
+    int last_good = -1;
+    for (int k=0; k<nlevs; ++k) {
+      if (std::abs(v(icol,k)-var_fill_value)>thresh) {
+        // This entry is substantially different from var_fill_value, so it's good
+        first_good = ekat::impl::min(first_good,k);
+        last_good  = ekat::impl::max(last_good,k);
       }
-      auto x2 = ekat::subview(p_tgt,icol);
+    }
+    EKAT_KERNEL_REQUIRE_MSG (first_good<nlevs and last_good>=0,
+        "[Nudging] Error! Could not locate a non-masked entry in a column.\n");
+
+    // Fix near TOM
+    for (int k=0; k<first_good; ++k) {
+      v(icol,k) = v(icol,first_good);
+    }
+    // Fix near surf
+    for (int k=last_good+1; k<nlevs; ++k) {
+      v(icol,k) = v(icol,last_good);
+    }
+  };
 
-      auto y1 = ekat::subview(view_in, icol);
-      auto y2 = ekat::subview(view_out,icol);
+  Kokkos::parallel_for(RangePolicy(0,ncols),lambda);
+}
 
-      vert_interp.lin_interp(team, x1, x2, y1, y2, icol);
+// =========================================================================================
+void Nudging::copy_and_pad (const Field& from, const Field& to, const bool is_pmid) const
+{
+  using KT         = KokkosTypes<DefaultDevice>;
+  using MemberType = typename KT::MemberType;
+  using ESU        = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const int ncols = m_num_cols;
+  const int nlevs_src = m_num_src_levs;
+
+  auto from_view = from.get_view<const Real**>();
+  auto to_view = to.get_view<Real**>();
+
+  auto copy_3d = KOKKOS_LAMBDA (const MemberType& team) {
+    int icol = team.league_rank();
+
+    auto copy_col = [&](const int k) {
+      to_view(icol,k+1) = from_view(icol,k);
     };
-    Kokkos::parallel_for("nudging_vert_interp_loop", policy_vinterp, vinterp);
-    Kokkos::fence();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_src),copy_col);
+
+    // Set the first/last entries of data, so that linear interp
+    // can extrapolate if the p_tgt is outside the p_src bounds
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      to_view(icol,0) = 0; // Does this make sense for *every field*?
+      if (is_pmid) {
+        // For pmid, we put a very large value, so that any p_mid_tgt
+        // that is larger than input p_mid bnds will end up in the
+        // last interval.
+        to_view(icol,nlevs_src+1) = 1e7;
+      } else {
+        // For data, we set last entry equal to second-to-last.
+        // This will cause constant extrapolation outside of
+        // the input p_mid bounds
+        to_view(icol,nlevs_src+1) = from_view(icol,nlevs_src-1);
+      }
+    });
+  };
 
-    // If timescale==0, the call get_helper_field(name) returns the same
-    // fields as get_field_out_wrap(name) they are alias, so nothing to do.
-    // If timescale>0, then we need to back out a tendency.
-    if (m_timescale > 0) {
-      auto atm_state_field = get_field_out_wrap(name);
-      apply_tendency(atm_state_field,field_after_vinterp,dt);
+  auto policy = ESU::get_default_team_policy(ncols,nlevs_src);
+  Kokkos::parallel_for("", policy, copy_3d);
+}
+
+// =========================================================================================
+void Nudging::process_new_slice (const std::map<std::string,Field>& new_data)
+{
+  // Since horiz remap (as well as padding) is linear, remapping each snap of data
+  // and then interpolating in time is equivalent to remapping the time-interpolated
+  // data. But it only needs to be done when a new snap is read.
+  const bool pmid_3d = m_src_pres_type==TIME_DEPENDENT_3D_PROFILE and
+                       not m_skip_vert_interpolation;
+
+  // Cure the new data, and copy it in the horiz remapper src fields.
+  // NOTE: we cure the data in place, since it carries the mask value read from file.
+  //       The interpolator's copy is not used for anything else in this mode.
+  for (const auto& name : m_fields_nudge) {
+    const auto& f = new_data.at(name);
+    correct_masked_values(f);
+    get_helper_field(name+"_ext").deep_copy(f);
+  }
+  if (pmid_3d) {
+    get_helper_field("p_mid_ext").deep_copy(new_data.at("p_mid"));
+  }
+
+  m_horiz_remapper->remap(true);
+
+  // The time1 slice becomes the time0 slice, and we store the new data as time1 slice
+  auto store_slice = [&](const std::string& name, const bool is_pmid) {
+    std::swap(m_helper_fields.at(name+"_slice0"),m_helper_fields.at(name+"_slice1"));
+    auto tmp   = get_helper_field(name+"_tmp");
+    auto slice = get_helper_field(name+"_slice1");
+    if (m_skip_vert_interpolation) {
+      slice.deep_copy(tmp);
+    } else {
+      copy_and_pad(tmp,slice,is_pmid);
     }
+  };
+  for (const auto& name : m_fields_nudge) {
+    store_slice(name,false);
+  }
+  if (pmid_3d) {
+    store_slice("p_mid",true);
   }
 }
 
+// =========================================================================================
+void Nudging::interpolate_slices (const std::string& name, const Field& f, const Real weight0) const
+{
+  const auto& slice0 = get_helper_field(name+"_slice0");
+  const auto& slice1 = get_helper_field(name+"_slice1");
+  auto f_out = f;
+  f_out.deep_copy(slice0);
+  f_out.update(slice1,1-weight0,weight0);
+}
+
 // =========================================================================================
 void Nudging::finalize_impl()
 {
@@ -4,6 +4,7 @@
 #include "share/atm_process/atmosphere_process.hpp"
 
 #include "share/util/eamxx_time_interpolation.hpp"
+#include "share/util/eamxx_vertical_interp_plan.hpp"
 #include "share/grid/remap/abstract_remapper.hpp"
 
 #include <ekat/ekat_parameter_list.hpp>
@@ -49,6 +50,15 @@ protected:
   // NOTE: this method will handle weighted and cutoff cases as well
   void apply_tendency (Field &state, const Field &nudge, const Real dt) const;
 
+  // Set all bot/top masked entries of each column equal to the first non-masked value
+  void correct_masked_values (const Field& f) const;
+
+  // Copy a (col,lev) field into a padded one, with an extra level at top/bot
+  void copy_and_pad (const Field& from, const Field& to, const bool is_pmid) const;
+
+  // Remap (and pad) a newly read snap of source data, storing it as the time1 slice
+  void process_new_slice (const std::map<std::string,Field>& new_data);
+
 protected:
 
   Field get_field_out_wrap(const std::string& field_name);
@@ -66,6 +76,9 @@ protected:
   // Retrieve a helper field
   Field get_helper_field (const std::string& name) const { return m_helper_fields.at(name); }
 
+  // Time-interpolate the processed slices of a field into f, given the weight of the time0 slice
+  void interpolate_slices (const std::string& name, const Field& f, const Real weight0) const;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   int m_num_cols;
@@ -74,6 +87,10 @@ protected:
   int m_timescale;
   bool m_use_weights;
   bool m_skip_vert_interpolation;
+  // If true, remap (and pad) each snap of source data once, when it is read, and
+  // do the time interpolation on the target grid. Otherwise, time interpolate on
+  // the source grid, and remap at every step.
+  bool m_remap_on_read;
   std::vector<std::string> m_datafiles;
   std::string              m_static_vertical_pressure_file;
   // add nudging weights for regional nudging update
@@ -96,6 +113,9 @@ protected:
   Real m_refine_remap_vert_cutoff;
 
   util::TimeInterpolation m_time_interp;
+
+  // Vertical interpolation from the (padded) source pressure to the model p_mid
+  std::shared_ptr<VerticalInterpPlan> m_vert_interp_plan;
 }; // class Nudging
 
 } // namespace scream
@@ -364,44 +364,49 @@ TEST_CASE("nudging_tests") {
       }
     };
 
-    ekat::ParameterList params;
-    params.set<strvec_t>("nudging_filenames_patterns",{nudging_data});
-    params.set<std::string>("source_pressure_type","TIME_DEPENDENT_3D_PROFILE");
-    params.set<std::string>("nudging_refine_remap_mapfile",map_file);
-    params.set<strvec_t>("nudging_fields",{"U"});
-    params.get<std::string>("log_level","warn");
+    // Remapping the time-interpolated data or time-interpolating the remapped
+    // data must give the same answer, so run both modes
+    for (bool remap_on_read : {false,true}) {
+      ekat::ParameterList params;
+      params.set<strvec_t>("nudging_filenames_patterns",{nudging_data});
+      params.set<std::string>("source_pressure_type","TIME_DEPENDENT_3D_PROFILE");
+      params.set<std::string>("nudging_refine_remap_mapfile",map_file);
+      params.set<strvec_t>("nudging_fields",{"U"});
+      params.set<bool>("remap_on_read",remap_on_read);
+      params.get<std::string>("log_level","warn");
 
-    // Create fm
-    auto fm = create_fm(grid_fine_h);
-    auto U = fm->get_field("U");
-    auto p_mid = fm->get_field("p_mid");
+      // Create fm
+      auto fm = create_fm(grid_fine_h);
+      auto U = fm->get_field("U");
+      auto p_mid = fm->get_field("p_mid");
 
-    // Create and init nudging process
-    auto nudging = create_nudging(comm,params,fm,gm_fine_h,get_t0());
+      // Create and init nudging process
+      auto nudging = create_nudging(comm,params,fm,gm_fine_h,get_t0());
 
-    // Compute pmid on data grid
-    auto layout_data = grid_data->get_3d_scalar_layout(true);
-    Field p_mid_data(FieldIdentifier("p_mid",layout_data,Pa,grid_data->name()));
-    p_mid_data.allocate_view();
-    compute_field(p_mid_data,get_t0(),comm,0);
+      // Compute pmid on data grid
+      auto layout_data = grid_data->get_3d_scalar_layout(true);
+      Field p_mid_data(FieldIdentifier("p_mid",layout_data,Pa,grid_data->name()));
+      p_mid_data.allocate_view();
+      compute_field(p_mid_data,get_t0(),comm,0);
 
-    manual_interp(p_mid_data,p_mid);
+      manual_interp(p_mid_data,p_mid);
 
-    auto time = get_t0();
-    Field tmp_data = p_mid_data.clone("tmp data");
-    Field tmp_fine = p_mid.clone("tmp fine");
-    for (int n=0; ok and n<nsteps_data; ++n) {
-      // Run nudging
-      nudging->run(dt_data);
+      auto time = get_t0();
+      Field tmp_data = p_mid_data.clone("tmp data");
+      Field tmp_fine = p_mid.clone("tmp fine");
+      for (int n=0; ok and n<nsteps_data; ++n) {
+        // Run nudging
+        nudging->run(dt_data);
 
-      // Compute data on fine grid, by manually interpolating
-      // (recall that nudging runs at t+dt)
-      compute_field(tmp_data,time+dt_data,comm,0);
-      manual_interp(tmp_data,tmp_fine);
+        // Compute data on fine grid, by manually interpolating
+        // (recall that nudging runs at t+dt)
+        compute_field(tmp_data,time+dt_data,comm,0);
+        manual_interp(tmp_data,tmp_fine);
 
-      CHECK (views_are_equal(tmp_fine,U));
-      ok &= catch_capture.lastAssertionPassed();
-      time += dt_data;
+        CHECK (views_are_equal(tmp_fine,U));
+        ok &= catch_capture.lastAssertionPassed();
+        time += dt_data;
+      }
     }
     root_print (msg + (ok ? " PASS\n" : " FAIL\n"));
   }
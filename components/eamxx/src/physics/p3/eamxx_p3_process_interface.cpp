@@ -340,7 +340,7 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   }
 
   // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  P3F::init_kokkos_ice_lookup_tables(get_comm(), lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
   P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
                           lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
                           lookup_tables.dnu_table_vals);
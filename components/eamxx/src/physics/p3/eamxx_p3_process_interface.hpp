@@ -382,6 +382,13 @@ public:
     Spack* wsm_data;
   };
 
+#ifndef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
+protected:
+#endif
+  // Add an estimate of the cost of each column to the physics column cost
+  void report_column_cost () const;
+
 protected:
 
   // The three main overrides for the subcomponent
@@ -1,4 +1,5 @@
 #include "physics/p3/eamxx_p3_process_interface.hpp"
+#include "share/util/eamxx_column_cost.hpp"
 
 namespace scream {
 
@@ -23,6 +24,10 @@ void P3Microphysics::run_impl (const double dt)
   // Reset internal WSM variables.
   workspace_mgr.reset_internals();
 
+  if (column_cost_enabled(m_grid->name())) {
+    report_column_cost();
+  }
+
   // Run p3 main
   get_field_out("micro_liq_ice_exchange").deep_copy(0.0);
   get_field_out("micro_vap_liq_exchange").deep_copy(0.0);
@@ -40,4 +45,34 @@ void P3Microphysics::run_impl (const double dt)
   Kokkos::fence();
 }
 
+void P3Microphysics::report_column_cost () const
+{
+  // p3_main skips most of the work at levels without hydrometeors, so use
+  // the fraction of levels with hydrometeors as the column cost
+  using MemberType = typename KT::MemberType;
+
+  const auto cost = get_column_cost(m_grid->name());
+  const auto qc = get_field_in("qc").get_view<const Pack**>();
+  const auto qr = get_field_in("qr").get_view<const Pack**>();
+  const auto qi = get_field_in("qi").get_view<const Pack**>();
+  const int nlevs   = m_num_levs;
+  const int nk_pack = ekat::npack<Pack>(nlevs);
+  constexpr Real qsmall = PC::QSMALL;
+
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
+  Kokkos::parallel_for("p3_column_cost", policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+    int nactive = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nk_pack), [&](const int k, int& n) {
+      const auto present = qc(icol,k)>=qsmall || qr(icol,k)>=qsmall || qi(icol,k)>=qsmall;
+      for (int s=0; s<Pack::n && k*Pack::n+s<nlevs; ++s) {
+        n += present[s] ? 1 : 0;
+      }
+    }, nactive);
+    Kokkos::single(Kokkos::PerTeam(team), [&] {
+      cost(icol) += static_cast<Real>(nactive)/nlevs;
+    });
+  });
+}
+
 } // namespace scream
@@ -2,6 +2,7 @@
 #define P3_TABLE_ICE_IMPL_HPP
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
+#include "share/util/scream_node_shared_tables.hpp"
 
 #include <fstream>
 
@@ -26,6 +27,41 @@ void Functions<S,D>
   const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
   const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
 
+  read_ice_lookup_tables(ice_table_vals_h, collect_table_vals_h);
+
+  // deep copy to device
+  Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
+  Kokkos::deep_copy(collect_table_vals_d, collect_table_vals_h);
+  ice_table_vals    = ice_table_vals_d;
+  collect_table_vals = collect_table_vals_d;
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(const ekat::Comm& comm,
+                                view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+  // Both tables are read from the same file in one pass. The rank filling the ice table
+  // stashes the collect table, so that the file is read only once.
+  const std::string suffix = "_r" + std::to_string(sizeof(S));
+  view_collect_table_host collect_table_vals_h;
+  ice_table_vals = get_node_shared_table<view_ice_table>("p3_ice_table_vals"+suffix, comm,
+    [&](const view_ice_table_host& ice_table_vals_h) {
+      collect_table_vals_h = view_collect_table_host("collect_table_vals");
+      read_ice_lookup_tables(ice_table_vals_h, collect_table_vals_h);
+    });
+  collect_table_vals = get_node_shared_table<view_collect_table>("p3_collect_table_vals"+suffix, comm,
+    [&](const view_collect_table_host& collect_h) {
+      if (collect_table_vals_h.data()==nullptr) {
+        read_ice_lookup_tables(view_ice_table_host("ice_table_vals"), collect_h);
+      } else {
+        Kokkos::deep_copy(collect_h, collect_table_vals_h);
+      }
+    });
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::read_ice_lookup_tables(const view_ice_table_host& ice_table_vals_h, const view_collect_table_host& collect_table_vals_h) {
   //
   // read in ice microphysics table into host views
   //
@@ -69,12 +105,6 @@ void Functions<S,D>
       }
     }
   }
-
-  // deep copy to device
-  Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
-  Kokkos::deep_copy(collect_table_vals_d, collect_table_vals_h);
-  ice_table_vals    = ice_table_vals_d;
-  collect_table_vals = collect_table_vals_d;
 }
 
 template <typename S, typename D>
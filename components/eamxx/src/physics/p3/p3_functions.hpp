@@ -7,6 +7,7 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
 
 namespace scream {
 namespace p3 {
@@ -271,6 +272,16 @@ struct Functions
   static void init_kokkos_ice_lookup_tables(
     view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
 
+  // Same as above, but the tables are stored once per node, and shared by all ranks of comm
+  static void init_kokkos_ice_lookup_tables(const ekat::Comm& comm,
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
+
+  // Read the ice lookup tables from file into host views
+  using view_ice_table_host     = typename view_ice_table::non_const_type::HostMirror;
+  using view_collect_table_host = typename view_collect_table::non_const_type::HostMirror;
+  static void read_ice_lookup_tables(
+    const view_ice_table_host& ice_table_vals, const view_collect_table_host& collect_table_vals);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
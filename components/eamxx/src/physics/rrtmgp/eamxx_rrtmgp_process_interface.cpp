@@ -9,6 +9,7 @@
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
 #include "share/util/scream_column_ops.hpp"
+#include "share/util/eamxx_column_cost.hpp"
 
 #include "ekat/ekat_assert.hpp"
 
@@ -23,6 +24,14 @@ using KT = KokkosTypes<DefaultDevice>;
 using ExeSpace = KT::ExeSpace;
 using MemberType = KT::MemberType;
 
+namespace {
+// Same as ekat's default team policy, but running on the given execution space instance
+Kokkos::TeamPolicy<ExeSpace> get_team_policy (const ExeSpace& space, const int ni, const int nk) {
+  const auto p = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ni, nk);
+  return Kokkos::TeamPolicy<ExeSpace>(space, ni, p.team_size(), p.impl_vector_length());
+}
+} // anonymous namespace
+
 RRTMGPRadiation::
 RRTMGPRadiation (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
@@ -73,14 +82,19 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   // Figure out radiation column chunks stats
   m_col_chunk_size = std::min(m_params.get("column_chunk_size", m_ncol),m_ncol);
   m_num_col_chunks = (m_ncol+m_col_chunk_size-1) / m_col_chunk_size;
-  m_col_chunk_beg.resize(m_num_col_chunks+1,0);
-  for (int i=0; i<m_num_col_chunks; ++i) {
-    m_col_chunk_beg[i+1] = std::min(m_ncol,m_col_chunk_beg[i] + m_col_chunk_size);
-  }
+
+  // If chunks are pipelined, we need one buffer for each of the prep, solve, and write back stages
+  m_pipeline_col_chunks = m_params.get("pipeline_column_chunks",false);
+#if defined(RRTMGP_ENABLE_YAKL) and defined(RRTMGP_ENABLE_KOKKOS)
+  EKAT_REQUIRE_MSG (not m_pipeline_col_chunks,
+      "Error! Column chunks pipelining is not supported when both YAKL and Kokkos are enabled in RRTMGP.\n");
+#endif
+  m_buffers.resize(m_pipeline_col_chunks ? 3 : 1);
   this->log(LogLevel::debug,
             "[RRTMGP::set_grids] Col chunking stats:\n"
             "  - Chunk size: " + std::to_string(m_col_chunk_size) + "\n"
-            "  - Number of chunks: " + std::to_string(m_num_col_chunks) + "\n");
+            "  - Number of chunks: " + std::to_string(m_num_col_chunks) + "\n"
+            "  - Pipelined: " + std::string(m_pipeline_col_chunks ? "yes" : "no") + "\n");
 
   // Set up dimension layouts
   m_nswgpts = m_params.get<int>("nswgpts",112);
@@ -134,6 +148,12 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   m_extra_clnclrsky_diag = m_params.get<bool>("extra_clnclrsky_diag", false);
   m_extra_clnsky_diag    = m_params.get<bool>("extra_clnsky_diag", false);
 
+  // Fast mode: randomly subsample the g-points of each band
+  m_gpt_sampling_frac = m_params.get<double>("gpoint_sampling_fraction", 1.0);
+  EKAT_REQUIRE_MSG (m_gpt_sampling_frac>0 and m_gpt_sampling_frac<=1,
+      "Error! Invalid value for 'gpoint_sampling_fraction'. Must be in (0,1].\n"
+      "  - gpoint_sampling_fraction: " + std::to_string(m_gpt_sampling_frac) + "\n");
+
   // Set computed (output) fields
   add_field<Updated >("T_mid"     , scalar3d_mid, K  , grid_name);
   add_field<Computed>("SW_flux_dn", scalar3d_int, W/m2, grid_name);
@@ -257,7 +277,7 @@ size_t RRTMGPRadiation::requested_buffer_size_in_bytes() const
     Buffer::num_3d_nlay_nswgpts*m_col_chunk_size*(m_nlay)*m_nswgpts +
     Buffer::num_3d_nlay_nlwgpts*m_col_chunk_size*(m_nlay)*m_nlwgpts;
 
-  return interface_request * sizeof(Real);
+  return m_buffers.size() * interface_request * sizeof(Real);
 } // RRTMGPRadiation::requested_buffer_size
 // =========================================================================================
 
@@ -267,146 +287,152 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
 
   Real* mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
 
+  for (auto& buf : m_buffers) {
+  // Start of this buffer's memory. Each buffer gets its own slice of the
+  // ATM buffer, so pipelined chunks never share memory.
+  Real* const buf_mem = mem;
+
 #ifdef RRTMGP_ENABLE_YAKL
   // 1d arrays
-  m_buffer.mu0 = decltype(m_buffer.mu0)("mu0", mem, m_col_chunk_size);
-  mem += m_buffer.mu0.totElems();
-  m_buffer.sfc_alb_dir_vis = decltype(m_buffer.sfc_alb_dir_vis)("sfc_alb_dir_vis", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dir_vis.totElems();
-  m_buffer.sfc_alb_dir_nir = decltype(m_buffer.sfc_alb_dir_nir)("sfc_alb_dir_nir", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dir_nir.totElems();
-  m_buffer.sfc_alb_dif_vis = decltype(m_buffer.sfc_alb_dif_vis)("sfc_alb_dif_vis", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dif_vis.totElems();
-  m_buffer.sfc_alb_dif_nir = decltype(m_buffer.sfc_alb_dif_nir)("sfc_alb_dif_nir", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dif_nir.totElems();
-  m_buffer.sfc_flux_dir_vis = decltype(m_buffer.sfc_flux_dir_vis)("sfc_flux_dir_vis", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dir_vis.totElems();
-  m_buffer.sfc_flux_dir_nir = decltype(m_buffer.sfc_flux_dir_nir)("sfc_flux_dir_nir", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dir_nir.totElems();
-  m_buffer.sfc_flux_dif_vis = decltype(m_buffer.sfc_flux_dif_vis)("sfc_flux_dif_vis", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dif_vis.totElems();
-  m_buffer.sfc_flux_dif_nir = decltype(m_buffer.sfc_flux_dif_nir)("sfc_flux_dif_nir", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dif_nir.totElems();
-  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_col_chunk_size);
-  mem += m_buffer.cosine_zenith.size();
+  buf.mu0 = decltype(buf.mu0)("mu0", mem, m_col_chunk_size);
+  mem += buf.mu0.totElems();
+  buf.sfc_alb_dir_vis = decltype(buf.sfc_alb_dir_vis)("sfc_alb_dir_vis", mem, m_col_chunk_size);
+  mem += buf.sfc_alb_dir_vis.totElems();
+  buf.sfc_alb_dir_nir = decltype(buf.sfc_alb_dir_nir)("sfc_alb_dir_nir", mem, m_col_chunk_size);
+  mem += buf.sfc_alb_dir_nir.totElems();
+  buf.sfc_alb_dif_vis = decltype(buf.sfc_alb_dif_vis)("sfc_alb_dif_vis", mem, m_col_chunk_size);
+  mem += buf.sfc_alb_dif_vis.totElems();
+  buf.sfc_alb_dif_nir = decltype(buf.sfc_alb_dif_nir)("sfc_alb_dif_nir", mem, m_col_chunk_size);
+  mem += buf.sfc_alb_dif_nir.totElems();
+  buf.sfc_flux_dir_vis = decltype(buf.sfc_flux_dir_vis)("sfc_flux_dir_vis", mem, m_col_chunk_size);
+  mem += buf.sfc_flux_dir_vis.totElems();
+  buf.sfc_flux_dir_nir = decltype(buf.sfc_flux_dir_nir)("sfc_flux_dir_nir", mem, m_col_chunk_size);
+  mem += buf.sfc_flux_dir_nir.totElems();
+  buf.sfc_flux_dif_vis = decltype(buf.sfc_flux_dif_vis)("sfc_flux_dif_vis", mem, m_col_chunk_size);
+  mem += buf.sfc_flux_dif_vis.totElems();
+  buf.sfc_flux_dif_nir = decltype(buf.sfc_flux_dif_nir)("sfc_flux_dif_nir", mem, m_col_chunk_size);
+  mem += buf.sfc_flux_dif_nir.totElems();
+  buf.cosine_zenith = decltype(buf.cosine_zenith)(mem, m_col_chunk_size);
+  mem += buf.cosine_zenith.size();
+  buf.cosine_zenith_h = Kokkos::create_mirror_view(buf.cosine_zenith);
 
   // 2d arrays
-  m_buffer.p_lay = decltype(m_buffer.p_lay)("p_lay", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.p_lay.totElems();
-  m_buffer.t_lay = decltype(m_buffer.t_lay)("t_lay", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.t_lay.totElems();
-  m_buffer.z_del = decltype(m_buffer.z_del)("z_del", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.z_del.totElems();
-  m_buffer.p_del = decltype(m_buffer.p_del)("p_del", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.p_del.totElems();
-  m_buffer.qc = decltype(m_buffer.qc)("qc", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.qc.totElems();
-  m_buffer.nc = decltype(m_buffer.nc)("nc", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.nc.totElems();
-  m_buffer.qi = decltype(m_buffer.qi)("qi", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.qi.totElems();
-  m_buffer.cldfrac_tot = decltype(m_buffer.cldfrac_tot)("cldfrac_tot", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.cldfrac_tot.totElems();
-  m_buffer.eff_radius_qc = decltype(m_buffer.eff_radius_qc)("eff_radius_qc", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.eff_radius_qc.totElems();
-  m_buffer.eff_radius_qi = decltype(m_buffer.eff_radius_qi)("eff_radius_qi", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.eff_radius_qi.totElems();
-  m_buffer.tmp2d = decltype(m_buffer.tmp2d)("tmp2d", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.tmp2d.totElems();
-  m_buffer.lwp = decltype(m_buffer.lwp)("lwp", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.lwp.totElems();
-  m_buffer.iwp = decltype(m_buffer.iwp)("iwp", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.iwp.totElems();
-  m_buffer.sw_heating = decltype(m_buffer.sw_heating)("sw_heating", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.sw_heating.totElems();
-  m_buffer.lw_heating = decltype(m_buffer.lw_heating)("lw_heating", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.lw_heating.totElems();
-  m_buffer.p_lev = decltype(m_buffer.p_lev)("p_lev", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.p_lev.totElems();
-  m_buffer.t_lev = decltype(m_buffer.t_lev)("t_lev", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.t_lev.totElems();
-  m_buffer.d_tint = decltype(m_buffer.d_tint)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.d_tint.size();
-  m_buffer.d_dz  = decltype(m_buffer.d_dz )(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.d_dz.size();
+  buf.p_lay = decltype(buf.p_lay)("p_lay", mem, m_col_chunk_size, m_nlay);
+  mem += buf.p_lay.totElems();
+  buf.t_lay = decltype(buf.t_lay)("t_lay", mem, m_col_chunk_size, m_nlay);
+  mem += buf.t_lay.totElems();
+  buf.z_del = decltype(buf.z_del)("z_del", mem, m_col_chunk_size, m_nlay);
+  mem += buf.z_del.totElems();
+  buf.p_del = decltype(buf.p_del)("p_del", mem, m_col_chunk_size, m_nlay);
+  mem += buf.p_del.totElems();
+  buf.qc = decltype(buf.qc)("qc", mem, m_col_chunk_size, m_nlay);
+  mem += buf.qc.totElems();
+  buf.nc = decltype(buf.nc)("nc", mem, m_col_chunk_size, m_nlay);
+  mem += buf.nc.totElems();
+  buf.qi = decltype(buf.qi)("qi", mem, m_col_chunk_size, m_nlay);
+  mem += buf.qi.totElems();
+  buf.cldfrac_tot = decltype(buf.cldfrac_tot)("cldfrac_tot", mem, m_col_chunk_size, m_nlay);
+  mem += buf.cldfrac_tot.totElems();
+  buf.eff_radius_qc = decltype(buf.eff_radius_qc)("eff_radius_qc", mem, m_col_chunk_size, m_nlay);
+  mem += buf.eff_radius_qc.totElems();
+  buf.eff_radius_qi = decltype(buf.eff_radius_qi)("eff_radius_qi", mem, m_col_chunk_size, m_nlay);
+  mem += buf.eff_radius_qi.totElems();
+  buf.tmp2d = decltype(buf.tmp2d)("tmp2d", mem, m_col_chunk_size, m_nlay);
+  mem += buf.tmp2d.totElems();
+  buf.lwp = decltype(buf.lwp)("lwp", mem, m_col_chunk_size, m_nlay);
+  mem += buf.lwp.totElems();
+  buf.iwp = decltype(buf.iwp)("iwp", mem, m_col_chunk_size, m_nlay);
+  mem += buf.iwp.totElems();
+  buf.sw_heating = decltype(buf.sw_heating)("sw_heating", mem, m_col_chunk_size, m_nlay);
+  mem += buf.sw_heating.totElems();
+  buf.lw_heating = decltype(buf.lw_heating)("lw_heating", mem, m_col_chunk_size, m_nlay);
+  mem += buf.lw_heating.totElems();
+  buf.p_lev = decltype(buf.p_lev)("p_lev", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.p_lev.totElems();
+  buf.t_lev = decltype(buf.t_lev)("t_lev", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.t_lev.totElems();
+  buf.d_tint = decltype(buf.d_tint)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.d_tint.size();
+  buf.d_dz  = decltype(buf.d_dz )(mem, m_col_chunk_size, m_nlay);
+  mem += buf.d_dz.size();
   // 3d arrays
-  m_buffer.sw_flux_up = decltype(m_buffer.sw_flux_up)("sw_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_up.totElems();
-  m_buffer.sw_flux_dn = decltype(m_buffer.sw_flux_dn)("sw_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_dn.totElems();
-  m_buffer.sw_flux_dn_dir = decltype(m_buffer.sw_flux_dn_dir)("sw_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_dn_dir.totElems();
-  m_buffer.lw_flux_up = decltype(m_buffer.lw_flux_up)("lw_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_flux_up.totElems();
-  m_buffer.lw_flux_dn = decltype(m_buffer.lw_flux_dn)("lw_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_flux_dn.totElems();
-  m_buffer.sw_clnclrsky_flux_up = decltype(m_buffer.sw_clnclrsky_flux_up)("sw_clnclrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnclrsky_flux_up.totElems();
-  m_buffer.sw_clnclrsky_flux_dn = decltype(m_buffer.sw_clnclrsky_flux_dn)("sw_clnclrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnclrsky_flux_dn.totElems();
-  m_buffer.sw_clnclrsky_flux_dn_dir = decltype(m_buffer.sw_clnclrsky_flux_dn_dir)("sw_clnclrsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnclrsky_flux_dn_dir.totElems();
-  m_buffer.sw_clrsky_flux_up = decltype(m_buffer.sw_clrsky_flux_up)("sw_clrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_up.totElems();
-  m_buffer.sw_clrsky_flux_dn = decltype(m_buffer.sw_clrsky_flux_dn)("sw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_dn.totElems();
-  m_buffer.sw_clrsky_flux_dn_dir = decltype(m_buffer.sw_clrsky_flux_dn_dir)("sw_clrsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_dn_dir.totElems();
-  m_buffer.sw_clnsky_flux_up = decltype(m_buffer.sw_clnsky_flux_up)("sw_clnsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnsky_flux_up.totElems();
-  m_buffer.sw_clnsky_flux_dn = decltype(m_buffer.sw_clnsky_flux_dn)("sw_clnsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnsky_flux_dn.totElems();
-  m_buffer.sw_clnsky_flux_dn_dir = decltype(m_buffer.sw_clnsky_flux_dn_dir)("sw_clnsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnsky_flux_dn_dir.totElems();
-  m_buffer.lw_clnclrsky_flux_up = decltype(m_buffer.lw_clnclrsky_flux_up)("lw_clnclrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clnclrsky_flux_up.totElems();
-  m_buffer.lw_clnclrsky_flux_dn = decltype(m_buffer.lw_clnclrsky_flux_dn)("lw_clnclrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clnclrsky_flux_dn.totElems();
-  m_buffer.lw_clrsky_flux_up = decltype(m_buffer.lw_clrsky_flux_up)("lw_clrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clrsky_flux_up.totElems();
-  m_buffer.lw_clrsky_flux_dn = decltype(m_buffer.lw_clrsky_flux_dn)("lw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clrsky_flux_dn.totElems();
-  m_buffer.lw_clnsky_flux_up = decltype(m_buffer.lw_clnsky_flux_up)("lw_clnsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clnsky_flux_up.totElems();
-  m_buffer.lw_clnsky_flux_dn = decltype(m_buffer.lw_clnsky_flux_dn)("lw_clnsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clnsky_flux_dn.totElems();
+  buf.sw_flux_up = decltype(buf.sw_flux_up)("sw_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_flux_up.totElems();
+  buf.sw_flux_dn = decltype(buf.sw_flux_dn)("sw_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_flux_dn.totElems();
+  buf.sw_flux_dn_dir = decltype(buf.sw_flux_dn_dir)("sw_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_flux_dn_dir.totElems();
+  buf.lw_flux_up = decltype(buf.lw_flux_up)("lw_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_flux_up.totElems();
+  buf.lw_flux_dn = decltype(buf.lw_flux_dn)("lw_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_flux_dn.totElems();
+  buf.sw_clnclrsky_flux_up = decltype(buf.sw_clnclrsky_flux_up)("sw_clnclrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnclrsky_flux_up.totElems();
+  buf.sw_clnclrsky_flux_dn = decltype(buf.sw_clnclrsky_flux_dn)("sw_clnclrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnclrsky_flux_dn.totElems();
+  buf.sw_clnclrsky_flux_dn_dir = decltype(buf.sw_clnclrsky_flux_dn_dir)("sw_clnclrsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnclrsky_flux_dn_dir.totElems();
+  buf.sw_clrsky_flux_up = decltype(buf.sw_clrsky_flux_up)("sw_clrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clrsky_flux_up.totElems();
+  buf.sw_clrsky_flux_dn = decltype(buf.sw_clrsky_flux_dn)("sw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clrsky_flux_dn.totElems();
+  buf.sw_clrsky_flux_dn_dir = decltype(buf.sw_clrsky_flux_dn_dir)("sw_clrsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clrsky_flux_dn_dir.totElems();
+  buf.sw_clnsky_flux_up = decltype(buf.sw_clnsky_flux_up)("sw_clnsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnsky_flux_up.totElems();
+  buf.sw_clnsky_flux_dn = decltype(buf.sw_clnsky_flux_dn)("sw_clnsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnsky_flux_dn.totElems();
+  buf.sw_clnsky_flux_dn_dir = decltype(buf.sw_clnsky_flux_dn_dir)("sw_clnsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnsky_flux_dn_dir.totElems();
+  buf.lw_clnclrsky_flux_up = decltype(buf.lw_clnclrsky_flux_up)("lw_clnclrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clnclrsky_flux_up.totElems();
+  buf.lw_clnclrsky_flux_dn = decltype(buf.lw_clnclrsky_flux_dn)("lw_clnclrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clnclrsky_flux_dn.totElems();
+  buf.lw_clrsky_flux_up = decltype(buf.lw_clrsky_flux_up)("lw_clrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clrsky_flux_up.totElems();
+  buf.lw_clrsky_flux_dn = decltype(buf.lw_clrsky_flux_dn)("lw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clrsky_flux_dn.totElems();
+  buf.lw_clnsky_flux_up = decltype(buf.lw_clnsky_flux_up)("lw_clnsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clnsky_flux_up.totElems();
+  buf.lw_clnsky_flux_dn = decltype(buf.lw_clnsky_flux_dn)("lw_clnsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clnsky_flux_dn.totElems();
   // 3d arrays with nswbands dimension (shortwave fluxes by band)
-  m_buffer.sw_bnd_flux_up = decltype(m_buffer.sw_bnd_flux_up)("sw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_up.totElems();
-  m_buffer.sw_bnd_flux_dn = decltype(m_buffer.sw_bnd_flux_dn)("sw_bnd_flux_dn", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dn.totElems();
-  m_buffer.sw_bnd_flux_dir = decltype(m_buffer.sw_bnd_flux_dir)("sw_bnd_flux_dir", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dir.totElems();
-  m_buffer.sw_bnd_flux_dif = decltype(m_buffer.sw_bnd_flux_dif)("sw_bnd_flux_dif", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dif.totElems();
+  buf.sw_bnd_flux_up = decltype(buf.sw_bnd_flux_up)("sw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += buf.sw_bnd_flux_up.totElems();
+  buf.sw_bnd_flux_dn = decltype(buf.sw_bnd_flux_dn)("sw_bnd_flux_dn", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += buf.sw_bnd_flux_dn.totElems();
+  buf.sw_bnd_flux_dir = decltype(buf.sw_bnd_flux_dir)("sw_bnd_flux_dir", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += buf.sw_bnd_flux_dir.totElems();
+  buf.sw_bnd_flux_dif = decltype(buf.sw_bnd_flux_dif)("sw_bnd_flux_dif", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += buf.sw_bnd_flux_dif.totElems();
   // 3d arrays with nlwbands dimension (longwave fluxes by band)
-  m_buffer.lw_bnd_flux_up = decltype(m_buffer.lw_bnd_flux_up)("lw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
-  mem += m_buffer.lw_bnd_flux_up.totElems();
-  m_buffer.lw_bnd_flux_dn = decltype(m_buffer.lw_bnd_flux_dn)("lw_bnd_flux_dn", mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
-  mem += m_buffer.lw_bnd_flux_dn.totElems();
+  buf.lw_bnd_flux_up = decltype(buf.lw_bnd_flux_up)("lw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
+  mem += buf.lw_bnd_flux_up.totElems();
+  buf.lw_bnd_flux_dn = decltype(buf.lw_bnd_flux_dn)("lw_bnd_flux_dn", mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
+  mem += buf.lw_bnd_flux_dn.totElems();
   // 2d arrays with extra nswbands dimension (surface albedos by band)
-  m_buffer.sfc_alb_dir = decltype(m_buffer.sfc_alb_dir)("sfc_alb_dir", mem, m_col_chunk_size, m_nswbands);
-  mem += m_buffer.sfc_alb_dir.totElems();
-  m_buffer.sfc_alb_dif = decltype(m_buffer.sfc_alb_dif)("sfc_alb_dif", mem, m_col_chunk_size, m_nswbands);
-  mem += m_buffer.sfc_alb_dif.totElems();
+  buf.sfc_alb_dir = decltype(buf.sfc_alb_dir)("sfc_alb_dir", mem, m_col_chunk_size, m_nswbands);
+  mem += buf.sfc_alb_dir.totElems();
+  buf.sfc_alb_dif = decltype(buf.sfc_alb_dif)("sfc_alb_dif", mem, m_col_chunk_size, m_nswbands);
+  mem += buf.sfc_alb_dif.totElems();
   // 3d arrays with extra band dimension (aerosol optics by band)
-  m_buffer.aero_tau_sw = decltype(m_buffer.aero_tau_sw)("aero_tau_sw", mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_tau_sw.totElems();
-  m_buffer.aero_ssa_sw = decltype(m_buffer.aero_ssa_sw)("aero_ssa_sw", mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_ssa_sw.totElems();
-  m_buffer.aero_g_sw   = decltype(m_buffer.aero_g_sw  )("aero_g_sw"  , mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_g_sw.totElems();
-  m_buffer.aero_tau_lw = decltype(m_buffer.aero_tau_lw)("aero_tau_lw", mem, m_col_chunk_size, m_nlay, m_nlwbands);
-  mem += m_buffer.aero_tau_lw.totElems();
+  buf.aero_tau_sw = decltype(buf.aero_tau_sw)("aero_tau_sw", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += buf.aero_tau_sw.totElems();
+  buf.aero_ssa_sw = decltype(buf.aero_ssa_sw)("aero_ssa_sw", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += buf.aero_ssa_sw.totElems();
+  buf.aero_g_sw   = decltype(buf.aero_g_sw  )("aero_g_sw"  , mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += buf.aero_g_sw.totElems();
+  buf.aero_tau_lw = decltype(buf.aero_tau_lw)("aero_tau_lw", mem, m_col_chunk_size, m_nlay, m_nlwbands);
+  mem += buf.aero_tau_lw.totElems();
   // 3d arrays with extra ngpt dimension (cloud optics by gpoint; primarily for debugging)
-  m_buffer.cld_tau_sw_gpt = decltype(m_buffer.cld_tau_sw_gpt)("cld_tau_sw_gpt", mem, m_col_chunk_size, m_nlay, m_nswgpts);
-  mem += m_buffer.cld_tau_sw_gpt.totElems();
-  m_buffer.cld_tau_lw_gpt = decltype(m_buffer.cld_tau_lw_gpt)("cld_tau_lw_gpt", mem, m_col_chunk_size, m_nlay, m_nlwgpts);
-  mem += m_buffer.cld_tau_lw_gpt.totElems();
-  m_buffer.cld_tau_sw_bnd = decltype(m_buffer.cld_tau_sw_bnd)("cld_tau_sw_bnd", mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.cld_tau_sw_bnd.totElems();
-  m_buffer.cld_tau_lw_bnd = decltype(m_buffer.cld_tau_lw_bnd)("cld_tau_lw_bnd", mem, m_col_chunk_size, m_nlay, m_nlwbands);
-  mem += m_buffer.cld_tau_lw_bnd.totElems();
+  buf.cld_tau_sw_gpt = decltype(buf.cld_tau_sw_gpt)("cld_tau_sw_gpt", mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  mem += buf.cld_tau_sw_gpt.totElems();
+  buf.cld_tau_lw_gpt = decltype(buf.cld_tau_lw_gpt)("cld_tau_lw_gpt", mem, m_col_chunk_size, m_nlay, m_nlwgpts);
+  mem += buf.cld_tau_lw_gpt.totElems();
+  buf.cld_tau_sw_bnd = decltype(buf.cld_tau_sw_bnd)("cld_tau_sw_bnd", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += buf.cld_tau_sw_bnd.totElems();
+  buf.cld_tau_lw_bnd = decltype(buf.cld_tau_lw_bnd)("cld_tau_lw_bnd", mem, m_col_chunk_size, m_nlay, m_nlwbands);
+  mem += buf.cld_tau_lw_bnd.totElems();
 #endif
 
   // During the transition to kokkos, the buffer views/arrays will point to the same memory,
@@ -414,149 +440,156 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   // Example: buff_view(x) += foo;
   // Stuff like this cannot be done twice when both kokkos and yakl are enabled
 #ifdef RRTMGP_ENABLE_KOKKOS
-  mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
+#ifdef RRTMGP_ENABLE_YAKL
+  mem = buf_mem;
+#endif
 
   // 1d arrays
-  m_buffer.mu0_k = decltype(m_buffer.mu0_k)(mem, m_col_chunk_size);
-  mem += m_buffer.mu0_k.size();
-  m_buffer.sfc_alb_dir_vis_k = decltype(m_buffer.sfc_alb_dir_vis_k)(mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dir_vis_k.size();
-  m_buffer.sfc_alb_dir_nir_k = decltype(m_buffer.sfc_alb_dir_nir_k)(mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dir_nir_k.size();
-  m_buffer.sfc_alb_dif_vis_k = decltype(m_buffer.sfc_alb_dif_vis_k)(mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dif_vis_k.size();
-  m_buffer.sfc_alb_dif_nir_k = decltype(m_buffer.sfc_alb_dif_nir_k)(mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dif_nir_k.size();
-  m_buffer.sfc_flux_dir_vis_k = decltype(m_buffer.sfc_flux_dir_vis_k)(mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dir_vis_k.size();
-  m_buffer.sfc_flux_dir_nir_k = decltype(m_buffer.sfc_flux_dir_nir_k)(mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dir_nir_k.size();
-  m_buffer.sfc_flux_dif_vis_k = decltype(m_buffer.sfc_flux_dif_vis_k)(mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dif_vis_k.size();
-  m_buffer.sfc_flux_dif_nir_k = decltype(m_buffer.sfc_flux_dif_nir_k)(mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dif_nir_k.size();
-  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_col_chunk_size);
-  mem += m_buffer.cosine_zenith.size();
+  buf.mu0_k = decltype(buf.mu0_k)(mem, m_col_chunk_size);
+  mem += buf.mu0_k.size();
+  buf.sfc_alb_dir_vis_k = decltype(buf.sfc_alb_dir_vis_k)(mem, m_col_chunk_size);
+  mem += buf.sfc_alb_dir_vis_k.size();
+  buf.sfc_alb_dir_nir_k = decltype(buf.sfc_alb_dir_nir_k)(mem, m_col_chunk_size);
+  mem += buf.sfc_alb_dir_nir_k.size();
+  buf.sfc_alb_dif_vis_k = decltype(buf.sfc_alb_dif_vis_k)(mem, m_col_chunk_size);
+  mem += buf.sfc_alb_dif_vis_k.size();
+  buf.sfc_alb_dif_nir_k = decltype(buf.sfc_alb_dif_nir_k)(mem, m_col_chunk_size);
+  mem += buf.sfc_alb_dif_nir_k.size();
+  buf.sfc_flux_dir_vis_k = decltype(buf.sfc_flux_dir_vis_k)(mem, m_col_chunk_size);
+  mem += buf.sfc_flux_dir_vis_k.size();
+  buf.sfc_flux_dir_nir_k = decltype(buf.sfc_flux_dir_nir_k)(mem, m_col_chunk_size);
+  mem += buf.sfc_flux_dir_nir_k.size();
+  buf.sfc_flux_dif_vis_k = decltype(buf.sfc_flux_dif_vis_k)(mem, m_col_chunk_size);
+  mem += buf.sfc_flux_dif_vis_k.size();
+  buf.sfc_flux_dif_nir_k = decltype(buf.sfc_flux_dif_nir_k)(mem, m_col_chunk_size);
+  mem += buf.sfc_flux_dif_nir_k.size();
+  buf.cosine_zenith = decltype(buf.cosine_zenith)(mem, m_col_chunk_size);
+  mem += buf.cosine_zenith.size();
+  buf.cosine_zenith_h = Kokkos::create_mirror_view(buf.cosine_zenith);
 
   // 2d arrays
-  m_buffer.p_lay_k = decltype(m_buffer.p_lay_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.p_lay_k.size();
-  m_buffer.t_lay_k = decltype(m_buffer.t_lay_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.t_lay_k.size();
-  m_buffer.z_del_k = decltype(m_buffer.z_del_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.z_del_k.size();
-  m_buffer.p_del_k = decltype(m_buffer.p_del_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.p_del_k.size();
-  m_buffer.qc_k = decltype(m_buffer.qc_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.qc_k.size();
-  m_buffer.nc_k = decltype(m_buffer.nc_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.nc_k.size();
-  m_buffer.qi_k = decltype(m_buffer.qi_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.qi_k.size();
-  m_buffer.cldfrac_tot_k = decltype(m_buffer.cldfrac_tot_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.cldfrac_tot_k.size();
-  m_buffer.eff_radius_qc_k = decltype(m_buffer.eff_radius_qc_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.eff_radius_qc_k.size();
-  m_buffer.eff_radius_qi_k = decltype(m_buffer.eff_radius_qi_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.eff_radius_qi_k.size();
-  m_buffer.tmp2d_k = decltype(m_buffer.tmp2d_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.tmp2d_k.size();
-  m_buffer.lwp_k = decltype(m_buffer.lwp_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.lwp_k.size();
-  m_buffer.iwp_k = decltype(m_buffer.iwp_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.iwp_k.size();
-  m_buffer.sw_heating_k = decltype(m_buffer.sw_heating_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.sw_heating_k.size();
-  m_buffer.lw_heating_k = decltype(m_buffer.lw_heating_k)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.lw_heating_k.size();
-  m_buffer.p_lev_k = decltype(m_buffer.p_lev_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.p_lev_k.size();
-  m_buffer.t_lev_k = decltype(m_buffer.t_lev_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.t_lev_k.size();
-  m_buffer.d_tint = decltype(m_buffer.d_tint)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.d_tint.size();
-  m_buffer.d_dz  = decltype(m_buffer.d_dz)(mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.d_dz.size();
+  buf.p_lay_k = decltype(buf.p_lay_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.p_lay_k.size();
+  buf.t_lay_k = decltype(buf.t_lay_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.t_lay_k.size();
+  buf.z_del_k = decltype(buf.z_del_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.z_del_k.size();
+  buf.p_del_k = decltype(buf.p_del_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.p_del_k.size();
+  buf.qc_k = decltype(buf.qc_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.qc_k.size();
+  buf.nc_k = decltype(buf.nc_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.nc_k.size();
+  buf.qi_k = decltype(buf.qi_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.qi_k.size();
+  buf.cldfrac_tot_k = decltype(buf.cldfrac_tot_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.cldfrac_tot_k.size();
+  buf.eff_radius_qc_k = decltype(buf.eff_radius_qc_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.eff_radius_qc_k.size();
+  buf.eff_radius_qi_k = decltype(buf.eff_radius_qi_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.eff_radius_qi_k.size();
+  buf.tmp2d_k = decltype(buf.tmp2d_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.tmp2d_k.size();
+  buf.lwp_k = decltype(buf.lwp_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.lwp_k.size();
+  buf.iwp_k = decltype(buf.iwp_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.iwp_k.size();
+  buf.sw_heating_k = decltype(buf.sw_heating_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.sw_heating_k.size();
+  buf.lw_heating_k = decltype(buf.lw_heating_k)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.lw_heating_k.size();
+  buf.p_lev_k = decltype(buf.p_lev_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.p_lev_k.size();
+  buf.t_lev_k = decltype(buf.t_lev_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.t_lev_k.size();
+  buf.d_tint = decltype(buf.d_tint)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.d_tint.size();
+  buf.d_dz  = decltype(buf.d_dz)(mem, m_col_chunk_size, m_nlay);
+  mem += buf.d_dz.size();
   // 3d arrays
-  m_buffer.sw_flux_up_k = decltype(m_buffer.sw_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_up_k.size();
-  m_buffer.sw_flux_dn_k = decltype(m_buffer.sw_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_dn_k.size();
-  m_buffer.sw_flux_dn_dir_k = decltype(m_buffer.sw_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_dn_dir_k.size();
-  m_buffer.lw_flux_up_k = decltype(m_buffer.lw_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_flux_up_k.size();
-  m_buffer.lw_flux_dn_k = decltype(m_buffer.lw_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_flux_dn_k.size();
-  m_buffer.sw_clnclrsky_flux_up_k = decltype(m_buffer.sw_clnclrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnclrsky_flux_up_k.size();
-  m_buffer.sw_clnclrsky_flux_dn_k = decltype(m_buffer.sw_clnclrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnclrsky_flux_dn_k.size();
-  m_buffer.sw_clnclrsky_flux_dn_dir_k = decltype(m_buffer.sw_clnclrsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnclrsky_flux_dn_dir_k.size();
-  m_buffer.sw_clrsky_flux_up_k = decltype(m_buffer.sw_clrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_up_k.size();
-  m_buffer.sw_clrsky_flux_dn_k = decltype(m_buffer.sw_clrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_dn_k.size();
-  m_buffer.sw_clrsky_flux_dn_dir_k = decltype(m_buffer.sw_clrsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_dn_dir_k.size();
-  m_buffer.sw_clnsky_flux_up_k = decltype(m_buffer.sw_clnsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnsky_flux_up_k.size();
-  m_buffer.sw_clnsky_flux_dn_k = decltype(m_buffer.sw_clnsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnsky_flux_dn_k.size();
-  m_buffer.sw_clnsky_flux_dn_dir_k = decltype(m_buffer.sw_clnsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clnsky_flux_dn_dir_k.size();
-  m_buffer.lw_clnclrsky_flux_up_k = decltype(m_buffer.lw_clnclrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clnclrsky_flux_up_k.size();
-  m_buffer.lw_clnclrsky_flux_dn_k = decltype(m_buffer.lw_clnclrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clnclrsky_flux_dn_k.size();
-  m_buffer.lw_clrsky_flux_up_k = decltype(m_buffer.lw_clrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clrsky_flux_up_k.size();
-  m_buffer.lw_clrsky_flux_dn_k = decltype(m_buffer.lw_clrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clrsky_flux_dn_k.size();
-  m_buffer.lw_clnsky_flux_up_k = decltype(m_buffer.lw_clnsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clnsky_flux_up_k.size();
-  m_buffer.lw_clnsky_flux_dn_k = decltype(m_buffer.lw_clnsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clnsky_flux_dn_k.size();
+  buf.sw_flux_up_k = decltype(buf.sw_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_flux_up_k.size();
+  buf.sw_flux_dn_k = decltype(buf.sw_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_flux_dn_k.size();
+  buf.sw_flux_dn_dir_k = decltype(buf.sw_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_flux_dn_dir_k.size();
+  buf.lw_flux_up_k = decltype(buf.lw_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_flux_up_k.size();
+  buf.lw_flux_dn_k = decltype(buf.lw_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_flux_dn_k.size();
+  buf.sw_clnclrsky_flux_up_k = decltype(buf.sw_clnclrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnclrsky_flux_up_k.size();
+  buf.sw_clnclrsky_flux_dn_k = decltype(buf.sw_clnclrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnclrsky_flux_dn_k.size();
+  buf.sw_clnclrsky_flux_dn_dir_k = decltype(buf.sw_clnclrsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnclrsky_flux_dn_dir_k.size();
+  buf.sw_clrsky_flux_up_k = decltype(buf.sw_clrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clrsky_flux_up_k.size();
+  buf.sw_clrsky_flux_dn_k = decltype(buf.sw_clrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clrsky_flux_dn_k.size();
+  buf.sw_clrsky_flux_dn_dir_k = decltype(buf.sw_clrsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clrsky_flux_dn_dir_k.size();
+  buf.sw_clnsky_flux_up_k = decltype(buf.sw_clnsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnsky_flux_up_k.size();
+  buf.sw_clnsky_flux_dn_k = decltype(buf.sw_clnsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnsky_flux_dn_k.size();
+  buf.sw_clnsky_flux_dn_dir_k = decltype(buf.sw_clnsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.sw_clnsky_flux_dn_dir_k.size();
+  buf.lw_clnclrsky_flux_up_k = decltype(buf.lw_clnclrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clnclrsky_flux_up_k.size();
+  buf.lw_clnclrsky_flux_dn_k = decltype(buf.lw_clnclrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clnclrsky_flux_dn_k.size();
+  buf.lw_clrsky_flux_up_k = decltype(buf.lw_clrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clrsky_flux_up_k.size();
+  buf.lw_clrsky_flux_dn_k = decltype(buf.lw_clrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clrsky_flux_dn_k.size();
+  buf.lw_clnsky_flux_up_k = decltype(buf.lw_clnsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clnsky_flux_up_k.size();
+  buf.lw_clnsky_flux_dn_k = decltype(buf.lw_clnsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  mem += buf.lw_clnsky_flux_dn_k.size();
   // 3d arrays with nswbands dimension (shortwave fluxes by band)
-  m_buffer.sw_bnd_flux_up_k = decltype(m_buffer.sw_bnd_flux_up_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_up_k.size();
-  m_buffer.sw_bnd_flux_dn_k = decltype(m_buffer.sw_bnd_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dn_k.size();
-  m_buffer.sw_bnd_flux_dir_k = decltype(m_buffer.sw_bnd_flux_dir_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dir_k.size();
-  m_buffer.sw_bnd_flux_dif_k = decltype(m_buffer.sw_bnd_flux_dif_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dif_k.size();
+  buf.sw_bnd_flux_up_k = decltype(buf.sw_bnd_flux_up_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += buf.sw_bnd_flux_up_k.size();
+  buf.sw_bnd_flux_dn_k = decltype(buf.sw_bnd_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += buf.sw_bnd_flux_dn_k.size();
+  buf.sw_bnd_flux_dir_k = decltype(buf.sw_bnd_flux_dir_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += buf.sw_bnd_flux_dir_k.size();
+  buf.sw_bnd_flux_dif_k = decltype(buf.sw_bnd_flux_dif_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  mem += buf.sw_bnd_flux_dif_k.size();
   // 3d arrays with nlwbands dimension (longwave fluxes by band)
-  m_buffer.lw_bnd_flux_up_k = decltype(m_buffer.lw_bnd_flux_up_k)(mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
-  mem += m_buffer.lw_bnd_flux_up_k.size();
-  m_buffer.lw_bnd_flux_dn_k = decltype(m_buffer.lw_bnd_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
-  mem += m_buffer.lw_bnd_flux_dn_k.size();
+  buf.lw_bnd_flux_up_k = decltype(buf.lw_bnd_flux_up_k)(mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
+  mem += buf.lw_bnd_flux_up_k.size();
+  buf.lw_bnd_flux_dn_k = decltype(buf.lw_bnd_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
+  mem += buf.lw_bnd_flux_dn_k.size();
   // 2d arrays with extra nswbands dimension (surface albedos by band)
-  m_buffer.sfc_alb_dir_k = decltype(m_buffer.sfc_alb_dir_k)(mem, m_col_chunk_size, m_nswbands);
-  mem += m_buffer.sfc_alb_dir_k.size();
-  m_buffer.sfc_alb_dif_k = decltype(m_buffer.sfc_alb_dif_k)(mem, m_col_chunk_size, m_nswbands);
-  mem += m_buffer.sfc_alb_dif_k.size();
+  buf.sfc_alb_dir_k = decltype(buf.sfc_alb_dir_k)(mem, m_col_chunk_size, m_nswbands);
+  mem += buf.sfc_alb_dir_k.size();
+  buf.sfc_alb_dif_k = decltype(buf.sfc_alb_dif_k)(mem, m_col_chunk_size, m_nswbands);
+  mem += buf.sfc_alb_dif_k.size();
   // 3d arrays with extra band dimension (aerosol optics by band)
-  m_buffer.aero_tau_sw_k = decltype(m_buffer.aero_tau_sw_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_tau_sw_k.size();
-  m_buffer.aero_ssa_sw_k = decltype(m_buffer.aero_ssa_sw_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_ssa_sw_k.size();
-  m_buffer.aero_g_sw_k   = decltype(m_buffer.aero_g_sw_k  )(mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_g_sw_k.size();
-  m_buffer.aero_tau_lw_k = decltype(m_buffer.aero_tau_lw_k)(mem, m_col_chunk_size, m_nlay, m_nlwbands);
-  mem += m_buffer.aero_tau_lw_k.size();
+  buf.aero_tau_sw_k = decltype(buf.aero_tau_sw_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += buf.aero_tau_sw_k.size();
+  buf.aero_ssa_sw_k = decltype(buf.aero_ssa_sw_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += buf.aero_ssa_sw_k.size();
+  buf.aero_g_sw_k   = decltype(buf.aero_g_sw_k  )(mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += buf.aero_g_sw_k.size();
+  buf.aero_tau_lw_k = decltype(buf.aero_tau_lw_k)(mem, m_col_chunk_size, m_nlay, m_nlwbands);
+  mem += buf.aero_tau_lw_k.size();
   // 3d arrays with extra ngpt dimension (cloud optics by gpoint; primarily for debugging)
-  m_buffer.cld_tau_sw_gpt_k = decltype(m_buffer.cld_tau_sw_gpt_k)(mem, m_col_chunk_size, m_nlay, m_nswgpts);
-  mem += m_buffer.cld_tau_sw_gpt_k.size();
-  m_buffer.cld_tau_lw_gpt_k = decltype(m_buffer.cld_tau_lw_gpt_k)(mem, m_col_chunk_size, m_nlay, m_nlwgpts);
-  mem += m_buffer.cld_tau_lw_gpt_k.size();
-  m_buffer.cld_tau_sw_bnd_k = decltype(m_buffer.cld_tau_sw_bnd_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.cld_tau_sw_bnd_k.size();
-  m_buffer.cld_tau_lw_bnd_k = decltype(m_buffer.cld_tau_lw_bnd_k)(mem, m_col_chunk_size, m_nlay, m_nlwbands);
-  mem += m_buffer.cld_tau_lw_bnd_k.size();
+  buf.cld_tau_sw_gpt_k = decltype(buf.cld_tau_sw_gpt_k)(mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  mem += buf.cld_tau_sw_gpt_k.size();
+  buf.cld_tau_lw_gpt_k = decltype(buf.cld_tau_lw_gpt_k)(mem, m_col_chunk_size, m_nlay, m_nlwgpts);
+  mem += buf.cld_tau_lw_gpt_k.size();
+  buf.cld_tau_sw_bnd_k = decltype(buf.cld_tau_sw_bnd_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
+  mem += buf.cld_tau_sw_bnd_k.size();
+  buf.cld_tau_lw_bnd_k = decltype(buf.cld_tau_lw_bnd_k)(mem, m_col_chunk_size, m_nlay, m_nlwbands);
+  mem += buf.cld_tau_lw_bnd_k.size();
 #endif
 
+  EKAT_REQUIRE_MSG (static_cast<size_t>(mem-buf_mem)*sizeof(Real)==requested_buffer_size_in_bytes()/m_buffers.size(),
+      "Error! Memory used by an RRTMGP chunk buffer != requested memory per buffer.\n");
+  } // loop over buffers
+
   size_t used_mem = (reinterpret_cast<Real*>(mem) - buffer_manager.get_memory())*sizeof(Real);
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for RRTMGPRadiation.");
 } // RRTMGPRadiation::init_buffers
@@ -591,6 +624,41 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   // Whether or not to do MCICA subcolumn sampling
   m_do_subcol_sampling = m_params.get<bool>("do_subcol_sampling",true);
 
+  // Adaptive radiation settings
+  m_adaptive_rad = m_params.get<bool>("adaptive_rad",false);
+  m_adaptive_cldfrac_tol     = m_params.get<double>("adaptive_rad_cldfrac_tol",0.1);
+  m_adaptive_water_path_tol  = m_params.get<double>("adaptive_rad_water_path_tol",0.01);
+  m_adaptive_temperature_tol = m_params.get<double>("adaptive_rad_temperature_tol",1.0);
+  EKAT_REQUIRE_MSG (not m_adaptive_rad or m_rad_freq_in_steps>0,
+      "Error! Adaptive radiation requires a positive rad_frequency.\n"
+      " - rad_frequency: " + std::to_string(m_rad_freq_in_steps) + "\n");
+
+  // By default, radiation runs on all columns, in their natural order
+  m_num_rad_cols = 0;
+  m_rad_cols = view_1d_int("rad_cols",m_ncol);
+  m_rad_cols_h = Kokkos::create_mirror_view(m_rad_cols);
+  for (int i=0; i<m_ncol; ++i) {
+    m_rad_cols_h(i) = i;
+  }
+  Kokkos::deep_copy(m_rad_cols,m_rad_cols_h);
+  m_rad_col_updated = view_1d_int("rad_col_updated",m_ncol);
+  if (m_adaptive_rad) {
+    // NOTE: the reference state is zero-initialized, so that all columns are
+    //       flagged at the first step, even if it is not a full radiation step
+    m_rad_ref_cldfrac    = view_2d_real("rad_ref_cldfrac",m_ncol,m_nlay);
+    m_rad_ref_tmid       = view_2d_real("rad_ref_tmid",m_ncol,m_nlay);
+    m_rad_ref_water_path = view_1d_real("rad_ref_water_path",m_ncol);
+    m_chunk_diags        = view_3d_real("chunk_diags",m_buffers.size(),12,m_col_chunk_size);
+  }
+
+  // Execution space instances for the prep and write back stages of the chunks pipeline.
+  // If not pipelining, all stages run on the default instance.
+  if (m_pipeline_col_chunks) {
+    auto instances = Kokkos::Experimental::partition_space(ExeSpace(),1,1);
+    m_prep_space      = instances[0];
+    m_writeback_space = instances[1];
+  }
+
   // Initialize yakl
   init_kls();
 
@@ -754,9 +822,21 @@ void RRTMGPRadiation::run_impl (const double dt) {
   const auto nlwgpts = m_nlwgpts;
   const auto do_aerosol_rad = m_do_aerosol_rad;
 
-  // Are we going to update fluxes and heating this step?
+  // Are we going to update fluxes and heating this step? With adaptive rad, in between
+  // full radiation steps we update only the columns whose state changed enough.
   auto ts = timestamp();
-  auto update_rad = scream::rrtmgp::radiation_do(m_rad_freq_in_steps, ts.get_num_steps());
+  const bool full_rad = scream::rrtmgp::radiation_do(m_rad_freq_in_steps, ts.get_num_steps());
+  if (m_adaptive_rad) {
+    m_num_rad_cols = scream::rrtmgp::flag_changed_columns(
+        d_cldfrac_tot, get_field_in("T_mid").get_view<const Real**>(), d_qc, d_qi, d_pdel,
+        m_rad_ref_cldfrac, m_rad_ref_tmid, m_rad_ref_water_path,
+        m_adaptive_cldfrac_tol, m_adaptive_temperature_tol, m_adaptive_water_path_tol,
+        full_rad, m_rad_col_updated);
+  } else {
+    m_num_rad_cols = full_rad ? m_ncol : 0;
+    Kokkos::deep_copy(m_rad_col_updated, full_rad ? 1 : 0);
+  }
+  const bool update_rad = m_num_rad_cols>0;
 
   if (update_rad) {
     // On each chunk, we internally "reset" the GasConcs object to subview the concs 3d array
@@ -840,12 +920,91 @@ void RRTMGPRadiation::run_impl (const double dt) {
       }
     }
 
-    // Loop over each chunk of columns
-    for (int ic=0; ic<m_num_col_chunks; ++ic) {
-      const int beg  = m_col_chunk_beg[ic];
-      const int ncol = m_col_chunk_beg[ic+1] - beg;
+    // Determine the cosine zenith angle on all columns
+    // NOTE: Since we are bridging to F90 arrays this must be done on HOST.
+    std::vector<Real> mu0_all(m_ncol, m_fixed_solar_zenith_angle);
+    if (m_fixed_solar_zenith_angle <= 0) {
+      // Now use solar declination to calculate zenith angle for all points
+      for (int i=0; i<m_ncol; ++i) {
+        double lat = h_lat(i)*PC::Pi/180.0;  // Convert lat/lon to radians
+        double lon = h_lon(i)*PC::Pi/180.0;
+        mu0_all[i] = shr_orb_cosz_c2f(calday, lat, lon, delta, m_rad_freq_in_steps * dt);
+      }
+    }
+
+    if (column_cost_enabled(m_grid->name())) {
+      // LW is computed on all updated columns, SW only on the sunlit ones
+      auto cost = get_column_cost(m_grid->name());
+      auto h_cost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), cost);
+      auto h_updated = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_rad_col_updated);
+      for (int i=0; i<m_ncol; ++i) {
+        if (h_updated(i)!=0) {
+          h_cost(i) += mu0_all[i]>0 ? 2 : 1;
+        }
+      }
+      Kokkos::deep_copy(cost,h_cost);
+    }
+
+    // With adaptive rad, pack the flagged columns, with daytime columns first.
+    // This way, RRTMGP finds no daytime column in the last chunks, and skips SW.
+    const bool adaptive_rad = m_adaptive_rad;
+    if (adaptive_rad) {
+      auto h_updated = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_rad_col_updated);
+      int nday = 0;
+      for (int i=0; i<m_ncol; ++i) {
+        nday += h_updated(i)!=0 and mu0_all[i]>0;
+      }
+      int iday = 0, inight = nday;
+      for (int i=0; i<m_ncol; ++i) {
+        if (h_updated(i)!=0) {
+          m_rad_cols_h(mu0_all[i]>0 ? iday++ : inight++) = i;
+        }
+      }
+      Kokkos::deep_copy(m_rad_cols,m_rad_cols_h);
+      this->log(LogLevel::debug,
+                "[RRTMGP::run_impl] Adaptive rad columns: " + std::to_string(m_num_rad_cols) +
+                " (day: " + std::to_string(nday) + ", night: " + std::to_string(m_num_rad_cols-nday) + ")\n");
+    }
+    const auto rad_cols = m_rad_cols;
+
+    // Loop over each chunk of columns. Each chunk goes through three stages:
+    //  0) prep: copy inputs from the FieldManager into the chunk buffer
+    //  1) solve: compute optics, fluxes, heating, and cloud diagnostics
+    //  2) write back: copy fluxes from the chunk buffer to the FieldManager
+    // If chunks are pipelined, at each step we issue the prep of chunk ic+1 on its own
+    // execution space instance, then solve chunk ic on the default instance, and finally
+    // write back chunk ic on a third instance, after fencing its solve. Hence, solve and
+    // write back of a chunk do not overlap: the prep of chunk ic+1 overlaps with the solve
+    // of chunk ic, and the write back of chunk ic overlaps with the prep of chunk ic+2
+    // and with the solve of chunk ic+1. For this reason, each stage only fences its own
+    // instance. Since up to three chunks are in flight, each of them uses its own buffer.
+    // Otherwise, all stages of chunk ic are done at once, on the default instance.
+    const int num_col_chunks = (m_num_rad_cols+m_col_chunk_size-1) / m_col_chunk_size;
+    const int lag = m_pipeline_col_chunks ? 1 : 0;
+    const int num_stages = m_pipeline_col_chunks ? 3 : 1;
+    const auto& prep_space  = m_prep_space;
+    const auto  solve_space = ExeSpace();
+    const auto& wb_space    = m_writeback_space;
+    for (int step=0; step<num_col_chunks+lag; ++step) {
+    for (int stage=0; stage<num_stages; ++stage) {
+      const bool do_prep      = num_stages==1 or stage==0;
+      const bool do_solve     = num_stages==1 or stage==1;
+      const bool do_writeback = num_stages==1 or stage==2;
+      const int ic = do_prep ? step : step-lag;
+      if (ic<0 or ic>=num_col_chunks) continue;
+
+      const int ibuf = ic % m_buffers.size();
+      auto& buffer = m_buffers[ibuf];
+      decltype(Kokkos::subview(m_chunk_diags,0,Kokkos::ALL,Kokkos::ALL)) chunk_diags;
+      if (adaptive_rad) {
+        chunk_diags = Kokkos::subview(m_chunk_diags,ibuf,Kokkos::ALL,Kokkos::ALL);
+      }
+      const int beg  = ic*m_col_chunk_size;
+      const int ncol = std::min(m_col_chunk_size, m_num_rad_cols-beg);
+      if (do_solve) {
       this->log(LogLevel::debug,
                 "[RRTMGP::run_impl] Col chunk beg,end: " + std::to_string(beg) + ", " + std::to_string(beg+ncol) + "\n");
+      } // do_solve
 
 
       // Create YAKL arrays. RRTMGP expects YAKL arrays with styleFortran, i.e., data has ncol
@@ -863,63 +1022,63 @@ void RRTMGPRadiation::run_impl (const double dt) {
         return real3d(v.label(),v.myData,ncol,v.dimension[1],v.dimension[2]);
       };
 
-      auto p_lay           = subview_2d(m_buffer.p_lay);
-      auto t_lay           = subview_2d(m_buffer.t_lay);
-      auto p_lev           = subview_2d(m_buffer.p_lev);
-      auto z_del           = subview_2d(m_buffer.z_del);
-      auto p_del           = subview_2d(m_buffer.p_del);
-      auto t_lev           = subview_2d(m_buffer.t_lev);
-      auto mu0             = subview_1d(m_buffer.mu0);
-      auto sfc_alb_dir     = subview_2d(m_buffer.sfc_alb_dir);
-      auto sfc_alb_dif     = subview_2d(m_buffer.sfc_alb_dif);
-      auto sfc_alb_dir_vis = subview_1d(m_buffer.sfc_alb_dir_vis);
-      auto sfc_alb_dir_nir = subview_1d(m_buffer.sfc_alb_dir_nir);
-      auto sfc_alb_dif_vis = subview_1d(m_buffer.sfc_alb_dif_vis);
-      auto sfc_alb_dif_nir = subview_1d(m_buffer.sfc_alb_dif_nir);
-      auto qc              = subview_2d(m_buffer.qc);
-      auto nc              = subview_2d(m_buffer.nc);
-      auto qi              = subview_2d(m_buffer.qi);
-      auto cldfrac_tot     = subview_2d(m_buffer.cldfrac_tot);
-      auto rel             = subview_2d(m_buffer.eff_radius_qc);
-      auto rei             = subview_2d(m_buffer.eff_radius_qi);
-      auto sw_flux_up      = subview_2d(m_buffer.sw_flux_up);
-      auto sw_flux_dn      = subview_2d(m_buffer.sw_flux_dn);
-      auto sw_flux_dn_dir  = subview_2d(m_buffer.sw_flux_dn_dir);
-      auto lw_flux_up      = subview_2d(m_buffer.lw_flux_up);
-      auto lw_flux_dn      = subview_2d(m_buffer.lw_flux_dn);
-      auto sw_clnclrsky_flux_up      = subview_2d(m_buffer.sw_clnclrsky_flux_up);
-      auto sw_clnclrsky_flux_dn      = subview_2d(m_buffer.sw_clnclrsky_flux_dn);
-      auto sw_clnclrsky_flux_dn_dir  = subview_2d(m_buffer.sw_clnclrsky_flux_dn_dir);
-      auto sw_clrsky_flux_up      = subview_2d(m_buffer.sw_clrsky_flux_up);
-      auto sw_clrsky_flux_dn      = subview_2d(m_buffer.sw_clrsky_flux_dn);
-      auto sw_clrsky_flux_dn_dir  = subview_2d(m_buffer.sw_clrsky_flux_dn_dir);
-      auto sw_clnsky_flux_up      = subview_2d(m_buffer.sw_clnsky_flux_up);
-      auto sw_clnsky_flux_dn      = subview_2d(m_buffer.sw_clnsky_flux_dn);
-      auto sw_clnsky_flux_dn_dir  = subview_2d(m_buffer.sw_clnsky_flux_dn_dir);
-      auto lw_clnclrsky_flux_up      = subview_2d(m_buffer.lw_clnclrsky_flux_up);
-      auto lw_clnclrsky_flux_dn      = subview_2d(m_buffer.lw_clnclrsky_flux_dn);
-      auto lw_clrsky_flux_up      = subview_2d(m_buffer.lw_clrsky_flux_up);
-      auto lw_clrsky_flux_dn      = subview_2d(m_buffer.lw_clrsky_flux_dn);
-      auto lw_clnsky_flux_up      = subview_2d(m_buffer.lw_clnsky_flux_up);
-      auto lw_clnsky_flux_dn      = subview_2d(m_buffer.lw_clnsky_flux_dn);
-      auto sw_bnd_flux_up  = subview_3d(m_buffer.sw_bnd_flux_up);
-      auto sw_bnd_flux_dn  = subview_3d(m_buffer.sw_bnd_flux_dn);
-      auto sw_bnd_flux_dir = subview_3d(m_buffer.sw_bnd_flux_dir);
-      auto sw_bnd_flux_dif = subview_3d(m_buffer.sw_bnd_flux_dif);
-      auto lw_bnd_flux_up  = subview_3d(m_buffer.lw_bnd_flux_up);
-      auto lw_bnd_flux_dn  = subview_3d(m_buffer.lw_bnd_flux_dn);
-      auto sfc_flux_dir_vis = subview_1d(m_buffer.sfc_flux_dir_vis);
-      auto sfc_flux_dir_nir = subview_1d(m_buffer.sfc_flux_dir_nir);
-      auto sfc_flux_dif_vis = subview_1d(m_buffer.sfc_flux_dif_vis);
-      auto sfc_flux_dif_nir = subview_1d(m_buffer.sfc_flux_dif_nir);
-      auto aero_tau_sw     = subview_3d(m_buffer.aero_tau_sw);
-      auto aero_ssa_sw     = subview_3d(m_buffer.aero_ssa_sw);
-      auto aero_g_sw       = subview_3d(m_buffer.aero_g_sw);
-      auto aero_tau_lw     = subview_3d(m_buffer.aero_tau_lw);
-      auto cld_tau_sw_bnd  = subview_3d(m_buffer.cld_tau_sw_bnd);
-      auto cld_tau_lw_bnd  = subview_3d(m_buffer.cld_tau_lw_bnd);
-      auto cld_tau_sw_gpt  = subview_3d(m_buffer.cld_tau_sw_gpt);
-      auto cld_tau_lw_gpt  = subview_3d(m_buffer.cld_tau_lw_gpt);
+      auto p_lay           = subview_2d(buffer.p_lay);
+      auto t_lay           = subview_2d(buffer.t_lay);
+      auto p_lev           = subview_2d(buffer.p_lev);
+      auto z_del           = subview_2d(buffer.z_del);
+      auto p_del           = subview_2d(buffer.p_del);
+      auto t_lev           = subview_2d(buffer.t_lev);
+      auto mu0             = subview_1d(buffer.mu0);
+      auto sfc_alb_dir     = subview_2d(buffer.sfc_alb_dir);
+      auto sfc_alb_dif     = subview_2d(buffer.sfc_alb_dif);
+      auto sfc_alb_dir_vis = subview_1d(buffer.sfc_alb_dir_vis);
+      auto sfc_alb_dir_nir = subview_1d(buffer.sfc_alb_dir_nir);
+      auto sfc_alb_dif_vis = subview_1d(buffer.sfc_alb_dif_vis);
+      auto sfc_alb_dif_nir = subview_1d(buffer.sfc_alb_dif_nir);
+      auto qc              = subview_2d(buffer.qc);
+      auto nc              = subview_2d(buffer.nc);
+      auto qi              = subview_2d(buffer.qi);
+      auto cldfrac_tot     = subview_2d(buffer.cldfrac_tot);
+      auto rel             = subview_2d(buffer.eff_radius_qc);
+      auto rei             = subview_2d(buffer.eff_radius_qi);
+      auto sw_flux_up      = subview_2d(buffer.sw_flux_up);
+      auto sw_flux_dn      = subview_2d(buffer.sw_flux_dn);
+      auto sw_flux_dn_dir  = subview_2d(buffer.sw_flux_dn_dir);
+      auto lw_flux_up      = subview_2d(buffer.lw_flux_up);
+      auto lw_flux_dn      = subview_2d(buffer.lw_flux_dn);
+      auto sw_clnclrsky_flux_up      = subview_2d(buffer.sw_clnclrsky_flux_up);
+      auto sw_clnclrsky_flux_dn      = subview_2d(buffer.sw_clnclrsky_flux_dn);
+      auto sw_clnclrsky_flux_dn_dir  = subview_2d(buffer.sw_clnclrsky_flux_dn_dir);
+      auto sw_clrsky_flux_up      = subview_2d(buffer.sw_clrsky_flux_up);
+      auto sw_clrsky_flux_dn      = subview_2d(buffer.sw_clrsky_flux_dn);
+      auto sw_clrsky_flux_dn_dir  = subview_2d(buffer.sw_clrsky_flux_dn_dir);
+      auto sw_clnsky_flux_up      = subview_2d(buffer.sw_clnsky_flux_up);
+      auto sw_clnsky_flux_dn      = subview_2d(buffer.sw_clnsky_flux_dn);
+      auto sw_clnsky_flux_dn_dir  = subview_2d(buffer.sw_clnsky_flux_dn_dir);
+      auto lw_clnclrsky_flux_up      = subview_2d(buffer.lw_clnclrsky_flux_up);
+      auto lw_clnclrsky_flux_dn      = subview_2d(buffer.lw_clnclrsky_flux_dn);
+      auto lw_clrsky_flux_up      = subview_2d(buffer.lw_clrsky_flux_up);
+      auto lw_clrsky_flux_dn      = subview_2d(buffer.lw_clrsky_flux_dn);
+      auto lw_clnsky_flux_up      = subview_2d(buffer.lw_clnsky_flux_up);
+      auto lw_clnsky_flux_dn      = subview_2d(buffer.lw_clnsky_flux_dn);
+      auto sw_bnd_flux_up  = subview_3d(buffer.sw_bnd_flux_up);
+      auto sw_bnd_flux_dn  = subview_3d(buffer.sw_bnd_flux_dn);
+      auto sw_bnd_flux_dir = subview_3d(buffer.sw_bnd_flux_dir);
+      auto sw_bnd_flux_dif = subview_3d(buffer.sw_bnd_flux_dif);
+      auto lw_bnd_flux_up  = subview_3d(buffer.lw_bnd_flux_up);
+      auto lw_bnd_flux_dn  = subview_3d(buffer.lw_bnd_flux_dn);
+      auto sfc_flux_dir_vis = subview_1d(buffer.sfc_flux_dir_vis);
+      auto sfc_flux_dir_nir = subview_1d(buffer.sfc_flux_dir_nir);
+      auto sfc_flux_dif_vis = subview_1d(buffer.sfc_flux_dif_vis);
+      auto sfc_flux_dif_nir = subview_1d(buffer.sfc_flux_dif_nir);
+      auto aero_tau_sw     = subview_3d(buffer.aero_tau_sw);
+      auto aero_ssa_sw     = subview_3d(buffer.aero_ssa_sw);
+      auto aero_g_sw       = subview_3d(buffer.aero_g_sw);
+      auto aero_tau_lw     = subview_3d(buffer.aero_tau_lw);
+      auto cld_tau_sw_bnd  = subview_3d(buffer.cld_tau_sw_bnd);
+      auto cld_tau_lw_bnd  = subview_3d(buffer.cld_tau_lw_bnd);
+      auto cld_tau_sw_gpt  = subview_3d(buffer.cld_tau_sw_gpt);
+      auto cld_tau_lw_gpt  = subview_3d(buffer.cld_tau_lw_gpt);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
       // If YAKL is on, we don't want aliased memory in both the yakl and kokos
@@ -955,103 +1114,85 @@ void RRTMGPRadiation::run_impl (const double dt) {
 #endif
       };
 
-      auto p_lay_k           = subview_2dk(m_buffer.p_lay_k);
-      auto t_lay_k           = subview_2dk(m_buffer.t_lay_k);
-      auto p_lev_k           = subview_2dk(m_buffer.p_lev_k);
-      auto z_del_k           = subview_2dk(m_buffer.z_del_k);
-      auto p_del_k           = subview_2dk(m_buffer.p_del_k);
-      auto t_lev_k           = subview_2dk(m_buffer.t_lev_k);
-      auto mu0_k             = subview_1dk(m_buffer.mu0_k);
-      auto sfc_alb_dir_k     = subview_2dk(m_buffer.sfc_alb_dir_k);
-      auto sfc_alb_dif_k     = subview_2dk(m_buffer.sfc_alb_dif_k);
-      auto sfc_alb_dir_vis_k = subview_1dk(m_buffer.sfc_alb_dir_vis_k);
-      auto sfc_alb_dir_nir_k = subview_1dk(m_buffer.sfc_alb_dir_nir_k);
-      auto sfc_alb_dif_vis_k = subview_1dk(m_buffer.sfc_alb_dif_vis_k);
-      auto sfc_alb_dif_nir_k = subview_1dk(m_buffer.sfc_alb_dif_nir_k);
-      auto qc_k              = subview_2dk(m_buffer.qc_k);
-      auto nc_k              = subview_2dk(m_buffer.nc_k);
-      auto qi_k              = subview_2dk(m_buffer.qi_k);
-      auto cldfrac_tot_k     = subview_2dk(m_buffer.cldfrac_tot_k);
-      auto rel_k             = subview_2dk(m_buffer.eff_radius_qc_k);
-      auto rei_k             = subview_2dk(m_buffer.eff_radius_qi_k);
-      auto sw_flux_up_k      = subview_2dk(m_buffer.sw_flux_up_k);
-      auto sw_flux_dn_k      = subview_2dk(m_buffer.sw_flux_dn_k);
-      auto sw_flux_dn_dir_k  = subview_2dk(m_buffer.sw_flux_dn_dir_k);
-      auto lw_flux_up_k      = subview_2dk(m_buffer.lw_flux_up_k);
-      auto lw_flux_dn_k      = subview_2dk(m_buffer.lw_flux_dn_k);
-      auto sw_clnclrsky_flux_up_k      = subview_2dk(m_buffer.sw_clnclrsky_flux_up_k);
-      auto sw_clnclrsky_flux_dn_k      = subview_2dk(m_buffer.sw_clnclrsky_flux_dn_k);
-      auto sw_clnclrsky_flux_dn_dir_k  = subview_2dk(m_buffer.sw_clnclrsky_flux_dn_dir_k);
-      auto sw_clrsky_flux_up_k      = subview_2dk(m_buffer.sw_clrsky_flux_up_k);
-      auto sw_clrsky_flux_dn_k      = subview_2dk(m_buffer.sw_clrsky_flux_dn_k);
-      auto sw_clrsky_flux_dn_dir_k  = subview_2dk(m_buffer.sw_clrsky_flux_dn_dir_k);
-      auto sw_clnsky_flux_up_k      = subview_2dk(m_buffer.sw_clnsky_flux_up_k);
-      auto sw_clnsky_flux_dn_k      = subview_2dk(m_buffer.sw_clnsky_flux_dn_k);
-      auto sw_clnsky_flux_dn_dir_k  = subview_2dk(m_buffer.sw_clnsky_flux_dn_dir_k);
-      auto lw_clnclrsky_flux_up_k      = subview_2dk(m_buffer.lw_clnclrsky_flux_up_k);
-      auto lw_clnclrsky_flux_dn_k      = subview_2dk(m_buffer.lw_clnclrsky_flux_dn_k);
-      auto lw_clrsky_flux_up_k      = subview_2dk(m_buffer.lw_clrsky_flux_up_k);
-      auto lw_clrsky_flux_dn_k      = subview_2dk(m_buffer.lw_clrsky_flux_dn_k);
-      auto lw_clnsky_flux_up_k      = subview_2dk(m_buffer.lw_clnsky_flux_up_k);
-      auto lw_clnsky_flux_dn_k      = subview_2dk(m_buffer.lw_clnsky_flux_dn_k);
-      auto sw_bnd_flux_up_k  = subview_3dk(m_buffer.sw_bnd_flux_up_k);
-      auto sw_bnd_flux_dn_k  = subview_3dk(m_buffer.sw_bnd_flux_dn_k);
-      auto sw_bnd_flux_dir_k = subview_3dk(m_buffer.sw_bnd_flux_dir_k);
-      auto sw_bnd_flux_dif_k = subview_3dk(m_buffer.sw_bnd_flux_dif_k);
-      auto lw_bnd_flux_up_k  = subview_3dk(m_buffer.lw_bnd_flux_up_k);
-      auto lw_bnd_flux_dn_k  = subview_3dk(m_buffer.lw_bnd_flux_dn_k);
-      auto sfc_flux_dir_vis_k = subview_1dk(m_buffer.sfc_flux_dir_vis_k);
-      auto sfc_flux_dir_nir_k = subview_1dk(m_buffer.sfc_flux_dir_nir_k);
-      auto sfc_flux_dif_vis_k = subview_1dk(m_buffer.sfc_flux_dif_vis_k);
-      auto sfc_flux_dif_nir_k = subview_1dk(m_buffer.sfc_flux_dif_nir_k);
-      auto aero_tau_sw_k     = subview_3dk(m_buffer.aero_tau_sw_k);
-      auto aero_ssa_sw_k     = subview_3dk(m_buffer.aero_ssa_sw_k);
-      auto aero_g_sw_k       = subview_3dk(m_buffer.aero_g_sw_k);
-      auto aero_tau_lw_k     = subview_3dk(m_buffer.aero_tau_lw_k);
-      auto cld_tau_sw_bnd_k  = subview_3dk(m_buffer.cld_tau_sw_bnd_k);
-      auto cld_tau_lw_bnd_k  = subview_3dk(m_buffer.cld_tau_lw_bnd_k);
-      auto cld_tau_sw_gpt_k  = subview_3dk(m_buffer.cld_tau_sw_gpt_k);
-      auto cld_tau_lw_gpt_k  = subview_3dk(m_buffer.cld_tau_lw_gpt_k);
+      auto p_lay_k           = subview_2dk(buffer.p_lay_k);
+      auto t_lay_k           = subview_2dk(buffer.t_lay_k);
+      auto p_lev_k           = subview_2dk(buffer.p_lev_k);
+      auto z_del_k           = subview_2dk(buffer.z_del_k);
+      auto p_del_k           = subview_2dk(buffer.p_del_k);
+      auto t_lev_k           = subview_2dk(buffer.t_lev_k);
+      auto mu0_k             = subview_1dk(buffer.mu0_k);
+      auto sfc_alb_dir_k     = subview_2dk(buffer.sfc_alb_dir_k);
+      auto sfc_alb_dif_k     = subview_2dk(buffer.sfc_alb_dif_k);
+      auto sfc_alb_dir_vis_k = subview_1dk(buffer.sfc_alb_dir_vis_k);
+      auto sfc_alb_dir_nir_k = subview_1dk(buffer.sfc_alb_dir_nir_k);
+      auto sfc_alb_dif_vis_k = subview_1dk(buffer.sfc_alb_dif_vis_k);
+      auto sfc_alb_dif_nir_k = subview_1dk(buffer.sfc_alb_dif_nir_k);
+      auto qc_k              = subview_2dk(buffer.qc_k);
+      auto nc_k              = subview_2dk(buffer.nc_k);
+      auto qi_k              = subview_2dk(buffer.qi_k);
+      auto cldfrac_tot_k     = subview_2dk(buffer.cldfrac_tot_k);
+      auto rel_k             = subview_2dk(buffer.eff_radius_qc_k);
+      auto rei_k             = subview_2dk(buffer.eff_radius_qi_k);
+      auto sw_flux_up_k      = subview_2dk(buffer.sw_flux_up_k);
+      auto sw_flux_dn_k      = subview_2dk(buffer.sw_flux_dn_k);
+      auto sw_flux_dn_dir_k  = subview_2dk(buffer.sw_flux_dn_dir_k);
+      auto lw_flux_up_k      = subview_2dk(buffer.lw_flux_up_k);
+      auto lw_flux_dn_k      = subview_2dk(buffer.lw_flux_dn_k);
+      auto sw_clnclrsky_flux_up_k      = subview_2dk(buffer.sw_clnclrsky_flux_up_k);
+      auto sw_clnclrsky_flux_dn_k      = subview_2dk(buffer.sw_clnclrsky_flux_dn_k);
+      auto sw_clnclrsky_flux_dn_dir_k  = subview_2dk(buffer.sw_clnclrsky_flux_dn_dir_k);
+      auto sw_clrsky_flux_up_k      = subview_2dk(buffer.sw_clrsky_flux_up_k);
+      auto sw_clrsky_flux_dn_k      = subview_2dk(buffer.sw_clrsky_flux_dn_k);
+      auto sw_clrsky_flux_dn_dir_k  = subview_2dk(buffer.sw_clrsky_flux_dn_dir_k);
+      auto sw_clnsky_flux_up_k      = subview_2dk(buffer.sw_clnsky_flux_up_k);
+      auto sw_clnsky_flux_dn_k      = subview_2dk(buffer.sw_clnsky_flux_dn_k);
+      auto sw_clnsky_flux_dn_dir_k  = subview_2dk(buffer.sw_clnsky_flux_dn_dir_k);
+      auto lw_clnclrsky_flux_up_k      = subview_2dk(buffer.lw_clnclrsky_flux_up_k);
+      auto lw_clnclrsky_flux_dn_k      = subview_2dk(buffer.lw_clnclrsky_flux_dn_k);
+      auto lw_clrsky_flux_up_k      = subview_2dk(buffer.lw_clrsky_flux_up_k);
+      auto lw_clrsky_flux_dn_k      = subview_2dk(buffer.lw_clrsky_flux_dn_k);
+      auto lw_clnsky_flux_up_k      = subview_2dk(buffer.lw_clnsky_flux_up_k);
+      auto lw_clnsky_flux_dn_k      = subview_2dk(buffer.lw_clnsky_flux_dn_k);
+      auto sw_bnd_flux_up_k  = subview_3dk(buffer.sw_bnd_flux_up_k);
+      auto sw_bnd_flux_dn_k  = subview_3dk(buffer.sw_bnd_flux_dn_k);
+      auto sw_bnd_flux_dir_k = subview_3dk(buffer.sw_bnd_flux_dir_k);
+      auto sw_bnd_flux_dif_k = subview_3dk(buffer.sw_bnd_flux_dif_k);
+      auto lw_bnd_flux_up_k  = subview_3dk(buffer.lw_bnd_flux_up_k);
+      auto lw_bnd_flux_dn_k  = subview_3dk(buffer.lw_bnd_flux_dn_k);
+      auto sfc_flux_dir_vis_k = subview_1dk(buffer.sfc_flux_dir_vis_k);
+      auto sfc_flux_dir_nir_k = subview_1dk(buffer.sfc_flux_dir_nir_k);
+      auto sfc_flux_dif_vis_k = subview_1dk(buffer.sfc_flux_dif_vis_k);
+      auto sfc_flux_dif_nir_k = subview_1dk(buffer.sfc_flux_dif_nir_k);
+      auto aero_tau_sw_k     = subview_3dk(buffer.aero_tau_sw_k);
+      auto aero_ssa_sw_k     = subview_3dk(buffer.aero_ssa_sw_k);
+      auto aero_g_sw_k       = subview_3dk(buffer.aero_g_sw_k);
+      auto aero_tau_lw_k     = subview_3dk(buffer.aero_tau_lw_k);
+      auto cld_tau_sw_bnd_k  = subview_3dk(buffer.cld_tau_sw_bnd_k);
+      auto cld_tau_lw_bnd_k  = subview_3dk(buffer.cld_tau_lw_bnd_k);
+      auto cld_tau_sw_gpt_k  = subview_3dk(buffer.cld_tau_sw_gpt_k);
+      auto cld_tau_lw_gpt_k  = subview_3dk(buffer.cld_tau_lw_gpt_k);
 #endif
-      auto d_tint = m_buffer.d_tint;
-      auto d_dz = m_buffer.d_dz;
-
+      auto d_tint = buffer.d_tint;
+      auto d_dz = buffer.d_dz;
 
-      // Set gas concs to "view" only the first ncol columns
-#ifdef RRTMGP_ENABLE_YAKL
-      m_gas_concs.ncol = ncol;
-      m_gas_concs.concs = subview_3d(gas_concs);
-#endif
-#ifdef RRTMGP_ENABLE_KOKKOS
-      m_gas_concs_k.ncol = ncol;
-      m_gas_concs_k.concs = subview_3dk(gas_concs_k);
-#endif
+      if (do_prep) {
+      // Make sure the previous prep is done before we start the next one
+      prep_space.fence();
 
       // Copy data from the FieldManager to the YAKL arrays
       {
-        // Determine the cosine zenith angle
-        // NOTE: Since we are bridging to F90 arrays this must be done on HOST and then
-        //       deep copied to a device view.
-        auto d_mu0 = m_buffer.cosine_zenith;
-        auto h_mu0 = Kokkos::create_mirror_view(d_mu0);
-        if (m_fixed_solar_zenith_angle > 0) {
-          for (int i=0; i<ncol; i++) {
-            h_mu0(i) = m_fixed_solar_zenith_angle;
-          }
-        } else {
-          // Now use solar declination to calculate zenith angle for all points
-          for (int i=0;i<ncol;i++) {
-            double lat = h_lat(i+beg)*PC::Pi/180.0;  // Convert lat/lon to radians
-            double lon = h_lon(i+beg)*PC::Pi/180.0;
-            h_mu0(i) = shr_orb_cosz_c2f(calday, lat, lon, delta, m_rad_freq_in_steps * dt);
-          }
+        // Copy the chunk cosine zenith angle to device
+        auto d_mu0 = buffer.cosine_zenith;
+        auto h_mu0 = buffer.cosine_zenith_h;
+        for (int i=0; i<ncol; i++) {
+          h_mu0(i) = mu0_all[m_rad_cols_h(i+beg)];
         }
-        Kokkos::deep_copy(d_mu0,h_mu0);
+        Kokkos::deep_copy(prep_space,d_mu0,h_mu0);
 
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
+        const auto policy = get_team_policy(prep_space, ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
-          const int icol = i+beg;
+          const int icol = rad_cols(i+beg);
 
           // Calculate dz
           const auto pseudo_density = ekat::subview(d_pdel, icol);
@@ -1191,22 +1332,33 @@ void RRTMGPRadiation::run_impl (const double dt) {
 #endif
         });
       }
-      Kokkos::fence();
+      } // do_prep
+
+      if (do_solve) {
 #ifdef RRTMGP_ENABLE_KOKKOS
       COMPARE_ALL_WRAP(std::vector<real3d>({aero_tau_sw, aero_ssa_sw, aero_g_sw, aero_tau_lw}),
                        std::vector<real3dk>({aero_tau_sw_k, aero_ssa_sw_k, aero_g_sw_k, aero_tau_lw_k}));
 #endif
 
+      // Set gas concs to "view" only the first ncol columns
+#ifdef RRTMGP_ENABLE_YAKL
+      m_gas_concs.ncol = ncol;
+      m_gas_concs.concs = subview_3d(gas_concs);
+#endif
+#ifdef RRTMGP_ENABLE_KOKKOS
+      m_gas_concs_k.ncol = ncol;
+      m_gas_concs_k.concs = subview_3dk(gas_concs_k);
+#endif
 
       // Populate GasConcs object to pass to RRTMGP driver
       // set_vmr requires the input array size to have the correct size,
       // and the last chunk may have less columns, so create a temp of
-      // correct size that uses m_buffer.tmp2d's pointer
+      // correct size that uses buffer.tmp2d's pointer
 #ifdef RRTMGP_ENABLE_YAKL
-      real2d tmp2d = subview_2d(m_buffer.tmp2d);
+      real2d tmp2d = subview_2d(buffer.tmp2d);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
-      real2dk tmp2d_k = subview_2dk(m_buffer.tmp2d_k);
+      real2dk tmp2d_k = subview_2dk(buffer.tmp2d_k);
 #endif
       for (int igas = 0; igas < m_ngas; igas++) {
         auto name = m_gas_names[igas];
@@ -1220,7 +1372,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
-          const int icol = i + beg;
+          const int icol = rad_cols(i+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
 #ifdef RRTMGP_ENABLE_YAKL
             tmp2d(i+1,k+1) = d_vmr(icol,k); // Note that for YAKL arrays i and k start with index 1
@@ -1230,7 +1382,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
 #endif
           });
         });
-        Kokkos::fence();
+        solve_space.fence();
 
         // Populate GasConcs object
 #ifdef RRTMGP_ENABLE_YAKL
@@ -1254,18 +1406,18 @@ void RRTMGPRadiation::run_impl (const double dt) {
       // from cloud fraction parameterization, wherever that is computed.
       auto do_subcol_sampling = m_do_subcol_sampling;
 #ifdef RRTMGP_ENABLE_YAKL
-      auto lwp = m_buffer.lwp;
-      auto iwp = m_buffer.iwp;
+      auto lwp = buffer.lwp;
+      auto iwp = buffer.iwp;
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
-      auto lwp_k = m_buffer.lwp_k;
-      auto iwp_k = m_buffer.iwp_k;
+      auto lwp_k = buffer.lwp_k;
+      auto iwp_k = buffer.iwp_k;
 #endif
       if (not do_subcol_sampling) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
-          const int icol = i + beg;
+          const int icol = rad_cols(i+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
 #ifdef RRTMGP_ENABLE_YAKL
             if (d_cldfrac_tot(icol,k) > 0) {
@@ -1289,7 +1441,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
-          const int icol = i + beg;
+          const int icol = rad_cols(i+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
 #ifdef RRTMGP_ENABLE_YAKL
             cldfrac_tot(i+1,k+1) = d_cldfrac_tot(icol,k);
@@ -1301,7 +1453,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
           });
         });
       }
-      Kokkos::fence();
+      solve_space.fence();
 #ifdef RRTMGP_ENABLE_KOKKOS
       COMPARE_WRAP(cldfrac_tot, cldfrac_tot_k);
 #endif
@@ -1338,7 +1490,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         });
       });
       }
-      Kokkos::fence();
+      solve_space.fence();
 
       // Compute band-by-band surface_albedos. This is needed since
       // the AD passes broadband albedos, but rrtmgp require band-by-band.
@@ -1380,7 +1532,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_clnsky_flux_up, lw_clnsky_flux_dn,
         sw_bnd_flux_up   , sw_bnd_flux_dn   , sw_bnd_flux_dir      , lw_bnd_flux_up   , lw_bnd_flux_dn,
         eccf, m_atm_logger,
-        m_extra_clnclrsky_diag, m_extra_clnsky_diag
+        m_extra_clnclrsky_diag, m_extra_clnsky_diag, m_gpt_sampling_frac
       );
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
@@ -1402,7 +1554,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_clnsky_flux_up_k, lw_clnsky_flux_dn_k,
         sw_bnd_flux_up_k, sw_bnd_flux_dn_k, sw_bnd_flux_dir_k, lw_bnd_flux_up_k, lw_bnd_flux_dn_k,
         eccf, m_atm_logger,
-        m_extra_clnclrsky_diag, m_extra_clnsky_diag
+        m_extra_clnclrsky_diag, m_extra_clnsky_diag, m_gpt_sampling_frac
       );
       COMPARE_ALL_WRAP(std::vector<real2d>({
         sw_flux_up, sw_flux_dn, sw_flux_dn_dir, lw_flux_up, lw_flux_dn,
@@ -1427,8 +1579,8 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
       // Update heating tendency
 #ifdef RRTMGP_ENABLE_YAKL
-      auto sw_heating  = m_buffer.sw_heating;
-      auto lw_heating  = m_buffer.lw_heating;
+      auto sw_heating  = buffer.sw_heating;
+      auto lw_heating  = buffer.lw_heating;
       rrtmgp::compute_heating_rate(
         sw_flux_up, sw_flux_dn, p_del, sw_heating
       );
@@ -1439,7 +1591,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int idx = team.league_rank();
-          const int icol = idx+beg;
+          const int icol = rad_cols(idx+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& ilay) {
             // Combine SW and LW heating into a net heating tendency; use d_rad_heating_pdel temporarily
             // Note that for YAKL arrays i and k start with index 1
@@ -1447,11 +1599,11 @@ void RRTMGPRadiation::run_impl (const double dt) {
           });
         });
       }
-      Kokkos::fence();
+      solve_space.fence();
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
-      auto sw_heating_k  = m_buffer.sw_heating_k;
-      auto lw_heating_k  = m_buffer.lw_heating_k;
+      auto sw_heating_k  = buffer.sw_heating_k;
+      auto lw_heating_k  = buffer.lw_heating_k;
       rrtmgp::compute_heating_rate(
         sw_flux_up_k, sw_flux_dn_k, p_del_k, sw_heating_k
       );
@@ -1462,7 +1614,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int idx = team.league_rank();
-          const int icol = idx+beg;
+          const int icol = rad_cols(idx+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& ilay) {
             // Combine SW and LW heating into a net heating tendency; use d_rad_heating_pdel temporarily
             // Note that for YAKL arrays i and k start with index 1
@@ -1470,7 +1622,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
           });
         });
       }
-      Kokkos::fence();
+      solve_space.fence();
       COMPARE_ALL_WRAP(std::vector<real2d>({sw_heating, lw_heating}),
                        std::vector<real2dk>({sw_heating_k, lw_heating_k}));
 #endif
@@ -1519,12 +1671,18 @@ void RRTMGPRadiation::run_impl (const double dt) {
                        std::vector<real1dk>({sfc_flux_dir_vis_k, sfc_flux_dir_nir_k, sfc_flux_dif_vis_k, sfc_flux_dif_nir_k}));
 #endif
 
+      // If the chunk columns are not contiguous (adaptive rad), the 2d diagnostics
+      // below are computed in the chunk_diags storage, and scattered to the fields later
+      auto diag_data = [&](const int idiag, const Field::view_dev_t<Real*>& v) -> Real* {
+        return adaptive_rad ? chunk_diags.data() + idiag*chunk_diags.extent(1) : v.data() + beg;
+      };
+
       // Compute diagnostic total cloud area (vertically-projected cloud cover)
 #ifdef RRTMGP_ENABLE_YAKL
-      real1d cldlow ("cldlow", d_cldlow.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldmed ("cldmed", d_cldmed.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldhgh ("cldhgh", d_cldhgh.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldtot ("cldtot", d_cldtot.data() + m_col_chunk_beg[ic], ncol);
+      real1d cldlow ("cldlow", diag_data(0,d_cldlow), ncol);
+      real1d cldmed ("cldmed", diag_data(1,d_cldmed), ncol);
+      real1d cldhgh ("cldhgh", diag_data(2,d_cldhgh), ncol);
+      real1d cldtot ("cldtot", diag_data(3,d_cldtot), ncol);
       // NOTE: limits for low, mid, and high clouds are mostly taken from EAM F90 source, with the
       // exception that I removed the restriction on low clouds to be above (numerically lower pressures)
       // 1200 hPa, and on high clouds to be below (numerically high pressures) 50 hPa. This probably
@@ -1537,10 +1695,10 @@ void RRTMGPRadiation::run_impl (const double dt) {
       rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts,     0, std::numeric_limits<Real>::max(), p_lay, cld_tau_lw_gpt, cldtot);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
-      real1dk cldlow_k (d_cldlow.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldmed_k (d_cldmed.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldhgh_k (d_cldhgh.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldtot_k (d_cldtot.data() + m_col_chunk_beg[ic], ncol);
+      real1dk cldlow_k (diag_data(0,d_cldlow), ncol);
+      real1dk cldmed_k (diag_data(1,d_cldmed), ncol);
+      real1dk cldhgh_k (diag_data(2,d_cldhgh), ncol);
+      real1dk cldtot_k (diag_data(3,d_cldtot), ncol);
       // NOTE: limits for low, mid, and high clouds are mostly taken from EAM F90 source, with the
       // exception that I removed the restriction on low clouds to be above (numerically lower pressures)
       // 1200 hPa, and on high clouds to be below (numerically high pressures) 50 hPa. This probably
@@ -1557,20 +1715,15 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
       // Compute cloud-top diagnostics following AeroCOM recommendation
 #ifdef RRTMGP_ENABLE_YAKL
-      // Get visible 0.67 micron band for COSP
-      auto idx_067 = rrtmgp::get_wavelength_index_sw(0.67e-6);
-      // Get IR 10.5 micron band for COSP
-      auto idx_105 = rrtmgp::get_wavelength_index_lw(10.5e-6);
-
       // Compute cloud-top diagnostics following AeroCom recommendation
-      real1d T_mid_at_cldtop ("T_mid_at_cldtop", d_T_mid_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d p_mid_at_cldtop ("p_mid_at_cldtop", d_p_mid_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldfrac_ice_at_cldtop ("cldfrac_ice_at_cldtop", d_cldfrac_ice_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldfrac_liq_at_cldtop ("cldfrac_liq_at_cldtop", d_cldfrac_liq_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldfrac_tot_at_cldtop ("cldfrac_tot_at_cldtop", d_cldfrac_tot_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d cdnc_at_cldtop ("cdnc_at_cldtop", d_cdnc_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d eff_radius_qc_at_cldtop ("eff_radius_qc_at_cldtop", d_eff_radius_qc_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d eff_radius_qi_at_cldtop ("eff_radius_qi_at_cldtop", d_eff_radius_qi_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
+      real1d T_mid_at_cldtop ("T_mid_at_cldtop", diag_data(4,d_T_mid_at_cldtop), ncol);
+      real1d p_mid_at_cldtop ("p_mid_at_cldtop", diag_data(5,d_p_mid_at_cldtop), ncol);
+      real1d cldfrac_ice_at_cldtop ("cldfrac_ice_at_cldtop", diag_data(6,d_cldfrac_ice_at_cldtop), ncol);
+      real1d cldfrac_liq_at_cldtop ("cldfrac_liq_at_cldtop", diag_data(7,d_cldfrac_liq_at_cldtop), ncol);
+      real1d cldfrac_tot_at_cldtop ("cldfrac_tot_at_cldtop", diag_data(8,d_cldfrac_tot_at_cldtop), ncol);
+      real1d cdnc_at_cldtop ("cdnc_at_cldtop", diag_data(9,d_cdnc_at_cldtop), ncol);
+      real1d eff_radius_qc_at_cldtop ("eff_radius_qc_at_cldtop", diag_data(10,d_eff_radius_qc_at_cldtop), ncol);
+      real1d eff_radius_qi_at_cldtop ("eff_radius_qi_at_cldtop", diag_data(11,d_eff_radius_qi_at_cldtop), ncol);
 
       rrtmgp::compute_aerocom_cloudtop(
           ncol, nlay, t_lay, p_lay, p_del, z_del, qc, qi, rel, rei, cldfrac_tot,
@@ -1579,19 +1732,15 @@ void RRTMGPRadiation::run_impl (const double dt) {
           eff_radius_qc_at_cldtop, eff_radius_qi_at_cldtop);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
-      // Get visible 0.67 micron band for COSP
-      auto idx_067_k = rrtmgp::get_wavelength_index_sw_k(0.67e-6);
-      // Get IR 10.5 micron band for COSP
-      auto idx_105_k = rrtmgp::get_wavelength_index_lw_k(10.5e-6);
 
-      real1dk T_mid_at_cldtop_k (d_T_mid_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk p_mid_at_cldtop_k (d_p_mid_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldfrac_ice_at_cldtop_k (d_cldfrac_ice_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldfrac_liq_at_cldtop_k (d_cldfrac_liq_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldfrac_tot_at_cldtop_k (d_cldfrac_tot_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cdnc_at_cldtop_k (d_cdnc_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk eff_radius_qc_at_cldtop_k (d_eff_radius_qc_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk eff_radius_qi_at_cldtop_k (d_eff_radius_qi_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
+      real1dk T_mid_at_cldtop_k (diag_data(4,d_T_mid_at_cldtop), ncol);
+      real1dk p_mid_at_cldtop_k (diag_data(5,d_p_mid_at_cldtop), ncol);
+      real1dk cldfrac_ice_at_cldtop_k (diag_data(6,d_cldfrac_ice_at_cldtop), ncol);
+      real1dk cldfrac_liq_at_cldtop_k (diag_data(7,d_cldfrac_liq_at_cldtop), ncol);
+      real1dk cldfrac_tot_at_cldtop_k (diag_data(8,d_cldfrac_tot_at_cldtop), ncol);
+      real1dk cdnc_at_cldtop_k (diag_data(9,d_cdnc_at_cldtop), ncol);
+      real1dk eff_radius_qc_at_cldtop_k (diag_data(10,d_eff_radius_qc_at_cldtop), ncol);
+      real1dk eff_radius_qi_at_cldtop_k (diag_data(11,d_eff_radius_qi_at_cldtop), ncol);
 
       rrtmgp::compute_aerocom_cloudtop(
           ncol, nlay, t_lay_k, p_lay_k, p_del_k, z_del_k, qc_k, qi_k, rel_k, rei_k, cldfrac_tot_k,
@@ -1607,13 +1756,45 @@ void RRTMGPRadiation::run_impl (const double dt) {
             cldfrac_liq_at_cldtop_k, cldfrac_tot_at_cldtop_k, cdnc_at_cldtop_k,
             eff_radius_qc_at_cldtop_k, eff_radius_qi_at_cldtop_k}));
 #endif
+#if defined(RRTMGP_ENABLE_YAKL) and defined(RRTMGP_ENABLE_KOKKOS)
+      // Sync back to gas_concs_k
+      real3dk temp(gas_concs_k, std::make_pair(0, ncol), Kokkos::ALL, Kokkos::ALL);
+      Kokkos::deep_copy(temp, m_gas_concs_k.concs);
+#endif
+      } // do_solve
+
+      if (do_writeback) {
+      // Make sure the solve is done, as well as the previous write back
+      solve_space.fence();
+      wb_space.fence();
 
       // Copy output data back to FieldManager
-      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
+      if (adaptive_rad) {
+        Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(wb_space,0,ncol), KOKKOS_LAMBDA (const int i) {
+          const int icol = rad_cols(i+beg);
+          d_cldlow(icol) = chunk_diags(0,i);
+          d_cldmed(icol) = chunk_diags(1,i);
+          d_cldhgh(icol) = chunk_diags(2,i);
+          d_cldtot(icol) = chunk_diags(3,i);
+          d_T_mid_at_cldtop(icol)         = chunk_diags(4,i);
+          d_p_mid_at_cldtop(icol)         = chunk_diags(5,i);
+          d_cldfrac_ice_at_cldtop(icol)   = chunk_diags(6,i);
+          d_cldfrac_liq_at_cldtop(icol)   = chunk_diags(7,i);
+          d_cldfrac_tot_at_cldtop(icol)   = chunk_diags(8,i);
+          d_cdnc_at_cldtop(icol)          = chunk_diags(9,i);
+          d_eff_radius_qc_at_cldtop(icol) = chunk_diags(10,i);
+          d_eff_radius_qi_at_cldtop(icol) = chunk_diags(11,i);
+        });
+      }
+      const auto policy = get_team_policy(wb_space, ncol, m_nlay);
 #ifdef RRTMGP_ENABLE_YAKL
+      // Index to surface (bottom of model), and visible 0.67 and IR 10.5 micron bands for COSP
+      const int kbot = nlay+1;
+      auto idx_067 = rrtmgp::get_wavelength_index_sw(0.67e-6);
+      auto idx_105 = rrtmgp::get_wavelength_index_lw(10.5e-6);
       Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
         const int i = team.league_rank();
-        const int icol = i + beg;
+        const int icol = rad_cols(i+beg);
         d_sfc_flux_dir_nir(icol) = sfc_flux_dir_nir(i+1);
         d_sfc_flux_dir_vis(icol) = sfc_flux_dir_vis(i+1);
         d_sfc_flux_dif_nir(icol) = sfc_flux_dif_nir(i+1);
@@ -1655,9 +1836,13 @@ void RRTMGPRadiation::run_impl (const double dt) {
       });
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
+      // Index to surface (bottom of model), and visible 0.67 and IR 10.5 micron bands for COSP
+      const int kbot_k = nlay;
+      auto idx_067_k = rrtmgp::get_wavelength_index_sw_k(0.67e-6);
+      auto idx_105_k = rrtmgp::get_wavelength_index_lw_k(10.5e-6);
       Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
         const int i = team.league_rank();
-        const int icol = i + beg;
+        const int icol = rad_cols(i+beg);
         d_sfc_flux_dir_nir(icol) = sfc_flux_dir_nir_k(i);
         d_sfc_flux_dir_vis(icol) = sfc_flux_dir_vis_k(i);
         d_sfc_flux_dif_nir(icol) = sfc_flux_dif_nir_k(i);
@@ -1697,13 +1882,11 @@ void RRTMGPRadiation::run_impl (const double dt) {
             d_sunlit(icol) = 0.0;
         }
       });
-#ifdef RRTMGP_ENABLE_YAKL
-      // Sync back to gas_concs_k
-      real3dk temp(gas_concs_k, std::make_pair(0, ncol), Kokkos::ALL, Kokkos::ALL);
-      Kokkos::deep_copy(temp, m_gas_concs_k.concs);
-#endif
 #endif
+      } // do_writeback
+    } // loop over stages
     } // loop over chunk
+    wb_space.fence();
 
     // Restore the refCounted array.
 #ifdef RRTMGP_ENABLE_YAKL
@@ -1716,17 +1899,19 @@ void RRTMGPRadiation::run_impl (const double dt) {
 #endif
   } // update_rad
 
-  // Apply temperature tendency; if we updated radiation this timestep, then d_rad_heating_pdel should
-  // contain actual heating rate, not pdel scaled heating rate. Otherwise, if we have NOT updated the
+  // Apply temperature tendency; if we updated radiation on a column this timestep, then d_rad_heating_pdel
+  // should contain actual heating rate, not pdel scaled heating rate. Otherwise, if we have NOT updated the
   // radiative heating, then we need to back out the heating from the rad_heating*pdel term that we carry
   // across timesteps to conserve energy.
   const int ncols = m_ncol;
   const int nlays = m_nlay;
+  const auto rad_col_updated = m_rad_col_updated;
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, nlays);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const int i = team.league_rank();
+    const bool updated = rad_col_updated(i)!=0;
     Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlays), [&] (const int& k) {
-      if (update_rad) {
+      if (updated) {
         d_tmid(i,k) = d_tmid(i,k) + d_rad_heating_pdel(i,k) * dt;
         d_rad_heating_pdel(i,k) = d_pdel(i,k) * d_rad_heating_pdel(i,k);
       } else {
@@ -1775,6 +1960,10 @@ void RRTMGPRadiation::finalize_impl  () {
 #endif
   rrtmgp::rrtmgp_finalize();
 
+  // Release the execution space instances
+  m_prep_space      = ExeSpace();
+  m_writeback_space = ExeSpace();
+
   finalize_kls();
 }
 // =========================================================================================
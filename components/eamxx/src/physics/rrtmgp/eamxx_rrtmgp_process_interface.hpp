@@ -16,6 +16,7 @@ namespace scream {
 
 class RRTMGPRadiation : public AtmosphereProcess {
 public:
+  using view_1d_int      = typename ekat::KokkosTypes<DefaultDevice>::template view_1d<int>;
   using view_1d_real     = typename ekat::KokkosTypes<DefaultDevice>::template view_1d<Real>;
   using view_2d_real     = typename ekat::KokkosTypes<DefaultDevice>::template view_2d<Real>;
   using view_3d_real     = typename ekat::KokkosTypes<DefaultDevice>::template view_3d<Real>;
@@ -51,7 +52,13 @@ public:
   int m_ncol;
   int m_num_col_chunks;
   int m_col_chunk_size;
-  std::vector<int> m_col_chunk_beg;
+
+  // Whether to pipeline column chunks, overlapping the input copy of chunk ic+1 and
+  // the output copy of chunk ic-1 with the solve of chunk ic. If so, the copies run
+  // on their own execution space instances.
+  bool m_pipeline_col_chunks;
+  typename KT::ExeSpace m_prep_space;
+  typename KT::ExeSpace m_writeback_space;
   int m_nlay;
   Field m_lat;
   Field m_lon;
@@ -62,6 +69,9 @@ public:
   bool m_extra_clnsky_diag;
   bool m_extra_clnclrsky_diag;
 
+  // Fraction of the g-points of each band used in radiative transfer (1 means all of them)
+  Real m_gpt_sampling_frac;
+
   // The orbital year, used for zenith angle calculations:
   // If > 0, use constant orbital year for duration of simulation
   // If < 0, use year from timestamp for orbital parameters
@@ -110,6 +120,30 @@ public:
   // Whether or not to do subcolumn sampling of cloud state for MCICA
   bool m_do_subcol_sampling;
 
+  // Adaptive radiation: between two full radiation calls, recompute radiation
+  // only on the columns whose state changed by more than these tolerances
+  // since the last time radiation was computed on them
+  bool m_adaptive_rad;
+  Real m_adaptive_cldfrac_tol;      // Cloud fraction, at any level
+  Real m_adaptive_water_path_tol;   // Column liquid+ice water path [kg/m2]
+  Real m_adaptive_temperature_tol;  // Temperature, at any level [K]
+
+  // State of each column at its last radiation call (only for adaptive rad)
+  view_2d_real m_rad_ref_cldfrac;
+  view_2d_real m_rad_ref_tmid;
+  view_1d_real m_rad_ref_water_path;
+
+  // The columns radiation is computed on. The first m_num_rad_cols entries are
+  // processed in chunks of m_col_chunk_size. With adaptive rad, daytime columns
+  // are packed first, so that chunks with only night columns skip SW entirely.
+  int m_num_rad_cols;
+  view_1d_int m_rad_cols;
+  view_1d_int::HostMirror m_rad_cols_h;
+  // Whether radiation was computed on each column during this step
+  view_1d_int m_rad_col_updated;
+  // Chunk storage for 2d diagnostics, used when chunk columns are not contiguous
+  view_3d_real m_chunk_diags;
+
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
     static constexpr int num_1d_ncol        = 10;
@@ -125,6 +159,7 @@ public:
 
     // 1d size (ncol)
     uview_1d<Real> cosine_zenith;
+    typename uview_1d<Real>::HostMirror cosine_zenith_h;
 #ifdef RRTMGP_ENABLE_YAKL
     real1d mu0;
     real1d sfc_alb_dir_vis;
@@ -317,8 +352,8 @@ protected:
 
   std::shared_ptr<const AbstractGrid>   m_grid;
 
-  // Struct which contains local variables
-  Buffer m_buffer;
+  // Structs which contain local variables (one per column chunk pipeline stage)
+  std::vector<Buffer> m_buffers;
 };  // class RRTMGPRadiation
 
 }  // namespace scream
@@ -5,6 +5,8 @@
 #include "cpp/rrtmgp_const.h"
 #include "cpp/rrtmgp_conversion.h"
 
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
 #ifdef RRTMGP_ENABLE_YAKL
 #include "YAKL.h"
 #include "YAKL_Bounds_fortran.h"
@@ -80,6 +82,61 @@ inline bool radiation_do(const int irad, const int nstep) {
   }
 }
 
+// Used by adaptive radiation: flag the columns whose cloud fraction or temperature
+// (at any level), or total (liquid+ice) water path changed by more than the given
+// tolerances since the last radiation call, as stored in the reference views.
+// The reference state of the flagged columns is updated to the current state.
+// If force=true, all columns are flagged. Returns the number of flagged columns.
+template<class InView, class Ref2dView, class Ref1dView, class FlagView>
+int flag_changed_columns (
+  InView const &cldfrac, InView const &tmid, InView const &qc, InView const &qi, InView const &pdel,
+  Ref2dView const &cldfrac_ref, Ref2dView const &tmid_ref, Ref1dView const &water_path_ref,
+  const Real cldfrac_tol, const Real tmid_tol, const Real water_path_tol,
+  const bool force, FlagView const &flags)
+{
+  using physconst  = scream::physics::Constants<Real>;
+  using ExeSpace   = typename FlagView::execution_space;
+  using MemberType = typename Kokkos::TeamPolicy<ExeSpace>::member_type;
+
+  const int ncol = flags.extent(0);
+  const int nlay = tmid.extent(1);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, nlay);
+  int nflagged = 0;
+  Kokkos::parallel_reduce(policy, KOKKOS_LAMBDA(const MemberType& team, int& count) {
+    const int icol = team.league_rank();
+
+    Real dcld = 0, dt = 0, wp = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k, Real& m) {
+      const Real d = Kokkos::abs(cldfrac(icol,k) - cldfrac_ref(icol,k));
+      m = d > m ? d : m;
+    }, Kokkos::Max<Real>(dcld));
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k, Real& m) {
+      const Real d = Kokkos::abs(tmid(icol,k) - tmid_ref(icol,k));
+      m = d > m ? d : m;
+    }, Kokkos::Max<Real>(dt));
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k, Real& s) {
+      s += (qc(icol,k) + qi(icol,k)) * pdel(icol,k) / physconst::gravit;
+    }, wp);
+
+    const bool flag = force or dcld > cldfrac_tol or dt > tmid_tol or
+                      Kokkos::abs(wp - water_path_ref(icol)) > water_path_tol;
+    if (flag) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
+        cldfrac_ref(icol,k) = cldfrac(icol,k);
+        tmid_ref(icol,k)    = tmid(icol,k);
+      });
+    }
+    Kokkos::single(Kokkos::PerTeam(team), [&] () {
+      if (flag) {
+        water_path_ref(icol) = wp;
+        ++count;
+      }
+      flags(icol) = flag ? 1 : 0;
+    });
+  }, nflagged);
+  return nflagged;
+}
+
 // Verify that array only contains values within valid range, and if not
 // report min and max of array
 #ifdef RRTMGP_ENABLE_YAKL
@@ -13,6 +13,8 @@
 #include "Kokkos_Random.hpp"
 #endif
 
+#include <cmath>
+
 namespace scream {
 
 void init_kls ()
@@ -709,7 +711,8 @@ void rrtmgp_main(
   real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac) {
 
 #ifdef SCREAM_RRTMGP_DEBUG
   // Sanity check inputs, and possibly repair
@@ -842,7 +845,7 @@ void rrtmgp_main(
     sfc_alb_dir, sfc_alb_dif, mu0, aerosol_sw, clouds_sw_gpt,
     fluxes_sw, clnclrsky_fluxes_sw, clrsky_fluxes_sw, clnsky_fluxes_sw,
     tsi_scaling, logger,
-    extra_clnclrsky_diag, extra_clnsky_diag
+    extra_clnclrsky_diag, extra_clnsky_diag, gpt_sampling_frac
             );
 
   // Do longwave
@@ -851,7 +854,7 @@ void rrtmgp_main(
     k_dist_lw, p_lay, t_lay, p_lev, t_lev, gas_concs,
     aerosol_lw, clouds_lw_gpt,
     fluxes_lw, clnclrsky_fluxes_lw, clrsky_fluxes_lw, clnsky_fluxes_lw,
-    extra_clnclrsky_diag, extra_clnsky_diag
+    extra_clnclrsky_diag, extra_clnsky_diag, gpt_sampling_frac
             );
 
 }
@@ -879,7 +882,8 @@ void rrtmgp_main(
   real3dk &lw_bnd_flux_up, real3dk &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac) {
 
 #ifdef SCREAM_RRTMGP_DEBUG
   // Sanity check inputs, and possibly repair
@@ -1012,7 +1016,7 @@ void rrtmgp_main(
     sfc_alb_dir, sfc_alb_dif, mu0, aerosol_sw, clouds_sw_gpt,
     fluxes_sw, clnclrsky_fluxes_sw, clrsky_fluxes_sw, clnsky_fluxes_sw,
     tsi_scaling, logger,
-    extra_clnclrsky_diag, extra_clnsky_diag
+    extra_clnclrsky_diag, extra_clnsky_diag, gpt_sampling_frac
             );
 
   // Do longwave
@@ -1021,7 +1025,7 @@ void rrtmgp_main(
     k_dist_lw_k, p_lay, t_lay, p_lev, t_lev, gas_concs,
     aerosol_lw, clouds_lw_gpt,
     fluxes_lw, clnclrsky_fluxes_lw, clrsky_fluxes_lw, clnsky_fluxes_lw,
-    extra_clnclrsky_diag, extra_clnsky_diag
+    extra_clnclrsky_diag, extra_clnsky_diag, gpt_sampling_frac
             );
 
 }
@@ -1167,6 +1171,218 @@ int3dk get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d
 }
 #endif
 
+#ifdef RRTMGP_ENABLE_YAKL
+int2d get_gpoint_subsample(const int ncol, const Real frac, OpticalProps &kdist, real2d &t_lay,
+                           int2d &band_lims_gpt, real1d &gpt_weights) {
+  const int nbnd = kdist.get_nband();
+  const int nlay = t_lay.dimension[1];
+  auto band_lims_full = kdist.get_band_lims_gpoint();
+  auto band_lims_full_h = band_lims_full.createHostCopy();
+
+  // Sampled g-points are stored contiguously band by band, like in the full set
+  band_lims_gpt = int2d("band_lims_gpt", 2, nbnd);
+  auto band_lims_gpt_h = band_lims_gpt.createHostCopy();
+  int ngpt_sub = 0;
+  for (int ibnd = 1; ibnd <= nbnd; ibnd++) {
+    const int ngpt_bnd = band_lims_full_h(2,ibnd) - band_lims_full_h(1,ibnd) + 1;
+    const int nsample = std::min(ngpt_bnd, std::max(1, static_cast<int>(std::lround(frac*ngpt_bnd))));
+    band_lims_gpt_h(1,ibnd) = ngpt_sub + 1;
+    band_lims_gpt_h(2,ibnd) = ngpt_sub + nsample;
+    ngpt_sub += nsample;
+  }
+  band_lims_gpt_h.deep_copy_to(band_lims_gpt);
+
+  gpt_weights = real1d("gpt_weights", ngpt_sub);
+  auto gpt_weights_h = gpt_weights.createHostCopy();
+  for (int ibnd = 1; ibnd <= nbnd; ibnd++) {
+    const int ngpt_bnd = band_lims_full_h(2,ibnd) - band_lims_full_h(1,ibnd) + 1;
+    const int nsample  = band_lims_gpt_h(2,ibnd) - band_lims_gpt_h(1,ibnd) + 1;
+    for (int igpt = band_lims_gpt_h(1,ibnd); igpt <= band_lims_gpt_h(2,ibnd); igpt++) {
+      gpt_weights_h(igpt) = Real(ngpt_bnd) / nsample;
+    }
+  }
+  gpt_weights_h.deep_copy_to(gpt_weights);
+
+  // Draw the samples with selection sampling (Knuth's algorithm S), which needs no
+  // scratch memory. Seed with the decimal part of the temperature, so that samples
+  // change from step to step, and are independent of the cloud subcolumns
+  auto gpt_map = int2d("gpt_map", ncol, ngpt_sub);
+  parallel_for(SimpleBounds<1>(ncol), YAKL_LAMBDA(int icol) {
+      yakl::Random rand(1e9 * (t_lay(icol,nlay) - int(t_lay(icol,nlay))));
+      for (int ibnd = 1; ibnd <= nbnd; ibnd++) {
+        const int last = band_lims_full(2,ibnd);
+        int isub = band_lims_gpt(1,ibnd);
+        for (int igpt = band_lims_full(1,ibnd); igpt <= last; igpt++) {
+          const int nleft = band_lims_gpt(2,ibnd) - isub + 1;
+          if (nleft > 0 and rand.genFP<Real>()*(last-igpt+1) < nleft) {
+            gpt_map(icol,isub++) = igpt;
+          }
+        }
+      }
+    });
+  return gpt_map;
+}
+
+// Gather the sampled g-points of optical properties and (weighted) sources
+static OpticalProps2str subsample_gpoints(OpticalProps2str &optics, int2d &band_lims_gpt, int2d &gpt_map) {
+  const int ncol = optics.tau.dimension[0];
+  const int nlay = optics.tau.dimension[1];
+  const int ngpt = gpt_map.dimension[1];
+  OpticalProps2str subsampled;
+  subsampled.init(optics.get_band_lims_wavenumber(), band_lims_gpt, "subsampled_gpoints");
+  subsampled.alloc_2str(ncol, nlay);
+  parallel_for(SimpleBounds<3>(ngpt,nlay,ncol), YAKL_LAMBDA(int igpt, int ilay, int icol) {
+      const int ifull = gpt_map(icol,igpt);
+      subsampled.tau(icol,ilay,igpt) = optics.tau(icol,ilay,ifull);
+      subsampled.ssa(icol,ilay,igpt) = optics.ssa(icol,ilay,ifull);
+      subsampled.g  (icol,ilay,igpt) = optics.g  (icol,ilay,ifull);
+    });
+  return subsampled;
+}
+static OpticalProps1scl subsample_gpoints(OpticalProps1scl &optics, int2d &band_lims_gpt, int2d &gpt_map) {
+  const int ncol = optics.tau.dimension[0];
+  const int nlay = optics.tau.dimension[1];
+  const int ngpt = gpt_map.dimension[1];
+  OpticalProps1scl subsampled;
+  subsampled.init(optics.get_band_lims_wavenumber(), band_lims_gpt, "subsampled_gpoints");
+  subsampled.alloc_1scl(ncol, nlay);
+  parallel_for(SimpleBounds<3>(ngpt,nlay,ncol), YAKL_LAMBDA(int igpt, int ilay, int icol) {
+      subsampled.tau(icol,ilay,igpt) = optics.tau(icol,ilay,gpt_map(icol,igpt));
+    });
+  return subsampled;
+}
+static void subsample_gpoints(real2d &src, int2d &gpt_map, real1d &gpt_weights, real2d &dst) {
+  const int ncol = src.dimension[0];
+  const int ngpt = gpt_map.dimension[1];
+  parallel_for(SimpleBounds<2>(ngpt,ncol), YAKL_LAMBDA(int igpt, int icol) {
+      dst(icol,igpt) = gpt_weights(igpt) * src(icol,gpt_map(icol,igpt));
+    });
+}
+static void subsample_gpoints(real3d &src, int2d &gpt_map, real1d &gpt_weights, real3d &dst) {
+  const int ncol = src.dimension[0];
+  const int nlev = src.dimension[1];
+  const int ngpt = gpt_map.dimension[1];
+  parallel_for(SimpleBounds<3>(ngpt,nlev,ncol), YAKL_LAMBDA(int igpt, int ilev, int icol) {
+      dst(icol,ilev,igpt) = gpt_weights(igpt) * src(icol,ilev,gpt_map(icol,igpt));
+    });
+}
+static SourceFuncLW subsample_gpoints(SourceFuncLW &sources, OpticalProps &optics, int2d &gpt_map, real1d &gpt_weights) {
+  SourceFuncLW subsampled;
+  subsampled.alloc(sources.lay_source.dimension[0], sources.lay_source.dimension[1], optics);
+  subsample_gpoints(sources.lay_source,     gpt_map, gpt_weights, subsampled.lay_source);
+  subsample_gpoints(sources.lev_source_inc, gpt_map, gpt_weights, subsampled.lev_source_inc);
+  subsample_gpoints(sources.lev_source_dec, gpt_map, gpt_weights, subsampled.lev_source_dec);
+  subsample_gpoints(sources.sfc_source,     gpt_map, gpt_weights, subsampled.sfc_source);
+  return subsampled;
+}
+#endif
+#ifdef RRTMGP_ENABLE_KOKKOS
+int2dk get_gpoint_subsample(const int ncol, const Real frac, OpticalPropsK &kdist, real2dk &t_lay,
+                            int2dk &band_lims_gpt, real1dk &gpt_weights) {
+  const int nbnd = kdist.get_nband();
+  const int nlay = t_lay.extent(1);
+  auto band_lims_full = kdist.get_band_lims_gpoint();
+  auto band_lims_full_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), band_lims_full);
+
+  // Sampled g-points are stored contiguously band by band, like in the full set
+  band_lims_gpt = int2dk("band_lims_gpt", 2, nbnd);
+  auto band_lims_gpt_h = Kokkos::create_mirror_view(band_lims_gpt);
+  int ngpt_sub = 0;
+  for (int ibnd = 0; ibnd < nbnd; ibnd++) {
+    const int ngpt_bnd = band_lims_full_h(1,ibnd) - band_lims_full_h(0,ibnd) + 1;
+    const int nsample = std::min(ngpt_bnd, std::max(1, static_cast<int>(std::lround(frac*ngpt_bnd))));
+    band_lims_gpt_h(0,ibnd) = ngpt_sub;
+    band_lims_gpt_h(1,ibnd) = ngpt_sub + nsample - 1;
+    ngpt_sub += nsample;
+  }
+  Kokkos::deep_copy(band_lims_gpt, band_lims_gpt_h);
+
+  gpt_weights = real1dk("gpt_weights", ngpt_sub);
+  auto gpt_weights_h = Kokkos::create_mirror_view(gpt_weights);
+  for (int ibnd = 0; ibnd < nbnd; ibnd++) {
+    const int ngpt_bnd = band_lims_full_h(1,ibnd) - band_lims_full_h(0,ibnd) + 1;
+    const int nsample  = band_lims_gpt_h(1,ibnd) - band_lims_gpt_h(0,ibnd) + 1;
+    for (int igpt = band_lims_gpt_h(0,ibnd); igpt <= band_lims_gpt_h(1,ibnd); igpt++) {
+      gpt_weights_h(igpt) = Real(ngpt_bnd) / nsample;
+    }
+  }
+  Kokkos::deep_copy(gpt_weights, gpt_weights_h);
+
+  // Draw the samples with selection sampling (Knuth's algorithm S), which needs no
+  // scratch memory. Seed with the decimal part of the temperature, so that samples
+  // change from step to step, and are independent of the cloud subcolumns
+  auto gpt_map = int2dk("gpt_map", ncol, ngpt_sub);
+  auto band_lims_sub = band_lims_gpt;
+  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+    conv::Random rand(1e9 * (t_lay(icol,nlay-1) - int(t_lay(icol,nlay-1))));
+    for (int ibnd = 0; ibnd < nbnd; ibnd++) {
+      const int last = band_lims_full(1,ibnd);
+      int isub = band_lims_sub(0,ibnd);
+      for (int igpt = band_lims_full(0,ibnd); igpt <= last; igpt++) {
+        const int nleft = band_lims_sub(1,ibnd) - isub + 1;
+        if (nleft > 0 and rand.genFP<Real>()*(last-igpt+1) < nleft) {
+          gpt_map(icol,isub++) = igpt;
+        }
+      }
+    }
+  });
+  return gpt_map;
+}
+
+// Gather the sampled g-points of optical properties and (weighted) sources
+static OpticalProps2strK subsample_gpoints(OpticalProps2strK &optics, int2dk &band_lims_gpt, int2dk &gpt_map) {
+  const int ncol = optics.tau.extent(0);
+  const int nlay = optics.tau.extent(1);
+  const int ngpt = gpt_map.extent(1);
+  OpticalProps2strK subsampled;
+  subsampled.init(optics.get_band_lims_wavenumber(), band_lims_gpt, "subsampled_gpoints");
+  subsampled.alloc_2str(ncol, nlay);
+  Kokkos::parallel_for(conv::get_mdrp<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
+    const int ifull = gpt_map(icol,igpt);
+    subsampled.tau(icol,ilay,igpt) = optics.tau(icol,ilay,ifull);
+    subsampled.ssa(icol,ilay,igpt) = optics.ssa(icol,ilay,ifull);
+    subsampled.g  (icol,ilay,igpt) = optics.g  (icol,ilay,ifull);
+  });
+  return subsampled;
+}
+static OpticalProps1sclK subsample_gpoints(OpticalProps1sclK &optics, int2dk &band_lims_gpt, int2dk &gpt_map) {
+  const int ncol = optics.tau.extent(0);
+  const int nlay = optics.tau.extent(1);
+  const int ngpt = gpt_map.extent(1);
+  OpticalProps1sclK subsampled;
+  subsampled.init(optics.get_band_lims_wavenumber(), band_lims_gpt, "subsampled_gpoints");
+  subsampled.alloc_1scl(ncol, nlay);
+  Kokkos::parallel_for(conv::get_mdrp<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
+    subsampled.tau(icol,ilay,igpt) = optics.tau(icol,ilay,gpt_map(icol,igpt));
+  });
+  return subsampled;
+}
+static void subsample_gpoints(real2dk &src, int2dk &gpt_map, real1dk &gpt_weights, real2dk &dst) {
+  const int ncol = src.extent(0);
+  const int ngpt = gpt_map.extent(1);
+  Kokkos::parallel_for(conv::get_mdrp<2>({ngpt,ncol}), KOKKOS_LAMBDA(int igpt, int icol) {
+    dst(icol,igpt) = gpt_weights(igpt) * src(icol,gpt_map(icol,igpt));
+  });
+}
+static void subsample_gpoints(real3dk &src, int2dk &gpt_map, real1dk &gpt_weights, real3dk &dst) {
+  const int ncol = src.extent(0);
+  const int nlev = src.extent(1);
+  const int ngpt = gpt_map.extent(1);
+  Kokkos::parallel_for(conv::get_mdrp<3>({ngpt,nlev,ncol}), KOKKOS_LAMBDA(int igpt, int ilev, int icol) {
+    dst(icol,ilev,igpt) = gpt_weights(igpt) * src(icol,ilev,gpt_map(icol,igpt));
+  });
+}
+static SourceFuncLWK subsample_gpoints(SourceFuncLWK &sources, OpticalPropsK &optics, int2dk &gpt_map, real1dk &gpt_weights) {
+  SourceFuncLWK subsampled;
+  subsampled.alloc(sources.lay_source.extent(0), sources.lay_source.extent(1), optics);
+  subsample_gpoints(sources.lay_source,     gpt_map, gpt_weights, subsampled.lay_source);
+  subsample_gpoints(sources.lev_source_inc, gpt_map, gpt_weights, subsampled.lev_source_inc);
+  subsample_gpoints(sources.lev_source_dec, gpt_map, gpt_weights, subsampled.lev_source_dec);
+  subsample_gpoints(sources.sfc_source,     gpt_map, gpt_weights, subsampled.sfc_source);
+  return subsampled;
+}
+#endif
+
 #ifdef RRTMGP_ENABLE_YAKL
 void rrtmgp_sw(
   const int ncol, const int nlay,
@@ -1178,7 +1394,8 @@ void rrtmgp_sw(
   FluxesByband &fluxes, FluxesBroadband &clnclrsky_fluxes, FluxesBroadband &clrsky_fluxes, FluxesBroadband &clnsky_fluxes,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac) {
 
   // Get problem sizes
   int nbnd = k_dist.get_nband();
@@ -1346,7 +1563,11 @@ void rrtmgp_sw(
 
   k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_limited, gas_concs_day, optics, toa_flux);
   if (extra_clnsky_diag) {
-    k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_limited, gas_concs_day, optics_no_aerosols, toa_flux);
+    // Gas optics do not depend on aerosols/clouds, so reuse the gas optical
+    // properties rather than calling gas_optics a second time on the same state
+    optics.tau.deep_copy_to(optics_no_aerosols.tau);
+    optics.ssa.deep_copy_to(optics_no_aerosols.ssa);
+    optics.g  .deep_copy_to(optics_no_aerosols.g  );
   }
 
 #ifdef SCREAM_RRTMGP_DEBUG
@@ -1361,6 +1582,21 @@ void rrtmgp_sw(
       toa_flux(iday,igpt) = tsi_scaling * toa_flux(iday,igpt);
     });
 
+  // Fast mode: only do radiative transfer on a random subset of the g-points
+  if (gpt_sampling_frac < 1) {
+    int2d band_lims_gpt;
+    real1d gpt_weights;
+    auto gpt_map = get_gpoint_subsample(nday, gpt_sampling_frac, k_dist, t_lay_day, band_lims_gpt, gpt_weights);
+    optics = subsample_gpoints(optics, band_lims_gpt, gpt_map);
+    if (extra_clnsky_diag) {
+      optics_no_aerosols = subsample_gpoints(optics_no_aerosols, band_lims_gpt, gpt_map);
+    }
+    clouds_day = subsample_gpoints(clouds_day, band_lims_gpt, gpt_map);
+    real2d toa_flux_sub("toa_flux", nday, gpt_map.dimension[1]);
+    subsample_gpoints(toa_flux, gpt_map, gpt_weights, toa_flux_sub);
+    toa_flux = toa_flux_sub;
+  }
+
   if (extra_clnclrsky_diag) {
     // Compute clear-clean-sky (just gas) fluxes on daytime columns
     rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
@@ -1435,7 +1671,8 @@ void rrtmgp_sw(
   FluxesBybandK &fluxes, FluxesBroadbandK &clnclrsky_fluxes, FluxesBroadbandK &clrsky_fluxes, FluxesBroadbandK &clnsky_fluxes,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac) {
 
   // Get problem sizes
   int nbnd = k_dist.get_nband();
@@ -1604,7 +1841,10 @@ void rrtmgp_sw(
 
   k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_limited, gas_concs_day, col_gas, optics, toa_flux);
   if (extra_clnsky_diag) {
-    k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_limited, gas_concs_day, col_gas, optics_no_aerosols, toa_flux);
+    // Reuse the gas optical properties (see YAKL version above)
+    Kokkos::deep_copy(optics_no_aerosols.tau, optics.tau);
+    Kokkos::deep_copy(optics_no_aerosols.ssa, optics.ssa);
+    Kokkos::deep_copy(optics_no_aerosols.g,   optics.g);
   }
 
 #ifdef SCREAM_RRTMGP_DEBUG
@@ -1619,6 +1859,21 @@ void rrtmgp_sw(
     toa_flux(iday,igpt) = tsi_scaling * toa_flux(iday,igpt);
   });
 
+  // Fast mode: only do radiative transfer on a random subset of the g-points
+  if (gpt_sampling_frac < 1) {
+    int2dk band_lims_gpt;
+    real1dk gpt_weights;
+    auto gpt_map = get_gpoint_subsample(nday, gpt_sampling_frac, k_dist, t_lay_day, band_lims_gpt, gpt_weights);
+    optics = subsample_gpoints(optics, band_lims_gpt, gpt_map);
+    if (extra_clnsky_diag) {
+      optics_no_aerosols = subsample_gpoints(optics_no_aerosols, band_lims_gpt, gpt_map);
+    }
+    clouds_day = subsample_gpoints(clouds_day, band_lims_gpt, gpt_map);
+    real2dk toa_flux_sub("toa_flux", nday, gpt_map.extent(1));
+    subsample_gpoints(toa_flux, gpt_map, gpt_weights, toa_flux_sub);
+    toa_flux = toa_flux_sub;
+  }
+
   if (extra_clnclrsky_diag) {
     // Compute clear-clean-sky (just gas) fluxes on daytime columns
     rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
@@ -1692,7 +1947,8 @@ void rrtmgp_lw(
   OpticalProps1scl &aerosol,
   OpticalProps1scl &clouds,
   FluxesByband &fluxes, FluxesBroadband &clnclrsky_fluxes, FluxesBroadband &clrsky_fluxes, FluxesBroadband &clnsky_fluxes,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac) {
 
   // Problem size
   int nbnd = k_dist.get_nband();
@@ -1783,7 +2039,22 @@ void rrtmgp_lw(
   // Do gas optics
   k_dist.gas_optics(ncol, nlay, top_at_1, p_lay, p_lev, t_lay_limited, t_sfc, gas_concs, optics, lw_sources, real2d(), t_lev_limited);
   if (extra_clnsky_diag) {
-    k_dist.gas_optics(ncol, nlay, top_at_1, p_lay, p_lev, t_lay_limited, t_sfc, gas_concs, optics_no_aerosols, lw_sources, real2d(), t_lev_limited);
+    // Only optical depths need a copy: lw_sources do not change when adding aerosols/clouds
+    optics.tau.deep_copy_to(optics_no_aerosols.tau);
+  }
+
+  // Fast mode: only do radiative transfer on a random subset of the g-points
+  OpticalProps1scl clouds_gpt = clouds;
+  if (gpt_sampling_frac < 1) {
+    int2d band_lims_gpt;
+    real1d gpt_weights;
+    auto gpt_map = get_gpoint_subsample(ncol, gpt_sampling_frac, k_dist, t_lay, band_lims_gpt, gpt_weights);
+    optics = subsample_gpoints(optics, band_lims_gpt, gpt_map);
+    if (extra_clnsky_diag) {
+      optics_no_aerosols = subsample_gpoints(optics_no_aerosols, band_lims_gpt, gpt_map);
+    }
+    clouds_gpt = subsample_gpoints(clouds, band_lims_gpt, gpt_map);
+    lw_sources = subsample_gpoints(lw_sources, optics, gpt_map, gpt_weights);
   }
 
 #ifdef SCREAM_RRTMGP_DEBUG
@@ -1803,14 +2074,14 @@ void rrtmgp_lw(
   rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, optics, top_at_1, lw_sources, emis_sfc, clrsky_fluxes);
 
   // Combine gas and cloud optics
-  clouds.increment(optics);
+  clouds_gpt.increment(optics);
 
   // Compute allsky fluxes
   rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, optics, top_at_1, lw_sources, emis_sfc, fluxes);
 
   if (extra_clnsky_diag) {
     // First increment clouds in optics_no_aerosols
-    clouds.increment(optics_no_aerosols);
+    clouds_gpt.increment(optics_no_aerosols);
     // Compute clean-sky fluxes
     rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, optics_no_aerosols, top_at_1, lw_sources, emis_sfc, clnsky_fluxes);
   }
@@ -1826,7 +2097,8 @@ void rrtmgp_lw(
   OpticalProps1sclK &aerosol,
   OpticalProps1sclK &clouds,
   FluxesBybandK &fluxes, FluxesBroadbandK &clnclrsky_fluxes, FluxesBroadbandK &clrsky_fluxes, FluxesBroadbandK &clnsky_fluxes,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac) {
 
   // Problem size
   int nbnd = k_dist.get_nband();
@@ -1921,7 +2193,22 @@ void rrtmgp_lw(
   realOff3dk col_gas("col_gas", std::make_pair(0, ncol-1), std::make_pair(0, nlay-1), std::make_pair(-1, k_dist.get_ngas()-1));
   k_dist.gas_optics(ncol, nlay, top_at_1, p_lay, p_lev, t_lay_limited, t_sfc, gas_concs, col_gas, optics, lw_sources, real2dk(), t_lev_limited);
   if (extra_clnsky_diag) {
-    k_dist.gas_optics(ncol, nlay, top_at_1, p_lay, p_lev, t_lay_limited, t_sfc, gas_concs, col_gas, optics_no_aerosols, lw_sources, real2dk(), t_lev_limited);
+    // Only optical depths need a copy: lw_sources do not change when adding aerosols/clouds
+    Kokkos::deep_copy(optics_no_aerosols.tau, optics.tau);
+  }
+
+  // Fast mode: only do radiative transfer on a random subset of the g-points
+  OpticalProps1sclK clouds_gpt = clouds;
+  if (gpt_sampling_frac < 1) {
+    int2dk band_lims_gpt;
+    real1dk gpt_weights;
+    auto gpt_map = get_gpoint_subsample(ncol, gpt_sampling_frac, k_dist, t_lay, band_lims_gpt, gpt_weights);
+    optics = subsample_gpoints(optics, band_lims_gpt, gpt_map);
+    if (extra_clnsky_diag) {
+      optics_no_aerosols = subsample_gpoints(optics_no_aerosols, band_lims_gpt, gpt_map);
+    }
+    clouds_gpt = subsample_gpoints(clouds, band_lims_gpt, gpt_map);
+    lw_sources = subsample_gpoints(lw_sources, optics, gpt_map, gpt_weights);
   }
 
 #ifdef SCREAM_RRTMGP_DEBUG
@@ -1941,14 +2228,14 @@ void rrtmgp_lw(
   rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, optics, top_at_1, lw_sources, emis_sfc, clrsky_fluxes);
 
   // Combine gas and cloud optics
-  clouds.increment(optics);
+  clouds_gpt.increment(optics);
 
   // Compute allsky fluxes
   rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, optics, top_at_1, lw_sources, emis_sfc, fluxes);
 
   if (extra_clnsky_diag) {
     // First increment clouds in optics_no_aerosols
-    clouds.increment(optics_no_aerosols);
+    clouds_gpt.increment(optics_no_aerosols);
     // Compute clean-sky fluxes
     rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, optics_no_aerosols, top_at_1, lw_sources, emis_sfc, clnsky_fluxes);
   }
@@ -137,7 +137,8 @@ extern void rrtmgp_main(
   real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false);
+  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false,
+  const Real gpt_sampling_frac = 1);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
 extern void rrtmgp_main(
@@ -161,7 +162,8 @@ extern void rrtmgp_main(
   real3dk &lw_bnd_flux_up, real3dk &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false);
+  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false,
+  const Real gpt_sampling_frac = 1);
 #endif
 
 /*
@@ -183,7 +185,8 @@ extern void rrtmgp_sw(
   FluxesByband &fluxes, FluxesBroadband &clnclrsky_fluxes, FluxesBroadband &clrsky_fluxes, FluxesBroadband &clnsky_fluxes,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag);
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
 extern void rrtmgp_sw(
@@ -196,7 +199,8 @@ extern void rrtmgp_sw(
   FluxesBybandK &fluxes, FluxesBroadbandK &clnclrsky_fluxes, FluxesBroadbandK &clrsky_fluxes, FluxesBroadbandK &clnsky_fluxes,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag);
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac);
 #endif
 
 /*
@@ -210,7 +214,8 @@ extern void rrtmgp_lw(
   GasConcs &gas_concs,
   OpticalProps1scl &aerosol, OpticalProps1scl &clouds,
   FluxesByband &fluxes, FluxesBroadband &clnclrsky_fluxes, FluxesBroadband &clrsky_fluxes, FluxesBroadband &clnsky_fluxes,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag);
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
 extern void rrtmgp_lw(
@@ -220,7 +225,8 @@ extern void rrtmgp_lw(
   GasConcsK &gas_concs,
   OpticalProps1sclK &aerosol, OpticalProps1sclK &clouds,
   FluxesBybandK &fluxes, FluxesBroadbandK &clnclrsky_fluxes, FluxesBroadbandK &clrsky_fluxes, FluxesBroadbandK &clnsky_fluxes,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag);
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const Real gpt_sampling_frac);
 #endif
 
 /*
@@ -233,6 +239,23 @@ int3d get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d
 int3dk get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2dk &cldf, const int overlap_option, int1dk &seeds);
 #endif
 
+/*
+ * Stochastic g-point subsampling (spectral fast mode). For each column, draw a random
+ * subset of max(1,round(frac*ngpt_band)) distinct g-points in each band. Returns the
+ * (ncol,ngpt_sub) map from sampled to full g-point index, and sets the g-point limits
+ * of each band in the sampled set, as well as the weight (ngpt_band/nsample_band)
+ * of each sampled g-point. Scaling the sources of the sampled g-points by these
+ * weights gives unbiased estimates of the band and broadband fluxes.
+ */
+#ifdef RRTMGP_ENABLE_YAKL
+int2d get_gpoint_subsample(const int ncol, const Real frac, OpticalProps &kdist, real2d &t_lay,
+                           int2d &band_lims_gpt, real1d &gpt_weights);
+#endif
+#ifdef RRTMGP_ENABLE_KOKKOS
+int2dk get_gpoint_subsample(const int ncol, const Real frac, OpticalPropsK &kdist, real2dk &t_lay,
+                            int2dk &band_lims_gpt, real1dk &gpt_weights);
+#endif
+
 /*
  * Compute cloud area from 3d subcol cloud property
  */
@@ -12,6 +12,7 @@
 #endif
 #include "ekat/util/ekat_test_utils.hpp"
 
+#include <chrono>
 #include <cmath>
 #include <mpi.h>
 
@@ -47,6 +48,9 @@ int run_yakl(int argc, char** argv) {
     return 1;
   }
   std::string inputfile, baseline, device;
+  // If gpt_frac<1, also benchmark the g-point subsampling fast mode against the full calculation
+  Real gpt_frac = 1;
+  int nrep = 10;
 
   for (int i = 1; i < argc-1; ++i) {
     if (ekat::argv_matches(argv[i], "-b", "--baseline-file")) {
@@ -59,6 +63,16 @@ int run_yakl(int argc, char** argv) {
       ++i;
       inputfile = argv[i];
     }
+    if (ekat::argv_matches(argv[i], "-s", "--gpt-sampling-frac")) {
+      expect_another_arg(i, argc);
+      ++i;
+      gpt_frac = std::stod(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-n", "--num-reps")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nrep = std::stoi(argv[i]);
+    }
     // RRTMGP baselines tests to not use kokoks. Swallow the arg, but ignore it
     if (std::string(argv[i])=="--ekat-kokkos-device") {
       expect_another_arg(i, argc);
@@ -203,27 +217,30 @@ int run_yakl(int argc, char** argv) {
   // Run RRTMGP code on dummy atmosphere
   logger->info("Run RRTMGP...\n");
   const Real tsi_scaling = 1;
-  scream::rrtmgp::rrtmgp_main(
-    ncol, nlay,
-    p_lay, t_lay, p_lev, t_lev, gas_concs,
-    sfc_alb_dir, sfc_alb_dif, mu0,
-    lwp, iwp, rel, rei, cld,
-    aer_tau_sw, aer_ssa_sw, aer_asm_sw, aer_tau_lw,
-    cld_tau_sw_bnd, cld_tau_lw_bnd,  // outputs
-    cld_tau_sw, cld_tau_lw,  // outputs
-    sw_flux_up, sw_flux_dn, sw_flux_dir,
-    lw_flux_up, lw_flux_dn,
-    sw_clnclrsky_flux_up, sw_clnclrsky_flux_dn, sw_clnclrsky_flux_dir,
-    sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dir,
-    sw_clnsky_flux_up, sw_clnsky_flux_dn, sw_clnsky_flux_dir,
-    lw_clnclrsky_flux_up, lw_clnclrsky_flux_dn,
-    lw_clrsky_flux_up, lw_clrsky_flux_dn,
-    lw_clnsky_flux_up, lw_clnsky_flux_dn,
-    sw_bnd_flux_up, sw_bnd_flux_dn, sw_bnd_flux_dir,
-    lw_bnd_flux_up, lw_bnd_flux_dn, tsi_scaling, logger,
-    true, true // extra_clnclrsky_diag, extra_clnsky_diag
-    // set them both to true because we are testing them below
-  );
+  auto run_rrtmgp = [&](const Real frac) {
+    scream::rrtmgp::rrtmgp_main(
+      ncol, nlay,
+      p_lay, t_lay, p_lev, t_lev, gas_concs,
+      sfc_alb_dir, sfc_alb_dif, mu0,
+      lwp, iwp, rel, rei, cld,
+      aer_tau_sw, aer_ssa_sw, aer_asm_sw, aer_tau_lw,
+      cld_tau_sw_bnd, cld_tau_lw_bnd,  // outputs
+      cld_tau_sw, cld_tau_lw,  // outputs
+      sw_flux_up, sw_flux_dn, sw_flux_dir,
+      lw_flux_up, lw_flux_dn,
+      sw_clnclrsky_flux_up, sw_clnclrsky_flux_dn, sw_clnclrsky_flux_dir,
+      sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dir,
+      sw_clnsky_flux_up, sw_clnsky_flux_dn, sw_clnsky_flux_dir,
+      lw_clnclrsky_flux_up, lw_clnclrsky_flux_dn,
+      lw_clrsky_flux_up, lw_clrsky_flux_dn,
+      lw_clnsky_flux_up, lw_clnsky_flux_dn,
+      sw_bnd_flux_up, sw_bnd_flux_dn, sw_bnd_flux_dir,
+      lw_bnd_flux_up, lw_bnd_flux_dn, tsi_scaling, logger,
+      true, true, // extra_clnclrsky_diag, extra_clnsky_diag
+      // set them both to true because we are testing them below
+      frac);
+  };
+  run_rrtmgp(1);
 
   // Check values against baseline
   logger->info("Check values...\n");
@@ -251,6 +268,40 @@ int run_yakl(int argc, char** argv) {
   if (!rrtmgpTest::all_close(lw_flux_dn , lw_clnsky_flux_dn , 0.0000000001)) nerr++;
   if (!rrtmgpTest::all_close(lw_clrsky_flux_dn , lw_clnclrsky_flux_dn , 0.0000000001)) nerr++;
 
+  // Benchmark the g-point subsampling fast mode against the full calculation
+  if (gpt_frac < 1) {
+    using clock = std::chrono::steady_clock;
+    auto time_rrtmgp = [&](const Real frac) {
+      yakl::fence();
+      auto start = clock::now();
+      for (int irep = 0; irep < nrep; ++irep) {
+        run_rrtmgp(frac);
+      }
+      yakl::fence();
+      return std::chrono::duration<double>(clock::now()-start).count() / nrep;
+    };
+    const double t_full = time_rrtmgp(1);
+    auto sw_flux_dn_full = sw_flux_dn.createHostCopy();
+    auto lw_flux_dn_full = lw_flux_dn.createHostCopy();
+    const double t_fast = time_rrtmgp(gpt_frac);
+    auto sw_flux_dn_fast = sw_flux_dn.createHostCopy();
+    auto lw_flux_dn_fast = lw_flux_dn.createHostCopy();
+
+    // Noise of a single fast-mode call (the fast mode is unbiased on average)
+    double sw_err = 0, lw_err = 0;
+    for (int icol = 1; icol <= ncol; ++icol) {
+      for (int ilev = 1; ilev <= nlay+1; ++ilev) {
+        sw_err = std::max(sw_err, double(std::abs(sw_flux_dn_fast(icol,ilev) - sw_flux_dn_full(icol,ilev))));
+        lw_err = std::max(lw_err, double(std::abs(lw_flux_dn_fast(icol,ilev) - lw_flux_dn_full(icol,ilev))));
+      }
+    }
+    logger->info("Benchmark of g-point subsampling, fraction " + std::to_string(gpt_frac) + ":\n"
+                 "  time per call (full): " + std::to_string(t_full) + " s\n"
+                 "  time per call (fast): " + std::to_string(t_fast) + " s\n"
+                 "  speedup: " + std::to_string(t_full/t_fast) + "\n"
+                 "  max abs diff of SW/LW flux_dn: " + std::to_string(sw_err) + " / " + std::to_string(lw_err) + " W/m2\n");
+  }
+
   logger->info("Cleaning up...\n");
   // Clean up or else YAKL will throw errors
   scream::rrtmgp::rrtmgp_finalize();
@@ -333,6 +384,9 @@ int run_kokkos(int argc, char** argv) {
     return 1;
   }
   std::string inputfile, baseline, device;
+  // If gpt_frac<1, also benchmark the g-point subsampling fast mode against the full calculation
+  Real gpt_frac = 1;
+  int nrep = 10;
 
   for (int i = 1; i < argc-1; ++i) {
     if (ekat::argv_matches(argv[i], "-b", "--baseline-file")) {
@@ -345,6 +399,16 @@ int run_kokkos(int argc, char** argv) {
       ++i;
       inputfile = argv[i];
     }
+    if (ekat::argv_matches(argv[i], "-s", "--gpt-sampling-frac")) {
+      expect_another_arg(i, argc);
+      ++i;
+      gpt_frac = std::stod(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-n", "--num-reps")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nrep = std::stoi(argv[i]);
+    }
     // RRTMGP baselines tests to not use kokoks. Swallow the arg, but ignore it
     if (std::string(argv[i])=="--ekat-kokkos-device") {
       expect_another_arg(i, argc);
@@ -489,27 +553,30 @@ int run_kokkos(int argc, char** argv) {
   // Run RRTMGP code on dummy atmosphere
   logger->info("Run RRTMGP...\n");
   const Real tsi_scaling = 1;
-  scream::rrtmgp::rrtmgp_main(
-    ncol, nlay,
-    p_lay, t_lay, p_lev, t_lev, gas_concs,
-    sfc_alb_dir, sfc_alb_dif, mu0,
-    lwp, iwp, rel, rei, cld,
-    aer_tau_sw, aer_ssa_sw, aer_asm_sw, aer_tau_lw,
-    cld_tau_sw_bnd, cld_tau_lw_bnd,  // outputs
-    cld_tau_sw, cld_tau_lw,  // outputs
-    sw_flux_up, sw_flux_dn, sw_flux_dir,
-    lw_flux_up, lw_flux_dn,
-    sw_clnclrsky_flux_up, sw_clnclrsky_flux_dn, sw_clnclrsky_flux_dir,
-    sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dir,
-    sw_clnsky_flux_up, sw_clnsky_flux_dn, sw_clnsky_flux_dir,
-    lw_clnclrsky_flux_up, lw_clnclrsky_flux_dn,
-    lw_clrsky_flux_up, lw_clrsky_flux_dn,
-    lw_clnsky_flux_up, lw_clnsky_flux_dn,
-    sw_bnd_flux_up, sw_bnd_flux_dn, sw_bnd_flux_dir,
-    lw_bnd_flux_up, lw_bnd_flux_dn, tsi_scaling, logger,
-    true, true // extra_clnclrsky_diag, extra_clnsky_diag
-    // set them both to true because we are testing them below
-  );
+  auto run_rrtmgp = [&](const Real frac) {
+    scream::rrtmgp::rrtmgp_main(
+      ncol, nlay,
+      p_lay, t_lay, p_lev, t_lev, gas_concs,
+      sfc_alb_dir, sfc_alb_dif, mu0,
+      lwp, iwp, rel, rei, cld,
+      aer_tau_sw, aer_ssa_sw, aer_asm_sw, aer_tau_lw,
+      cld_tau_sw_bnd, cld_tau_lw_bnd,  // outputs
+      cld_tau_sw, cld_tau_lw,  // outputs
+      sw_flux_up, sw_flux_dn, sw_flux_dir,
+      lw_flux_up, lw_flux_dn,
+      sw_clnclrsky_flux_up, sw_clnclrsky_flux_dn, sw_clnclrsky_flux_dir,
+      sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dir,
+      sw_clnsky_flux_up, sw_clnsky_flux_dn, sw_clnsky_flux_dir,
+      lw_clnclrsky_flux_up, lw_clnclrsky_flux_dn,
+      lw_clrsky_flux_up, lw_clrsky_flux_dn,
+      lw_clnsky_flux_up, lw_clnsky_flux_dn,
+      sw_bnd_flux_up, sw_bnd_flux_dn, sw_bnd_flux_dir,
+      lw_bnd_flux_up, lw_bnd_flux_dn, tsi_scaling, logger,
+      true, true, // extra_clnclrsky_diag, extra_clnsky_diag
+      // set them both to true because we are testing them below
+      frac);
+  };
+  run_rrtmgp(1);
 
   // Check values against baseline
   logger->info("Check values...\n");
@@ -537,6 +604,40 @@ int run_kokkos(int argc, char** argv) {
   if (!rrtmgpTest::all_close(lw_flux_dn , lw_clnsky_flux_dn , 0.0000000001)) nerr++;
   if (!rrtmgpTest::all_close(lw_clrsky_flux_dn , lw_clnclrsky_flux_dn , 0.0000000001)) nerr++;
 
+  // Benchmark the g-point subsampling fast mode against the full calculation
+  if (gpt_frac < 1) {
+    using clock = std::chrono::steady_clock;
+    auto time_rrtmgp = [&](const Real frac) {
+      Kokkos::fence();
+      auto start = clock::now();
+      for (int irep = 0; irep < nrep; ++irep) {
+        run_rrtmgp(frac);
+      }
+      Kokkos::fence();
+      return std::chrono::duration<double>(clock::now()-start).count() / nrep;
+    };
+    const double t_full = time_rrtmgp(1);
+    auto sw_flux_dn_full = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),sw_flux_dn);
+    auto lw_flux_dn_full = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),lw_flux_dn);
+    const double t_fast = time_rrtmgp(gpt_frac);
+    auto sw_flux_dn_fast = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),sw_flux_dn);
+    auto lw_flux_dn_fast = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),lw_flux_dn);
+
+    // Noise of a single fast-mode call (the fast mode is unbiased on average)
+    double sw_err = 0, lw_err = 0;
+    for (int icol = 0; icol < ncol; ++icol) {
+      for (int ilev = 0; ilev < nlay+1; ++ilev) {
+        sw_err = std::max(sw_err, double(std::abs(sw_flux_dn_fast(icol,ilev) - sw_flux_dn_full(icol,ilev))));
+        lw_err = std::max(lw_err, double(std::abs(lw_flux_dn_fast(icol,ilev) - lw_flux_dn_full(icol,ilev))));
+      }
+    }
+    logger->info("Benchmark of g-point subsampling, fraction " + std::to_string(gpt_frac) + ":\n"
+                 "  time per call (full): " + std::to_string(t_full) + " s\n"
+                 "  time per call (fast): " + std::to_string(t_fast) + " s\n"
+                 "  speedup: " + std::to_string(t_full/t_fast) + "\n"
+                 "  max abs diff of SW/LW flux_dn: " + std::to_string(sw_err) + " / " + std::to_string(lw_err) + " W/m2\n");
+  }
+
   logger->info("Cleaning up...\n");
   // Clean up or else YAKL will throw errors
   scream::rrtmgp::rrtmgp_finalize();
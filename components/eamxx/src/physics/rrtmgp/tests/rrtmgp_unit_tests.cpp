@@ -526,6 +526,79 @@ TEST_CASE("rrtmgp_test_subcol_gen") {
     yakl::finalize();
 }
 
+TEST_CASE("rrtmgp_test_gpoint_subsample") {
+    if (!yakl::isInitialized()) { yakl::init(); }
+    {  // Scope, so that all arrays are freed before yakl::finalize
+        // Dummy k-distribution with bands of different sizes
+        const int nbnd = 4;
+        const int ngpt_bnd[nbnd] = {16, 8, 12, 4};
+        auto band_lims_wvn = real2d("band_lims_wvn", 2, nbnd);
+        auto band_lims_gpt_full = int2d("band_lims_gpt_full", 2, nbnd);
+        auto band_lims_wvn_h = band_lims_wvn.createHostCopy();
+        auto band_lims_gpt_full_h = band_lims_gpt_full.createHostCopy();
+        int ngpt = 0;
+        for (int ibnd = 1; ibnd <= nbnd; ibnd++) {
+            band_lims_wvn_h(1,ibnd) = 100*ibnd;
+            band_lims_wvn_h(2,ibnd) = 100*(ibnd+1);
+            band_lims_gpt_full_h(1,ibnd) = ngpt + 1;
+            band_lims_gpt_full_h(2,ibnd) = ngpt + ngpt_bnd[ibnd-1];
+            ngpt += ngpt_bnd[ibnd-1];
+        }
+        band_lims_wvn_h.deep_copy_to(band_lims_wvn);
+        band_lims_gpt_full_h.deep_copy_to(band_lims_gpt_full);
+        OpticalProps kdist;
+        kdist.init(band_lims_wvn, band_lims_gpt_full, "kdist");
+
+        // Each column draws its own sample, seeded by the decimal part of its temperature
+        const int ncol = 10000;
+        const int nlay = 2;
+        auto t_lay = real2d("t_lay", ncol, nlay);
+        yakl::fortran::parallel_for(yakl::fortran::SimpleBounds<2>(nlay,ncol), YAKL_LAMBDA(int ilay, int icol) {
+            t_lay(icol,ilay) = 250 + 0.5*(1 + sin(Real(icol)));
+        });
+
+        // An arbitrary per-gpoint quantity, and its sum over all g-points
+        auto x = [](int igpt) { return 1 + std::sin(Real(igpt)); };
+        Real full_sum = 0;
+        for (int igpt = 1; igpt <= ngpt; igpt++) { full_sum += x(igpt); }
+
+        for (Real frac : {0.25, 1.0}) {
+            int2d band_lims_gpt;
+            real1d gpt_weights;
+            auto gpt_map = scream::rrtmgp::get_gpoint_subsample(ncol, frac, kdist, t_lay, band_lims_gpt, gpt_weights);
+            auto gpt_map_h = gpt_map.createHostCopy();
+            auto band_lims_gpt_h = band_lims_gpt.createHostCopy();
+            auto gpt_weights_h = gpt_weights.createHostCopy();
+
+            // Weighted sum over the sampled g-points of each column. Sampled g-points must be
+            // distinct, and belong to the band they are sampled for.
+            Real mean = 0;
+            for (int icol = 1; icol <= ncol; icol++) {
+                Real est = 0;
+                for (int ibnd = 1; ibnd <= nbnd; ibnd++) {
+                    int prev = 0;
+                    for (int igpt = band_lims_gpt_h(1,ibnd); igpt <= band_lims_gpt_h(2,ibnd); igpt++) {
+                        const int ifull = gpt_map_h(icol,igpt);
+                        REQUIRE(ifull > prev);
+                        REQUIRE(ifull >= band_lims_gpt_full_h(1,ibnd));
+                        REQUIRE(ifull <= band_lims_gpt_full_h(2,ibnd));
+                        prev = ifull;
+                        est += gpt_weights_h(igpt)*x(ifull);
+                    }
+                }
+                if (frac == 1) {
+                    // No subsampling: all g-points, with unit weights, so the sum is exact
+                    REQUIRE(est == full_sum);
+                }
+                mean += est / ncol;
+            }
+            // The estimator is unbiased, so the mean over many draws approaches the full sum
+            REQUIRE(std::abs(mean - full_sum) < 0.01*full_sum);
+        }
+    }
+    yakl::finalize();
+}
+
 
 TEST_CASE("rrtmgp_cloud_area") {
     // Initialize YAKL
@@ -1328,6 +1401,77 @@ TEST_CASE("rrtmgp_test_subcol_gen_k") {
   scream::finalize_kls();
 }
 
+TEST_CASE("rrtmgp_test_gpoint_subsample_k") {
+  scream::init_kls();
+  // Dummy k-distribution with bands of different sizes
+  const int nbnd = 4;
+  const int ngpt_bnd[nbnd] = {16, 8, 12, 4};
+  auto band_lims_wvn = real2dk("band_lims_wvn", 2, nbnd);
+  auto band_lims_gpt_full = int2dk("band_lims_gpt_full", 2, nbnd);
+  auto band_lims_wvn_h = Kokkos::create_mirror_view(band_lims_wvn);
+  auto band_lims_gpt_full_h = Kokkos::create_mirror_view(band_lims_gpt_full);
+  int ngpt = 0;
+  for (int ibnd = 0; ibnd < nbnd; ibnd++) {
+    band_lims_wvn_h(0,ibnd) = 100*(ibnd+1);
+    band_lims_wvn_h(1,ibnd) = 100*(ibnd+2);
+    band_lims_gpt_full_h(0,ibnd) = ngpt;
+    band_lims_gpt_full_h(1,ibnd) = ngpt + ngpt_bnd[ibnd] - 1;
+    ngpt += ngpt_bnd[ibnd];
+  }
+  Kokkos::deep_copy(band_lims_wvn, band_lims_wvn_h);
+  Kokkos::deep_copy(band_lims_gpt_full, band_lims_gpt_full_h);
+  OpticalPropsK kdist;
+  kdist.init(band_lims_wvn, band_lims_gpt_full, "kdist");
+
+  // Each column draws its own sample, seeded by the decimal part of its temperature
+  const int ncol = 10000;
+  const int nlay = 2;
+  auto t_lay = real2dk("t_lay", ncol, nlay);
+  Kokkos::parallel_for(conv::get_mdrp<2>({nlay,ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
+    t_lay(icol,ilay) = 250 + 0.5*(1 + sin(Real(icol+1)));
+  });
+
+  // An arbitrary per-gpoint quantity, and its sum over all g-points
+  auto x = [](int igpt) { return 1 + std::sin(Real(igpt+1)); };
+  Real full_sum = 0;
+  for (int igpt = 0; igpt < ngpt; igpt++) { full_sum += x(igpt); }
+
+  for (Real frac : {0.25, 1.0}) {
+    int2dk band_lims_gpt;
+    real1dk gpt_weights;
+    auto gpt_map = scream::rrtmgp::get_gpoint_subsample(ncol, frac, kdist, t_lay, band_lims_gpt, gpt_weights);
+    auto gpt_map_h = chc(gpt_map);
+    auto band_lims_gpt_h = chc(band_lims_gpt);
+    auto gpt_weights_h = chc(gpt_weights);
+
+    // Weighted sum over the sampled g-points of each column. Sampled g-points must be
+    // distinct, and belong to the band they are sampled for.
+    Real mean = 0;
+    for (int icol = 0; icol < ncol; icol++) {
+      Real est = 0;
+      for (int ibnd = 0; ibnd < nbnd; ibnd++) {
+        int prev = -1;
+        for (int igpt = band_lims_gpt_h(0,ibnd); igpt <= band_lims_gpt_h(1,ibnd); igpt++) {
+          const int ifull = gpt_map_h(icol,igpt);
+          REQUIRE(ifull > prev);
+          REQUIRE(ifull >= band_lims_gpt_full_h(0,ibnd));
+          REQUIRE(ifull <= band_lims_gpt_full_h(1,ibnd));
+          prev = ifull;
+          est += gpt_weights_h(igpt)*x(ifull);
+        }
+      }
+      if (frac == 1) {
+        // No subsampling: all g-points, with unit weights, so the sum is exact
+        REQUIRE(est == full_sum);
+      }
+      mean += est / ncol;
+    }
+    // The estimator is unbiased, so the mean over many draws approaches the full sum
+    REQUIRE(std::abs(mean - full_sum) < 0.01*full_sum);
+  }
+  scream::finalize_kls();
+}
+
 TEST_CASE("rrtmgp_cloud_area_k") {
   // Initialize YAKL
   scream::init_kls();
@@ -1618,4 +1762,74 @@ TEST_CASE("rrtmgp_aerocom_cloudtop_k") {
 }
 #endif
 
+TEST_CASE("rrtmgp_test_flag_changed_columns") {
+  using Real = scream::Real;
+  using KT = ekat::KokkosTypes<scream::DefaultDevice>;
+  using view_1d_int  = KT::view_1d<int>;
+  using view_1d_real = KT::view_1d<Real>;
+  using view_2d_real = KT::view_2d<Real>;
+  using physconst = scream::physics::Constants<Real>;
+
+  const int ncol = 4;
+  const int nlay = 3;
+  view_2d_real cldfrac("cldfrac",ncol,nlay), tmid("tmid",ncol,nlay);
+  view_2d_real qc("qc",ncol,nlay), qi("qi",ncol,nlay), pdel("pdel",ncol,nlay);
+  view_2d_real cldfrac_ref("cldfrac_ref",ncol,nlay), tmid_ref("tmid_ref",ncol,nlay);
+  view_1d_real wp_ref("wp_ref",ncol);
+  view_1d_int flags("flags",ncol);
+  Kokkos::deep_copy(cldfrac,0.5);
+  Kokkos::deep_copy(tmid,250);
+  Kokkos::deep_copy(qc,1e-5);
+  Kokkos::deep_copy(qi,1e-5);
+  Kokkos::deep_copy(pdel,1e4);
+
+  const Real cld_tol = 0.1, t_tol = 1, wp_tol = 0.01;
+  auto flag = [&](const bool force) {
+    return scream::rrtmgp::flag_changed_columns(cldfrac, tmid, qc, qi, pdel,
+                                                cldfrac_ref, tmid_ref, wp_ref,
+                                                cld_tol, t_tol, wp_tol, force, flags);
+  };
+  auto h = [](const auto& v) {
+    return Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  };
+  auto set = [&](const view_2d_real& v, const int icol, const int k, const Real val) {
+    Kokkos::parallel_for(1, KOKKOS_LAMBDA(int) { v(icol,k) = val; });
+  };
+
+  // The reference state is zero, so all columns are flagged, and the ref state is set
+  REQUIRE (flag(false)==ncol);
+  auto wp_ref_h = h(wp_ref);
+  const Real wp = nlay*2e-5*1e4/physconst::gravit;
+  for (int icol=0; icol<ncol; ++icol) {
+    REQUIRE (h(flags)(icol)==1);
+    REQUIRE (std::abs(wp_ref_h(icol)-wp) < 1e-12);
+  }
+
+  // Nothing changed: no column is flagged, unless we force it
+  REQUIRE (flag(false)==0);
+  REQUIRE (flag(true)==ncol);
+
+  // Perturb one field per column, below and above tolerance
+  set(cldfrac,0,1,0.55);   // below
+  set(tmid,1,2,251.5);     // above
+  set(qc,2,0,1e-5 + 2*wp_tol*physconst::gravit/1e4);  // above
+  set(cldfrac,3,0,0.8);    // above
+  REQUIRE (flag(false)==3);
+  auto flags_h = h(flags);
+  REQUIRE (flags_h(0)==0);
+  REQUIRE (flags_h(1)==1);
+  REQUIRE (flags_h(2)==1);
+  REQUIRE (flags_h(3)==1);
+
+  // Flagged columns updated their ref state, while col 0 kept the old one
+  REQUIRE (h(tmid_ref)(1,2)==251.5);
+  REQUIRE (h(cldfrac_ref)(0,1)==0.5);
+  REQUIRE (flag(false)==0);
+
+  // Small changes accumulate on unflagged columns
+  set(cldfrac,0,1,0.65);
+  REQUIRE (flag(false)==1);
+  REQUIRE (h(flags)(0)==1);
+}
+
 }
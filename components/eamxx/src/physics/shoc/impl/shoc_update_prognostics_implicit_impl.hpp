@@ -2,6 +2,7 @@
 #define SHOC_UPDATE_PROGNOSTICS_IMPLICIT_IMPL_HPP
 
 #include "shoc_functions.hpp" // for ETI only but harmless for GPU
+#include "share/util/scream_tridiag.hpp"
 
 namespace scream {
 namespace shoc {
@@ -58,6 +59,15 @@ void Functions<S,D>::update_prognostics_implicit(
   auto dl = Kokkos::subview(dl_workspace, Kokkos::make_pair(0,nlev));
   auto d  = Kokkos::subview(d_workspace,  Kokkos::make_pair(0,nlev));
 
+  // The BFB and the GPU (cyclic reduction) solvers need the RHS's laid out as (nlev,nrhs),
+  // so tracers, thetal, qw, and tke are transposed into qtracers_rhs. Otherwise, they
+  // are solved in place with a batched solver, which avoids the transpositions.
+#if defined(EKAT_DEFAULT_BFB) || defined(EAMXX_ENABLE_GPU)
+  constexpr bool transpose_tracers = true;
+#else
+  constexpr bool transpose_tracers = false;
+#endif
+
   // 2d allocations for solver RHS
   const int num_wind_transpose_packs = ekat::npack<Spack>(2);
   const int num_qtracers_transpose_packs = ekat::npack<Spack>(num_qtracers+3);
@@ -65,8 +75,11 @@ void Functions<S,D>::update_prognostics_implicit(
   const int n_wind_slots = num_wind_transpose_packs*Spack::n;
   const int n_trac_slots = num_qtracers_transpose_packs*Spack::n;
 
-  const auto wind_slot    = workspace.template take_macro_block<Scalar>("wind_slot",n_wind_slots);
-  const auto tracers_slot = workspace.template take_macro_block<Scalar>("tracers_slot",n_trac_slots);
+  const auto wind_slot = workspace.template take_macro_block<Scalar>("wind_slot",n_wind_slots);
+  std::remove_const_t<decltype(wind_slot)> tracers_slot;
+  if constexpr (transpose_tracers) {
+    tracers_slot = workspace.template take_macro_block<Scalar>("tracers_slot",n_trac_slots);
+  }
 
   // Reshape 2d views
   const auto wind_rhs     = uview_2d<Spack>(reinterpret_cast<Spack*>(wind_slot.data()),
@@ -151,13 +164,15 @@ void Functions<S,D>::update_prognostics_implicit(
     wind_rhs_s(k,0) = u_wind_s(k);
     wind_rhs_s(k,1) = v_wind_s(k);
 
-    // The rhs version of the tracers is the transpose of the input/output layout
-    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, num_qtracers), [&] (const Int& q) {
-      qtracers_rhs_s(k, q) = qtracers_s(q, k);
-    });
-    qtracers_rhs_s(k, num_qtracers)   = thetal_s(k);
-    qtracers_rhs_s(k, num_qtracers+1) = qw_s(k);
-    qtracers_rhs_s(k, num_qtracers+2) = tke_s(k);
+    if constexpr (transpose_tracers) {
+      // The rhs version of the tracers is the transpose of the input/output layout
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, num_qtracers), [&] (const Int& q) {
+        qtracers_rhs_s(k, q) = qtracers_s(q, k);
+      });
+      qtracers_rhs_s(k, num_qtracers)   = thetal_s(k);
+      qtracers_rhs_s(k, num_qtracers+1) = qw_s(k);
+      qtracers_rhs_s(k, num_qtracers+2) = tke_s(k);
+    }
   });
 
   // march u_wind and v_wind one step forward using implicit solver
@@ -179,7 +194,18 @@ void Functions<S,D>::update_prognostics_implicit(
 
     // Solve
     team.team_barrier();
-    vd_shoc_solve(team, du, dl, d, qtracers_rhs);
+    if constexpr (transpose_tracers) {
+      vd_shoc_solve(team, du, dl, d, qtracers_rhs);
+    } else {
+      // Factorize once, then solve each of tracers, thetal, qw, tke in place
+      scream::tridiag::factorize(team, dl, d, du);
+      team.team_barrier();
+      scream::tridiag::solve_batched(team, dl, d, du, num_qtracers+3, [&] (const Int& q) {
+        return q <  num_qtracers   ? &qtracers_s(q,0) :
+              (q == num_qtracers   ? thetal_s.data() :
+              (q == num_qtracers+1 ? qw_s.data() : tke_s.data()));
+      });
+    }
   }
 
   // Copy RHS values back into output variables
@@ -188,19 +214,23 @@ void Functions<S,D>::update_prognostics_implicit(
     u_wind_s(k) = wind_rhs_s(k, 0);
     v_wind_s(k) = wind_rhs_s(k, 1);
 
-    // Transpose tracers back to  input/output layout
-    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, num_qtracers), [&] (const Int& q) {
-      qtracers_s(q, k) = qtracers_rhs_s(k, q);
-    });
-    thetal_s(k) = qtracers_rhs_s(k, num_qtracers);
-    qw_s(k)     = qtracers_rhs_s(k, num_qtracers+1);
-    tke_s(k)    = qtracers_rhs_s(k, num_qtracers+2);
+    if constexpr (transpose_tracers) {
+      // Transpose tracers back to  input/output layout
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, num_qtracers), [&] (const Int& q) {
+        qtracers_s(q, k) = qtracers_rhs_s(k, q);
+      });
+      thetal_s(k) = qtracers_rhs_s(k, num_qtracers);
+      qw_s(k)     = qtracers_rhs_s(k, num_qtracers+1);
+      tke_s(k)    = qtracers_rhs_s(k, num_qtracers+2);
+    }
   });
 
 
   // Release temporary variables from the workspace
   team.team_barrier();
-  workspace.template release_macro_block<Scalar>(tracers_slot,n_trac_slots);
+  if constexpr (transpose_tracers) {
+    workspace.template release_macro_block<Scalar>(tracers_slot,n_trac_slots);
+  }
   workspace.template release_macro_block<Scalar>(wind_slot,n_wind_slots);
   workspace.template release_many_contiguous<3,Scalar>(
     {&du_workspace, &dl_workspace, &d_workspace});
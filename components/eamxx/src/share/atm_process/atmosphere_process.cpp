@@ -64,6 +64,10 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
       m_params.get<bool>("enable_column_conservation_checks", false);
 
   m_internal_diagnostics_level = m_params.get<int>("internal_diagnostics_level", 0);
+  m_internal_diagnostics_freq  = m_params.get<int>("internal_diagnostics_frequency", 1);
+  EKAT_REQUIRE_MSG (m_internal_diagnostics_freq>0,
+      "Error! Invalid internal diagnostics frequency in param list " + m_params.name() + ".\n"
+      "  - Frequency: " + std::to_string(m_internal_diagnostics_freq) + "\n");
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
@@ -100,6 +104,10 @@ void AtmosphereProcess::run (const double dt) {
   // Init single step tendencies (if any) with current value of output field
   init_step_tendencies ();
 
+  // In sampled mode, only hash the state every m_internal_diagnostics_freq steps
+  const bool print_hashes = m_internal_diagnostics_level > 0 and
+                            timestamp().get_num_steps() % m_internal_diagnostics_freq == 0;
+
   for (m_subcycle_iter=0; m_subcycle_iter<m_num_subcycles; ++m_subcycle_iter) {
 
     if (has_column_conservation_check()) {
@@ -109,14 +117,14 @@ void AtmosphereProcess::run (const double dt) {
       compute_column_conservation_checks_data(dt_sub);
     }
 
-    if (m_internal_diagnostics_level > 0)
+    if (print_hashes)
       print_global_state_hash(name() + "-pre-sc-" + std::to_string(m_subcycle_iter),
                               true, false, false);
 
     // Run derived class implementation
     run_impl(dt_sub);
 
-    if (m_internal_diagnostics_level > 0)
+    if (print_hashes)
       print_global_state_hash(name() + "-pst-sc-" + std::to_string(m_subcycle_iter),
                               true, true, true);
 
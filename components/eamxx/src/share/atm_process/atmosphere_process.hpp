@@ -21,6 +21,7 @@
 #include "ekat/std_meta/ekat_std_any.hpp"
 #include "ekat/logging/ekat_logger.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <set>
@@ -272,7 +273,9 @@ public:
   // Boolean that dictates whether or not the conservation checks are run for this process
   bool has_column_conservation_check () { return m_column_conservation_check_data.has_check; }
 
-  // For internal diagnostics and debugging.
+  // For internal diagnostics and debugging. Level 1 prints the global hashes
+  // of in/out/internal state, level 2 adds the global hash of each field, and
+  // level 3 writes per-column hashes to one file per rank.
   void print_global_state_hash(const std::string& label, const bool in = true,
                                const bool out = true, const bool internal = true) const;
   // For BFB tracking in production simulations.
@@ -586,6 +589,10 @@ private:
 
   // Controls global hashing output for debugging non-BFBness.
   int m_internal_diagnostics_level;
+  // Hash only every this many steps (sampled mode, for production runs).
+  int m_internal_diagnostics_freq;
+  // Device buffer for the per-column (or per-slice) hashes, reused across calls.
+  mutable KokkosTypes<DefaultDevice>::view_1d<std::uint64_t> m_state_hash_buffer;
 
 protected:
 
@@ -5,110 +5,124 @@
 #include "ekat/ekat_assert.hpp"
 
 #include <cstdint>
+#include <cstdio>
+#include <map>
+#include <vector>
 
 namespace scream {
 namespace {
 
 using ExeSpace = KokkosTypes<DefaultDevice>::ExeSpace;
 using bfbhash::HashType;
+using DevHashes  = KokkosTypes<DefaultDevice>::view_1d<HashType>;
+using HostHashes = DevHashes::HostMirror;
 
-void hash (const Field::view_dev_t<const Real*>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      bfbhash::hash(v(idx), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);  
-}
-
-void hash (const Field::view_dev_t<const Real**>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
+// Hash each slice v(i,...) of the view along its first dimension, and store the
+// result in hashes(offset+i). For fields whose first dimension is COL, these are
+// the column hashes. Since the hash is associative and commutative, combining
+// the slice hashes gives the same result as hashing the whole field at once.
+// No fence is done here, so that kernels of different fields can be queued up.
+template<typename ViewT>
+void hash_slices (const ViewT& v, const FieldLayout& lo,
+                  const DevHashes& hashes, const int offset) {
+  const int n0 = lo.dim(0);
+  if (n0==0) return;
+  const int slice_size = lo.size() / n0;
   const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j;
-      unflatten_idx(idx, dims, i, j);
-      bfbhash::hash(v(i,j), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
+  Kokkos::parallel_for(
+    Kokkos::RangePolicy<ExeSpace>(0, n0),
+    KOKKOS_LAMBDA(const int i0) {
+      HashType accum = 0;
+      for (int s = 0; s < slice_size; ++s) {
+        const int idx = i0*slice_size + s;
+        if constexpr (ViewT::rank==1) {
+          bfbhash::hash(v(idx), accum);
+        } else if constexpr (ViewT::rank==2) {
+          int i, j;
+          unflatten_idx(idx, dims, i, j);
+          bfbhash::hash(v(i,j), accum);
+        } else if constexpr (ViewT::rank==3) {
+          int i, j, k;
+          unflatten_idx(idx, dims, i, j, k);
+          bfbhash::hash(v(i,j,k), accum);
+        } else if constexpr (ViewT::rank==4) {
+          int i, j, k, m;
+          unflatten_idx(idx, dims, i, j, k, m);
+          bfbhash::hash(v(i,j,k,m), accum);
+        } else {
+          int i, j, k, m, n;
+          unflatten_idx(idx, dims, i, j, k, m, n);
+          bfbhash::hash(v(i,j,k,m,n), accum);
+        }
+      }
+      hashes(offset + i0) = accum;
+    });
 }
 
-void hash (const Field::view_dev_t<const Real***>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k;
-      unflatten_idx(idx, dims, i, j, k);
-      bfbhash::hash(v(i,j,k), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
-}
-
-void hash (const Field::view_dev_t<const Real****>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k, m;
-      unflatten_idx(idx, dims, i, j, k, m);
-      bfbhash::hash(v(i,j,k,m), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
+void hash_slices (const Field& f, const DevHashes& hashes, const int offset) {
+  const auto& lo = f.get_header().get_identifier().get_layout();
+  switch (lo.rank()) {
+  case 1: hash_slices(f.get_view<const Real*    >(), lo, hashes, offset); break;
+  case 2: hash_slices(f.get_view<const Real**   >(), lo, hashes, offset); break;
+  case 3: hash_slices(f.get_view<const Real***  >(), lo, hashes, offset); break;
+  case 4: hash_slices(f.get_view<const Real**** >(), lo, hashes, offset); break;
+  case 5: hash_slices(f.get_view<const Real*****>(), lo, hashes, offset); break;
+  default: break;
+  }
 }
 
-void hash (const Field::view_dev_t<const Real*****>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k, m, n;
-      unflatten_idx(idx, dims, i, j, k, m, n);
-      bfbhash::hash(v(i,j,k,m,n), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
-}
+// A field contributing to one of the hash slots (0: in, 1: out, 2: internal),
+// and the range of its slice hashes in the hashes buffer.
+struct HashEntry {
+  const Field* f;
+  int slot;
+  int offset;
+  int size;
+  bool has_col;
+};
 
-void hash (const Field& f, HashType& accum) {
-  const auto& hd = f.get_header();
-  const auto& id = hd.get_identifier();
+void add_entry (const Field& f, const int slot, std::vector<HashEntry>& entries, int& size) {
+  using namespace ShortFieldTagsNames;
+  const auto& id = f.get_header().get_identifier();
   if (id.data_type() != DataType::DoubleType) return;
   const auto& lo = id.get_layout();
-  const auto rank = lo.rank();
-  switch (rank) {
-  case 1: hash(f.get_view<const Real*    >(), lo, accum); break;
-  case 2: hash(f.get_view<const Real**   >(), lo, accum); break;
-  case 3: hash(f.get_view<const Real***  >(), lo, accum); break;
-  case 4: hash(f.get_view<const Real**** >(), lo, accum); break;
-  case 5: hash(f.get_view<const Real*****>(), lo, accum); break;
-  default: break;
-  }  
+  if (lo.rank()<1 or lo.rank()>5) return;
+  entries.push_back({&f, slot, size, lo.dim(0), lo.tag(0)==COL});
+  size += lo.dim(0);
 }
 
-void hash (const std::list<Field>& fs, HashType& accum) {
+void add_entries (const std::list<Field>& fs, const int slot,
+                  std::vector<HashEntry>& entries, int& size) {
   for (const auto& f : fs)
-    hash(f, accum);
+    add_entry(f, slot, entries, size);
 }
 
-void hash (const std::list<FieldGroup>& fgs, HashType& accum) {
+void add_entries (const std::list<FieldGroup>& fgs, const int slot,
+                  std::vector<HashEntry>& entries, int& size) {
   for (const auto& g : fgs)
     for (const auto& e : g.m_fields)
-      hash(*e.second, accum);
+      add_entry(*e.second, slot, entries, size);
+}
+
+// Compute the slice hashes of all entries on device, and copy them to host
+// with a single deep copy.
+HostHashes compute_slice_hashes (const std::vector<HashEntry>& entries, const int size,
+                                 DevHashes& buffer) {
+  if (static_cast<int>(buffer.extent(0))<size) {
+    buffer = DevHashes("state_hash_buffer",size);
+  }
+  for (const auto& e : entries)
+    hash_slices(*e.f, buffer, e.offset);
+  auto hashes = Kokkos::create_mirror_view(buffer);
+  Kokkos::deep_copy(hashes, buffer);
+  return hashes;
+}
+
+HashType combine (const HostHashes& hashes, const HashEntry& e) {
+  HashType accum = 0;
+  for (int i = 0; i < e.size; ++i)
+    bfbhash::hash(hashes(e.offset+i), accum);
+  return accum;
 }
 
 } // namespace anon
@@ -117,26 +131,83 @@ void AtmosphereProcess
 ::print_global_state_hash (const std::string& label, const bool in, const bool out,
                            const bool internal) const {
   static constexpr int nslot = 3;
-  HashType laccum[nslot] = {0};
-  hash(m_fields_in, laccum[0]);
-  hash(m_groups_in, laccum[0]);
-  hash(m_fields_out, laccum[1]);
-  hash(m_groups_out, laccum[1]);
-  hash(m_internal_fields, laccum[2]);
-  HashType gaccum[nslot];
-  bfbhash::all_reduce_HashType(m_comm.mpi_comm(), laccum, gaccum, nslot);
+
+  std::vector<HashEntry> entries;
+  int size = 0;
+  add_entries(m_fields_in, 0, entries, size);
+  add_entries(m_groups_in, 0, entries, size);
+  add_entries(m_fields_out, 1, entries, size);
+  add_entries(m_groups_out, 1, entries, size);
+  add_entries(m_internal_fields, 2, entries, size);
+  const int nentries = entries.size();
+
+  const auto hashes = compute_slice_hashes(entries, size, m_state_hash_buffer);
+
+  // Local per-slot hashes, followed (for level >= 2) by the local per-field
+  // hashes, so that all of them are reduced with a single collective.
+  const bool per_field = m_internal_diagnostics_level >= 2;
+  std::vector<HashType> laccum(nslot + (per_field ? nentries : 0), 0);
+  for (int i = 0; i < nentries; ++i) {
+    const auto h = combine(hashes, entries[i]);
+    bfbhash::hash(h, laccum[entries[i].slot]);
+    if (per_field)
+      laccum[nslot + i] = h;
+  }
+  std::vector<HashType> gaccum(laccum.size());
+  bfbhash::all_reduce_HashType(m_comm.mpi_comm(), laccum.data(), gaccum.data(),
+                               laccum.size());
+
   const bool show[] = {in, out, internal};
-  if (m_comm.am_i_root())
+  const auto& ts = timestamp();
+  if (m_comm.am_i_root()) {
     for (int i = 0; i < nslot; ++i)
       if (show[i])
         fprintf(stderr, "exxhash> %4d-%9.5f %1d %16lld (%s)\n",
-                timestamp().get_year(), timestamp().frac_of_year_in_days(),
+                ts.get_year(), ts.frac_of_year_in_days(),
                 i, (long long int)gaccum[i], label.c_str());
+    if (per_field)
+      for (int i = 0; i < nentries; ++i)
+        if (show[entries[i].slot])
+          fprintf(stderr, "exxhash-fld> %4d-%9.5f %1d %16lld (%s) %s\n",
+                  ts.get_year(), ts.frac_of_year_in_days(),
+                  entries[i].slot, (long long int)gaccum[nslot+i], label.c_str(),
+                  entries[i].f->name().c_str());
+  }
+
+  if (m_internal_diagnostics_level >= 3) {
+    // Per-column hashes, combining all the shown fields that have the COL
+    // dimension, written by each rank to its own file. Columns are identified
+    // by their local index, so runs must use the same decomposition to compare.
+    std::map<std::string,std::vector<HashType>> col_hashes;
+    for (const auto& e : entries) {
+      if (not e.has_col or not show[e.slot]) continue;
+      const auto& grid = e.f->get_header().get_identifier().get_grid_name();
+      auto& ch = col_hashes[grid];
+      ch.resize(std::max<int>(ch.size(), e.size), 0);
+      for (int icol = 0; icol < e.size; ++icol)
+        bfbhash::hash(hashes(e.offset+icol), ch[icol]);
+    }
+    const auto fname = "exxhash_columns.rank" + std::to_string(m_comm.rank()) + ".txt";
+    FILE* fid = fopen(fname.c_str(), "a");
+    EKAT_REQUIRE_MSG (fid!=nullptr,
+        "Error! Could not open file '" + fname + "' for writing column hashes.\n");
+    for (const auto& it : col_hashes)
+      for (size_t icol = 0; icol < it.second.size(); ++icol)
+        fprintf(fid, "exxhash-col> %4d-%9.5f %6zu %16lld (%s) %s\n",
+                ts.get_year(), ts.frac_of_year_in_days(), icol,
+                (long long int)it.second[icol], label.c_str(), it.first.c_str());
+    fclose(fid);
+  }
 }
 
 void AtmosphereProcess::print_fast_global_state_hash (const std::string& label) const {
+  std::vector<HashEntry> entries;
+  int size = 0;
+  add_entries(m_fields_in, 0, entries, size);
+  const auto hashes = compute_slice_hashes(entries, size, m_state_hash_buffer);
   HashType laccum = 0;
-  hash(m_fields_in, laccum);
+  for (const auto& e : entries)
+    bfbhash::hash(combine(hashes, e), laccum);
   HashType gaccum;
   bfbhash::all_reduce_HashType(m_comm.mpi_comm(), &laccum, &gaccum, 1);
   if (m_comm.am_i_root())
@@ -40,6 +40,76 @@ const std::string& FieldGroup::grid_name () const {
   }
 }
 
+void FieldGroup::pack (KT::view_3d<Real>& packed, const BundleLayout layout) const {
+  check_bundle_layout();
+
+  const auto& fl = m_bundle->get_header().get_identifier().get_layout();
+  const int ncols = fl.dim(0);
+  const int nflds = fl.dim(1);
+  const int nlevs = fl.dim(2);
+  const bool lev_fastest = layout==BundleLayout::LevFastest;
+  const int dim1 = lev_fastest ? nflds : nlevs;
+  const int dim2 = lev_fastest ? nlevs : nflds;
+  if (packed.extent_int(0)!=ncols or packed.extent_int(1)!=dim1 or packed.extent_int(2)!=dim2) {
+    packed = KT::view_3d<Real>(m_info->m_group_name + "_packed",ncols,dim1,dim2);
+  }
+
+  // Loop with the fastest index of the packed view innermost
+  auto p = packed;
+  auto b = m_bundle->get_view<const Real***>();
+  Kokkos::parallel_for("FieldGroup::pack",
+                       Kokkos::RangePolicy<KT::ExeSpace>(0,ncols*dim1*dim2),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / (dim1*dim2);
+    const int i1   = (idx / dim2) % dim1;
+    const int i2   = idx % dim2;
+    p(icol,i1,i2) = lev_fastest ? b(icol,i1,i2) : b(icol,i2,i1);
+  });
+}
+
+void FieldGroup::unpack (const KT::view_3d<const Real>& packed, const BundleLayout layout) const {
+  check_bundle_layout();
+
+  const auto& fl = m_bundle->get_header().get_identifier().get_layout();
+  const int ncols = fl.dim(0);
+  const int nflds = fl.dim(1);
+  const int nlevs = fl.dim(2);
+  const bool lev_fastest = layout==BundleLayout::LevFastest;
+  const int dim1 = lev_fastest ? nflds : nlevs;
+  const int dim2 = lev_fastest ? nlevs : nflds;
+  EKAT_REQUIRE_MSG (packed.extent_int(0)==ncols and packed.extent_int(1)==dim1 and
+                    packed.extent_int(2)==dim2,
+      "Error! Packed view extents incompatible with the group bundle.\n"
+      "  - group name   : " + m_info->m_group_name + "\n"
+      "  - bundle layout: " + fl.to_string() + "\n");
+
+  // Loop with the fastest index of the bundle innermost
+  auto b = m_bundle->get_view<Real***>();
+  Kokkos::parallel_for("FieldGroup::unpack",
+                       Kokkos::RangePolicy<KT::ExeSpace>(0,ncols*nflds*nlevs),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / (nflds*nlevs);
+    const int ifld = (idx / nlevs) % nflds;
+    const int ilev = idx % nlevs;
+    b(icol,ifld,ilev) = lev_fastest ? packed(icol,ifld,ilev) : packed(icol,ilev,ifld);
+  });
+}
+
+void FieldGroup::check_bundle_layout () const {
+  using namespace ShortFieldTagsNames;
+
+  EKAT_REQUIRE_MSG (m_info->m_bundled and m_bundle,
+      "Error! Bundled views are only available for bundled groups.\n"
+      "  - group name: " + m_info->m_group_name + "\n");
+
+  const auto& fl = m_bundle->get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (fl.rank()==3 and fl.tag(0)==COL and fl.tag(1)==CMP and
+                    (fl.tag(2)==LEV or fl.tag(2)==ILEV),
+      "Error! Bundled views require a bundle with layout (COL,CMP,LEV).\n"
+      "  - group name   : " + m_info->m_group_name + "\n"
+      "  - bundle layout: " + fl.to_string() + "\n");
+}
+
 void FieldGroup::copy_fields (const FieldGroup& src) {
   m_bundle = src.m_bundle;
   for (auto it : src.m_fields) {
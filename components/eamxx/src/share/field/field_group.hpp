@@ -44,6 +44,13 @@ namespace scream {
 
 struct FieldGroup {
   using ci_string = FieldGroupInfo::ci_string;
+  using KT = KokkosTypes<DefaultDevice>;
+
+  // Layout of a packed copy of a bundled group with layout (COL,CMP,LEV)
+  enum class BundleLayout {
+    LevFastest,   // (ncol,nfields,nlev), same as the bundle itself
+    FieldFastest  // (ncol,nlev,nfields)
+  };
 
   FieldGroup (const std::string& name);
   FieldGroup (const FieldGroupInfo& info);
@@ -56,6 +63,18 @@ struct FieldGroup {
 
   const std::string& grid_name () const;
 
+  // The bundle of a group with layout (COL,CMP,LEV) as a single (ncol,nfields,nlev)
+  // view. This aliases the bundle data (no copy), so all fields in the group can
+  // be updated with one kernel. Field i is at m_info->m_subview_idx along dim 1.
+  // Note: the last extent is the allocated one, which may include padding.
+  template<typename DT, HostOrDevice HD = Device>
+  Field::get_view_type<DT,HD> get_bundled_view () const;
+
+  // Copy the bundle into/from a packed (ncol,nfields,nlev) or (ncol,nlev,nfields)
+  // view, without padding. pack reallocates the view if its extents do not match.
+  void pack (KT::view_3d<Real>& packed, const BundleLayout layout) const;
+  void unpack (const KT::view_3d<const Real>& packed, const BundleLayout layout) const;
+
   // The fields in this group
   std::map<ci_string,std::shared_ptr<Field>> m_fields;
 
@@ -72,8 +91,19 @@ private:
   FieldGroup () = default;
 
   void copy_fields (const FieldGroup& src);
+
+  // Checks that the group is bundled, with bundle layout (COL,CMP,LEV)
+  void check_bundle_layout () const;
 };
 
+template<typename DT, HostOrDevice HD>
+Field::get_view_type<DT,HD> FieldGroup::get_bundled_view () const {
+  static_assert (Field::get_view_type<DT,HD>::rank==3,
+      "Error! Bundled group views must have rank 3.\n");
+  check_bundle_layout();
+  return m_bundle->get_view<DT,HD>();
+}
+
 // We use this to find a FieldGroup in a std container.
 // We do NOT allow two entries with same group name and grid name in such containers.
 inline bool operator== (const FieldGroup& lhs, const FieldGroup& rhs) {
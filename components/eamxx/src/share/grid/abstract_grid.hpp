@@ -171,7 +171,10 @@ public:
   // view returned by this method.
   std::vector<gid_type> get_unique_gids () const;
 
-  // For each entry in the input list of GIDs, retrieve the process id that owns it
+  // For each entry in the input list of GIDs, retrieve the process id that owns it.
+  // Each input GID must be owned by exactly one rank.
+  // NOTE: this method, as well as get_unique_gids, is_unique, and get_remote_pids_and_lids,
+  //       resolves gids via a distributed directory (see gid_directory.hpp).
   std::vector<int> get_owners (const gid_view_h& gids) const;
   std::vector<int> get_owners (const std::vector<gid_type>& gids) const {
     gid_view_h gids_v(gids.data(),gids.size());
@@ -0,0 +1,155 @@
+#include "share/grid/gid_directory.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace scream
+{
+
+GidDirectory::
+GidDirectory (const ekat::Comm& comm, const gid_view_h& gids)
+ : m_comm (comm)
+{
+  const int ngids = gids.size();
+  const int nranks = m_comm.size();
+
+  // Compute the global range of gids, which determines the directory rank of each gid
+  gid_type local_min =  std::numeric_limits<gid_type>::max();
+  gid_type local_max = -std::numeric_limits<gid_type>::max();
+  for (int i=0; i<ngids; ++i) {
+    local_min = std::min(local_min,gids[i]);
+    local_max = std::max(local_max,gids[i]);
+  }
+  m_comm.all_reduce(&local_min,&m_min_gid,1,MPI_MIN);
+  m_comm.all_reduce(&local_max,&m_max_gid,1,MPI_MAX);
+
+  // Send (gid,lid) pairs to the directory ranks. Note: lids fit in gid_type.
+  std::vector<int> send_offsets(nranks+1,0);
+  for (int i=0; i<ngids; ++i) {
+    send_offsets[directory_pid(gids[i])+1] += 2;
+  }
+  for (int pid=0; pid<nranks; ++pid) {
+    send_offsets[pid+1] += send_offsets[pid];
+  }
+  std::vector<gid_type> send_buf(send_offsets[nranks]);
+  std::vector<int> pos (send_offsets.begin(),send_offsets.end()-1);
+  for (int i=0; i<ngids; ++i) {
+    auto& p = pos[directory_pid(gids[i])];
+    send_buf[p++] = gids[i];
+    send_buf[p++] = i;
+  }
+
+  std::vector<gid_type> recv_buf;
+  std::vector<int> recv_offsets;
+  all_to_all_v(m_comm,send_buf,send_offsets,recv_buf,recv_offsets);
+
+  // Data is received in pid order, so the holders of each gid are sorted by pid
+  for (int pid=0; pid<nranks; ++pid) {
+    for (int i=recv_offsets[pid]; i<recv_offsets[pid+1]; i+=2) {
+      m_holders[recv_buf[i]].emplace_back(pid,recv_buf[i+1]);
+    }
+  }
+}
+
+void GidDirectory::
+lookup (const gid_view_h& gids,
+        std::vector<int>& num_holders,
+        std::vector<int>& pids,
+        std::vector<int>& lids) const
+{
+  const int ngids = gids.size();
+  const int nranks = m_comm.size();
+
+  num_holders.assign(ngids,0);
+  pids.assign(ngids,-1);
+  lids.assign(ngids,-1);
+
+  // 1. Send the queried gids to their directory ranks. Gids outside the
+  //    registered range are not held by anyone, so we don't send them.
+  auto in_range = [&](const gid_type gid) {
+    return gid>=m_min_gid && gid<=m_max_gid;
+  };
+  std::vector<int> send_offsets(nranks+1,0);
+  for (int i=0; i<ngids; ++i) {
+    if (in_range(gids[i])) {
+      ++send_offsets[directory_pid(gids[i])+1];
+    }
+  }
+  for (int pid=0; pid<nranks; ++pid) {
+    send_offsets[pid+1] += send_offsets[pid];
+  }
+  std::vector<gid_type> send_buf(send_offsets[nranks]);
+  std::vector<int> send_idx(send_offsets[nranks]);
+  std::vector<int> pos (send_offsets.begin(),send_offsets.end()-1);
+  for (int i=0; i<ngids; ++i) {
+    if (in_range(gids[i])) {
+      auto& p = pos[directory_pid(gids[i])];
+      send_buf[p] = gids[i];
+      send_idx[p] = i;
+      ++p;
+    }
+  }
+
+  std::vector<gid_type> queries;
+  std::vector<int> query_offsets;
+  all_to_all_v(m_comm,send_buf,send_offsets,queries,query_offsets);
+
+  // 2. Answer the queries with the triplet (num_holders,pid,lid) of each gid
+  std::vector<int> reply_offsets(nranks+1);
+  for (int pid=0; pid<=nranks; ++pid) {
+    reply_offsets[pid] = 3*query_offsets[pid];
+  }
+  std::vector<int> replies(reply_offsets[nranks]);
+  for (size_t i=0; i<queries.size(); ++i) {
+    auto it = m_holders.find(queries[i]);
+    if (it==m_holders.end()) {
+      replies[3*i]   = 0;
+      replies[3*i+1] = -1;
+      replies[3*i+2] = -1;
+    } else {
+      const auto& holders = it->second;
+      replies[3*i]   = holders.size();
+      replies[3*i+1] = holders.front().first;
+      replies[3*i+2] = holders.front().second;
+    }
+  }
+
+  std::vector<int> answers;
+  std::vector<int> answer_offsets;
+  all_to_all_v(m_comm,replies,reply_offsets,answers,answer_offsets);
+
+  // 3. Answers come back in the same order we sent the queries
+  for (size_t i=0; i<send_idx.size(); ++i) {
+    const int idx = send_idx[i];
+    num_holders[idx] = answers[3*i];
+    pids[idx]        = answers[3*i+1];
+    lids[idx]        = answers[3*i+2];
+  }
+}
+
+bool GidDirectory::all_unique () const
+{
+  int locally_unique = 1;
+  for (const auto& it : m_holders) {
+    if (it.second.size()>1) {
+      locally_unique = 0;
+      break;
+    }
+  }
+  int unique;
+  m_comm.all_reduce(&locally_unique,&unique,1,MPI_MIN);
+  return unique==1;
+}
+
+int GidDirectory::directory_pid (const gid_type gid) const
+{
+  // Contiguous blocks of (almost) equal size of the range [m_min_gid,m_max_gid].
+  // Use 64 bits ints, to avoid overflow in the product.
+  const std::int64_t nranks = m_comm.size();
+  const std::int64_t range = static_cast<std::int64_t>(m_max_gid) - m_min_gid + 1;
+  const std::int64_t offset = static_cast<std::int64_t>(gid) - m_min_gid;
+  return static_cast<int>((offset*nranks) / range);
+}
+
+} // namespace scream
@@ -0,0 +1,110 @@
+#ifndef EAMXX_GID_DIRECTORY_HPP
+#define EAMXX_GID_DIRECTORY_HPP
+
+#include "share/grid/abstract_grid.hpp"
+#include "share/util/scream_utils.hpp"  // For check_mpi_call
+
+#include <ekat/mpi/ekat_comm.hpp>
+#include <ekat/ekat_assert.hpp>
+
+#include <mpi.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A distributed directory of global ids (gids).
+ *
+ * Each rank registers the list of gids it holds. The gid with local id (lid)
+ * i is the i-th entry of the input list. Each gid is assigned a "directory rank",
+ * via a block partition of the global range [min_gid,max_gid]. The directory
+ * rank stores all the (pid,lid) pairs holding that gid.
+ *
+ * Queries resolve gids in the same way: each rank sends the gids it is
+ * interested in to their directory ranks, which reply with the holders.
+ * Building the directory, as well as each lookup, only requires all-to-all
+ * exchanges, whose volume is proportional to the number of local gids. This
+ * avoids algorithms where every rank broadcasts its gids to all other ranks,
+ * whose cost grows like the number of ranks times the global number of gids.
+ *
+ * All methods are collective over the input comm.
+ */
+
+class GidDirectory {
+public:
+  using gid_type   = AbstractGrid::gid_type;
+  using gid_view_h = AbstractGrid::gid_view_h;
+
+  GidDirectory (const ekat::Comm& comm, const gid_view_h& gids);
+  ~GidDirectory () = default;
+
+  // For each of the input gids, retrieve how many (pid,lid) pairs hold it, as well
+  // as the pid/lid of the holder with the lowest pid. If a gid is not held by
+  // any rank, num_holders=0, and pid=lid=-1.
+  void lookup (const gid_view_h& gids,
+               std::vector<int>& num_holders,
+               std::vector<int>& pids,
+               std::vector<int>& lids) const;
+
+  // Whether each registered gid is held by exactly one (pid,lid) pair
+  bool all_unique () const;
+
+protected:
+
+  int directory_pid (const gid_type gid) const;
+
+  ekat::Comm  m_comm;
+
+  // The global range of registered gids
+  gid_type    m_min_gid;
+  gid_type    m_max_gid;
+
+  // The (pid,lid) holders of each gid assigned to this rank, sorted by pid
+  std::unordered_map<gid_type,std::vector<std::pair<int,int>>>  m_holders;
+};
+
+// Personalized all-to-all exchange. The data to send to rank p is stored in
+// send_buf, in the range [send_offsets[p],send_offsets[p+1]). On output, the data
+// received from rank p is in recv_buf in the range [recv_offsets[p],recv_offsets[p+1]).
+// Offsets arrays have size comm.size()+1.
+template<typename T>
+void all_to_all_v (const ekat::Comm& comm,
+                   const std::vector<T>& send_buf,
+                   const std::vector<int>& send_offsets,
+                         std::vector<T>& recv_buf,
+                         std::vector<int>& recv_offsets)
+{
+  const int nranks = comm.size();
+  EKAT_REQUIRE_MSG (static_cast<int>(send_offsets.size())==nranks+1,
+      "Error! Invalid send offsets size in all_to_all_v.\n"
+      "  - expected size: " + std::to_string(nranks+1) + "\n"
+      "  - actual size  : " + std::to_string(send_offsets.size()) + "\n");
+
+  std::vector<int> send_counts(nranks), recv_counts(nranks);
+  for (int pid=0; pid<nranks; ++pid) {
+    send_counts[pid] = send_offsets[pid+1] - send_offsets[pid];
+  }
+  check_mpi_call(MPI_Alltoall(send_counts.data(),1,MPI_INT,
+                              recv_counts.data(),1,MPI_INT,comm.mpi_comm()),
+                 "all_to_all_v, exchanging counts");
+
+  recv_offsets.resize(nranks+1);
+  recv_offsets[0] = 0;
+  for (int pid=0; pid<nranks; ++pid) {
+    recv_offsets[pid+1] = recv_offsets[pid] + recv_counts[pid];
+  }
+  recv_buf.resize(recv_offsets[nranks]);
+
+  const auto mpi_t = ekat::get_mpi_type<T>();
+  check_mpi_call(MPI_Alltoallv(send_buf.data(),send_counts.data(),send_offsets.data(),mpi_t,
+                               recv_buf.data(),recv_counts.data(),recv_offsets.data(),mpi_t,
+                               comm.mpi_comm()),
+                 "all_to_all_v, exchanging data");
+}
+
+} // namespace scream
+
+#endif // EAMXX_GID_DIRECTORY_HPP
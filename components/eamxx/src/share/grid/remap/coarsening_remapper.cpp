@@ -2,6 +2,7 @@
 
 #include "share/grid/point_grid.hpp"
 #include "share/grid/grid_import_export.hpp"
+#include "share/grid/gid_directory.hpp"
 #include "share/io/scorpio_input.hpp"
 
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
@@ -145,6 +146,13 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
   HorizInterpRemapperBase::do_bind_field(ifield,src,tgt);
 }
 
+bool CoarseningRemapper::
+can_fuse_mat_vec (const int ifield) const
+{
+  return m_field_idx_to_mask_idx.at(ifield)<0 and
+         HorizInterpRemapperBase::can_fuse_mat_vec(ifield);
+}
+
 void CoarseningRemapper::do_remap_fwd ()
 {
   // Fire the recv requests right away, so that if some other ranks
@@ -164,9 +172,16 @@ void CoarseningRemapper::do_remap_fwd ()
     return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
   };
 
-  // Loop over each field
+  // First, perform the local mat-vec for all the fields that can be batched
+  // in a single kernel (i.e., all non-masked contiguous fields)
+  fused_local_mat_vec ();
+
+  // Loop over the remaining fields
   for (int i=0; i<m_num_fields; ++i) {
-    // First, perform the local mat-vec. Recall that in these y=Ax products,
+    if (m_fused[i]) {
+      continue;
+    }
+    // Perform the local mat-vec. Recall that in these y=Ax products,
     // x is the src field, and y is the overlapped tgt field.
     const auto& f_src = m_src_fields[i];
     const auto& f_ov  = m_ov_fields[i];
@@ -818,95 +833,36 @@ void CoarseningRemapper::recv_and_unpack ()
   }
 }
 
-std::vector<int>
-CoarseningRemapper::get_pids_for_recv (const std::vector<int>& send_to_pids) const
-{
-  // Figure out how many sends each PID is doing
-  std::vector<int> num_sends(m_comm.size(),0);
-  num_sends[m_comm.rank()] = send_to_pids.size();
-  m_comm.all_gather(num_sends.data(),1);
-
-  // Offsets for send_pids coming from each pid
-  // NOTE: the extra entry at the end if for ease of use later
-  std::vector<int> sends_offsets (m_comm.size()+1,0);
-  for (int pid=1; pid<=m_comm.size(); ++pid) {
-    sends_offsets[pid] = sends_offsets[pid-1] + num_sends[pid-1];
-  }
-
-  // Gather all the pids that each rank is sending data to
-  auto nglobal_sends = std::accumulate(num_sends.begin(),num_sends.end(),0);
-  std::vector<int> global_send_pids(nglobal_sends,-1);
-  MPI_Allgatherv (send_to_pids.data(),send_to_pids.size(),MPI_INT,
-                  global_send_pids.data(),num_sends.data(),sends_offsets.data(),
-                  MPI_INT, m_comm.mpi_comm());
-
-  // Loop over all the ranks, and all the pids they send to, and look for my pid
-  std::vector<int> recv_from_pids;
-  for (int pid=0; pid<m_comm.size(); ++pid) {
-    const int beg = sends_offsets[pid];
-    const int end = sends_offsets[pid+1];
-
-    for (int i=beg; i<end; ++i) {
-      if (global_send_pids[i]==m_comm.rank()) {
-        recv_from_pids.push_back(pid);
-        break;
-      }
-    }
-  }
-
-  return recv_from_pids;
-}
-
 std::map<int,std::vector<int>>
 CoarseningRemapper::
 recv_gids_from_pids (const std::map<int,std::vector<int>>& pid2gids_send) const
 {
-  const auto comm = m_comm.mpi_comm();
+  const int nranks = m_comm.size();
 
-  // First, figure out which PIDs I need to recv from
-  std::vector<int> send_to;
+  // Splice the gids to send to each pid in a single buffer
+  std::vector<int> send_offsets(nranks+1,0);
   for (const auto& it : pid2gids_send) {
-    send_to.push_back(it.first);
+    send_offsets[it.first+1] = it.second.size();
   }
-  auto recv_from = get_pids_for_recv (send_to);
-
-  // Send num of lids send to each send_pid, and recv num of lids
-  // recv from each recv_pid
-  std::map<int,int> nsends, nrecvs;
-  std::vector<MPI_Request> send_req, recv_req;
-  for (const auto& it : pid2gids_send) {
-    const int pid = it.first;
-    nsends[pid] = it.second.size();
-    send_req.emplace_back();
-    MPI_Isend (&nsends[pid],1,MPI_INT,pid,0,comm,&send_req.back());
+  for (int pid=0; pid<nranks; ++pid) {
+    send_offsets[pid+1] += send_offsets[pid];
   }
-  for (auto pid : recv_from) {
-    recv_req.emplace_back();
-    MPI_Irecv(&nrecvs[pid],1,MPI_INT,pid,0,comm,&recv_req.back());
+  std::vector<int> send_gids(send_offsets[nranks]);
+  for (const auto& it : pid2gids_send) {
+    std::copy(it.second.begin(),it.second.end(),send_gids.begin()+send_offsets[it.first]);
   }
-  MPI_Waitall(send_req.size(),send_req.data(),MPI_STATUSES_IGNORE);
-  MPI_Waitall(recv_req.size(),recv_req.data(),MPI_STATUSES_IGNORE);
 
-  send_req.resize(0);
-  recv_req.resize(0);
+  // A single all-to-all exchange tells each rank who sends data to it, and which gids
+  std::vector<int> recv_gids, recv_offsets;
+  all_to_all_v(m_comm,send_gids,send_offsets,recv_gids,recv_offsets);
 
-  // Now that we know how many gids we will get from each pid, we can send/recv them
-  for (const auto& it : pid2gids_send) {
-    send_req.emplace_back();
-    MPI_Isend(it.second.data(),it.second.size(),MPI_INT,
-              it.first,0,comm,&send_req.back());
-  }
   std::map<int,std::vector<int>> pid2gids_recv;
-  for (const auto& it : nrecvs) {
-    const int pid = it.first;
-    const int n   = it.second;
-    pid2gids_recv[pid].resize(n);
-    recv_req.emplace_back();
-    MPI_Irecv(pid2gids_recv[pid].data(),n,MPI_INT,
-              pid,0,comm,&recv_req.back());
+  for (int pid=0; pid<nranks; ++pid) {
+    if (recv_offsets[pid+1]>recv_offsets[pid]) {
+      pid2gids_recv[pid].assign(recv_gids.begin()+recv_offsets[pid],
+                                recv_gids.begin()+recv_offsets[pid+1]);
+    }
   }
-  MPI_Waitall(send_req.size(),send_req.data(),MPI_STATUSES_IGNORE);
-  MPI_Waitall(recv_req.size(),recv_req.data(),MPI_STATUSES_IGNORE);
 
   return pid2gids_recv;
 }
@@ -1036,16 +992,25 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   auto recv_lids_beg_h  = Kokkos::create_mirror_view(m_recv_lids_beg);
   auto recv_lids_end_h  = Kokkos::create_mirror_view(m_recv_lids_end);
 
+  // Note: use a gid->pos map for each pid, to avoid a linear search for each gid
+  std::map<int,std::map<gid_type,int>> pid2gidpos_recv;
+  for (const auto& it : pid2gids_recv) {
+    auto& gid2pos = pid2gidpos_recv[it.first];
+    for (size_t k=0; k<it.second.size(); ++k) {
+      gid2pos[it.second[k]] = k;
+    }
+  }
   auto tgt_dofs_h = m_tgt_grid->get_dofs_gids().get_view<const gid_type*,Host>();
   for (int i=0,pos=0; i<num_tgt_dofs; ++i) {
     recv_lids_beg_h(i) = pos;
     const int gid = tgt_dofs_h[i];
     for (auto pid : lid2pids_recv[i]) {
-      auto it = std::find(pid2gids_recv.at(pid).begin(),pid2gids_recv.at(pid).end(),gid);
-      EKAT_REQUIRE_MSG (it!=pid2gids_recv.at(pid).end(),
+      const auto& gid2pos = pid2gidpos_recv.at(pid);
+      auto it = gid2pos.find(gid);
+      EKAT_REQUIRE_MSG (it!=gid2pos.end(),
           "Error! Something went wrong in CoarseningRemapper::setup_mpi_structures.\n");
       recv_lids_pidpos_h(pos,0) = pid;
-      recv_lids_pidpos_h(pos++,1) = std::distance(pid2gids_recv.at(pid).begin(),it);
+      recv_lids_pidpos_h(pos++,1) = it->second;
     }
     recv_lids_end_h(i) = pos;
   }
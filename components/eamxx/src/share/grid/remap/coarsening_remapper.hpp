@@ -62,7 +62,8 @@ protected:
 
   void setup_mpi_data_structures () override;
 
-  std::vector<int> get_pids_for_recv (const std::vector<int>& send_to_pids) const;
+  // Masked fields need their own mat-vec kernel
+  bool can_fuse_mat_vec (const int ifield) const override;
 
   std::map<int,std::vector<int>>
   recv_gids_from_pids (const std::map<int,std::vector<int>>& pid2gids_send) const;
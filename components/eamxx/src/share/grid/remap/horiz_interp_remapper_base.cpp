@@ -11,6 +11,29 @@
 namespace scream
 {
 
+namespace {
+
+// View a whole COL-first field as a 2d (ncols,row_len) array of packs
+template<typename PackT>
+Unmanaged<KokkosTypes<DefaultDevice>::view_2d<PackT>>
+as_2d_view (const Field& f, const int row_len)
+{
+  using view_t = Unmanaged<KokkosTypes<DefaultDevice>::view_2d<PackT>>;
+
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  switch (fl.rank()) {
+    case 1: return view_t(f.get_view<PackT*>().data(),fl.dim(0),row_len);
+    case 2: return view_t(f.get_view<PackT**>().data(),fl.dim(0),row_len);
+    case 3: return view_t(f.get_view<PackT***>().data(),fl.dim(0),row_len);
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported field rank in the fused mat-vec.\n"
+                      " - field name: " + f.name() + "\n"
+                      " - field rank: " + std::to_string(fl.rank()) + "\n");
+  }
+}
+
+} // anonymous namespace
+
 HorizInterpRemapperBase::
 HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
                          const std::string& map_file,
@@ -41,6 +64,7 @@ HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
   m_row_offsets = data.row_offsets;
   m_col_lids = data.col_lids;
   m_weights = data.weights;
+  m_nnz_per_row = data.nnz_per_row;
 
   // The grids really only matter for the horiz part. We may have 2+ remappers with
   // fine grids that only differ in terms of number of levs. Such remappers cannot
@@ -174,6 +198,7 @@ void HorizInterpRemapperBase::do_registration_ends ()
 {
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
     create_ov_fields ();
+    setup_fused_mat_vec ();
     setup_mpi_data_structures ();
   }
 }
@@ -209,6 +234,7 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
   if (this->m_state==RepoState::Closed &&
       (this->m_num_bound_fields+1)==this->m_num_registered_fields) {
     create_ov_fields ();
+    setup_fused_mat_vec ();
     setup_mpi_data_structures ();
   }
 }
@@ -357,6 +383,141 @@ local_mat_vec (const Field& x, const Field& y) const
   }
 }
 
+bool HorizInterpRemapperBase::
+can_fuse_mat_vec (const int ifield) const
+{
+  using namespace ShortFieldTagsNames;
+
+  for (const auto f : {&m_src_fields[ifield], &m_ov_fields[ifield], &m_tgt_fields[ifield]}) {
+    // Only whole fields with COL as first dim can be seen as a contiguous (ncols,row_len) array
+    const auto& fl = f->get_header().get_identifier().get_layout();
+    if (fl.rank()==0 or fl.rank()>3 or fl.tag(0)!=COL or
+        f->get_header().get_alloc_properties().is_subfield()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void HorizInterpRemapperBase::setup_fused_mat_vec ()
+{
+  // The number of scalars stored for each column, including padding
+  auto get_row_len = [](const Field& f) {
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    if (fl.rank()==1) {
+      return 1;
+    }
+    int len = f.get_header().get_alloc_properties().get_last_extent();
+    for (int i=1; i<fl.rank()-1; ++i) {
+      len *= fl.dim(i);
+    }
+    return len;
+  };
+  auto can_pack_field = [](const Field& f) {
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    const auto& ap = f.get_header().get_alloc_properties();
+    return fl.rank()>1 and (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
+  };
+
+  const bool refine = m_type==InterpType::Refine;
+  std::vector<FusedField<SCREAM_PACK_SIZE>> packed;
+  std::vector<FusedField<1>> scalar;
+  m_fused.assign(m_num_fields,false);
+  m_fused_max_row_len_packed = m_fused_max_row_len_scalar = 0;
+  for (int i=0; i<m_num_fields; ++i) {
+    if (not can_fuse_mat_vec(i)) {
+      continue;
+    }
+
+    // Recall that in these y=Ax products, x is the overlapped src field (refine)
+    // or the src field (coarsen), and y is the tgt field (refine) or the overlapped
+    // tgt field (coarsen).
+    const auto& x = refine ? m_ov_fields[i] : m_src_fields[i];
+    const auto& y = refine ? m_tgt_fields[i] : m_ov_fields[i];
+    const int row_len = get_row_len(x);
+    if (get_row_len(y)!=row_len) {
+      // Different padding in x and y. Let local_mat_vec handle this
+      continue;
+    }
+
+    m_fused[i] = true;
+    if (can_pack_field(x) and can_pack_field(y)) {
+      using pack_t = FusedField<SCREAM_PACK_SIZE>::pack_t;
+      const int len = row_len / SCREAM_PACK_SIZE;
+      m_fused_max_row_len_packed = std::max(m_fused_max_row_len_packed,len);
+      packed.push_back({as_2d_view<const pack_t>(x,len),as_2d_view<pack_t>(y,len)});
+    } else {
+      using pack_t = FusedField<1>::pack_t;
+      m_fused_max_row_len_scalar = std::max(m_fused_max_row_len_scalar,row_len);
+      scalar.push_back({as_2d_view<const pack_t>(x,row_len),as_2d_view<pack_t>(y,row_len)});
+    }
+  }
+
+  auto to_device = [](const auto& v) {
+    using ff_t = typename std::decay<decltype(v)>::type::value_type;
+    view_1d<ff_t> d("",v.size());
+    auto h = Kokkos::create_mirror_view(d);
+    std::copy(v.begin(),v.end(),h.data());
+    Kokkos::deep_copy(d,h);
+    return d;
+  };
+  m_fused_fields_packed = to_device(packed);
+  m_fused_fields_scalar = to_device(scalar);
+}
+
+void HorizInterpRemapperBase::fused_local_mat_vec () const
+{
+  if (m_fused_fields_packed.size()>0) {
+    fused_local_mat_vec<SCREAM_PACK_SIZE>(m_fused_fields_packed,m_fused_max_row_len_packed);
+  }
+  if (m_fused_fields_scalar.size()>0) {
+    fused_local_mat_vec<1>(m_fused_fields_scalar,m_fused_max_row_len_scalar);
+  }
+}
+
+template<int PackSize>
+void HorizInterpRemapperBase::
+fused_local_mat_vec (const view_1d<FusedField<PackSize>>& fields, const int max_row_len) const
+{
+  using MemberType  = typename KT::MemberType;
+  using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const auto row_grid = m_type==InterpType::Refine ? m_fine_grid : m_ov_coarse_grid;
+  const int  nrows    = row_grid->get_num_local_dofs();
+  const int  nfields  = fields.size();
+  const int  nnz      = m_nnz_per_row;
+
+  auto row_offsets = m_row_offsets;
+  auto col_lids    = m_col_lids;
+  auto weights     = m_weights;
+
+  // One team per (field,row) pair, with threads/vector lanes spanning the column data.
+  // As in local_mat_vec, we handle the 1st contribution to each row separately,
+  // and accumulate in a local variable, so that y is only written once.
+  auto policy = ESU::get_default_team_policy(nrows*nfields,max_row_len);
+  Kokkos::parallel_for(policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int ifield = team.league_rank() / nrows;
+    const int row    = team.league_rank() % nrows;
+
+    const auto& x = fields(ifield).x;
+    const auto& y = fields(ifield).y;
+    const int len = x.extent(1);
+
+    // If the matrix is in ELL format, we don't need to load the row offsets
+    const int beg = nnz>0 ? row*nnz   : row_offsets(row);
+    const int end = nnz>0 ? beg + nnz : row_offsets(row+1);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,len),
+                         [&](const int k){
+      auto acc = weights(beg)*x(col_lids(beg),k);
+      for (int icol=beg+1; icol<end; ++icol) {
+        acc += weights(icol)*x(col_lids(icol),k);
+      }
+      y(row,k) = acc;
+    });
+  });
+}
+
 void HorizInterpRemapperBase::clean_up ()
 {
   // Clear all fields
@@ -364,6 +525,11 @@ void HorizInterpRemapperBase::clean_up ()
   m_tgt_fields.clear();
   m_ov_fields.clear();
 
+  // Clear fused mat-vec data
+  m_fused.clear();
+  m_fused_fields_packed = view_1d<FusedField<SCREAM_PACK_SIZE>>();
+  m_fused_fields_scalar = view_1d<FusedField<1>>();
+
   // Reset the state of the base class
   m_state = RepoState::Clean;
   m_num_fields = 0;
@@ -4,6 +4,8 @@
 #include "share/grid/remap/abstract_remapper.hpp"
 #include "share/grid/remap/horiz_interp_remapper_data.hpp"
 
+#include <ekat/ekat_pack.hpp>
+
 namespace scream
 {
 
@@ -69,11 +71,20 @@ protected:
 
   template<typename T>
   using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using uview_2d = Unmanaged<typename KT::template view_2d<T>>;
 
   void create_ov_fields ();
 
   void clean_up ();
 
+  // Whether the i-th field can be handled by fused_local_mat_vec. Derived classes
+  // can override this, to exclude fields that need special treatment (e.g., masking)
+  virtual bool can_fuse_mat_vec (const int ifield) const;
+
+  // Gather the fields that can be handled by a single fused mat-vec kernel
+  void setup_fused_mat_vec ();
+
   // Derived classes will do different things, depending on m_type and the
   // MPI strategy they use (P2P or RMA)
   virtual void setup_mpi_data_structures () = 0;
@@ -84,6 +95,24 @@ public:
   template<int N>
   void local_mat_vec (const Field& f_src, const Field& f_tgt) const;
 
+  // For the fused mat-vec, each field is seen as a 2d (ncols,row_len) array,
+  // where row_len is the (padded) number of packs per column. The views are
+  // unmanaged, since the memory is owned by the fields stored in this class.
+  template<int N>
+  struct FusedField {
+    using pack_t = ekat::Pack<Real,N>;
+
+    uview_2d<const pack_t> x;
+    uview_2d<pack_t>       y;
+  };
+
+  // Perform the mat-vec for all the fields that were selected in setup_fused_mat_vec,
+  // using one kernel launch for the fields that can use packs, and one for the others
+  void fused_local_mat_vec () const;
+
+  template<int N>
+  void fused_local_mat_vec (const view_1d<FusedField<N>>& fields, const int max_row_len) const;
+
   // The fine and coarse grids. Depending on m_type, they could be
   // respectively m_src_grid and m_tgt_grid or viceversa
   // Note: coarse grid is non-const, so that we can add geo data later.
@@ -107,6 +136,17 @@ public:
   view_1d<int>    m_col_lids;
   view_1d<Real>   m_weights;
 
+  // If all local rows have the same number of nonzeros (ELL format), this is that number.
+  // Otherwise, it is -1.
+  int             m_nnz_per_row;
+
+  // ----- Fused mat-vec data ---- //
+  std::vector<bool>                     m_fused;  // Whether field i is handled by the fused mat-vec
+  view_1d<FusedField<SCREAM_PACK_SIZE>> m_fused_fields_packed;
+  view_1d<FusedField<1>>                m_fused_fields_scalar;
+  int                                   m_fused_max_row_len_packed = 0;
+  int                                   m_fused_max_row_len_scalar = 0;
+
   // Keep track of this, since we need to tell the remap data repo
   // we are releasing the data for our map file.
   std::string     m_map_file;
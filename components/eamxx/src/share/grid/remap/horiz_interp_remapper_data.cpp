@@ -4,6 +4,7 @@
 #include "share/grid/grid_import_export.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 
+#include <algorithm>
 #include <numeric>
 
 namespace scream {
@@ -253,6 +254,17 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
       "  - row_offsets(end): " + std::to_string(row_offsets_h(num_rows)) + "\n");
 
   Kokkos::deep_copy(row_offsets,row_offsets_h);
+
+  // Analyze the sparsity pattern: if all rows have the same number of nonzeros
+  // (e.g., GLL->PG2 or regular coarsening maps), the matrix is effectively in
+  // ELL format, and kernels can compute row offsets on the fly.
+  nnz_per_row = -1;
+  if (num_rows>0) {
+    const auto minmax = std::minmax_element(row_counts.begin(),row_counts.end());
+    if (*minmax.first==*minmax.second and *minmax.first>0) {
+      nnz_per_row = *minmax.first;
+    }
+  }
 }
 
 } // namespace scream
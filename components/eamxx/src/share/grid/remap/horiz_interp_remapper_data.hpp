@@ -38,6 +38,10 @@ struct HorizRemapperData {
   view_1d<int>    col_lids;
   view_1d<Real>   weights;
 
+  // If all (local) rows have the same number of nonzeros, this is that number.
+  // Otherwise, it is -1.
+  int nnz_per_row = -1;
+
   int num_customers = 0;
 private:
   using gid_type = AbstractGrid::gid_type;
@@ -47,9 +47,15 @@ void RefiningRemapperP2P::do_remap_fwd ()
     return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
   };
 
-  // Loop over each field, perform mat-vec
+  // Perform mat-vec for all fields that can be batched in a single kernel
+  fused_local_mat_vec ();
+
+  // Loop over the remaining fields, perform mat-vec
   constexpr auto COL = ShortFieldTagsNames::COL;
   for (int i=0; i<m_num_fields; ++i) {
+    if (m_fused[i]) {
+      continue;
+    }
     auto& f_tgt = m_tgt_fields[i];
 
     // Allow to register fields that do not have the COL tag
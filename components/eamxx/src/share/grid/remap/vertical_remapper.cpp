@@ -8,8 +8,6 @@
 
 #include "ekat/util/ekat_units.hpp"
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
-#include <ekat/ekat_pack_utils.hpp>
-#include <ekat/ekat_pack_kokkos.hpp>
 
 #include <numeric>
 
@@ -212,7 +210,6 @@ void VerticalRemapper::
 do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
 {
   using namespace ShortFieldTagsNames;
-  using PackT = ekat::Pack<Real,SCREAM_PACK_SIZE>;
 
   m_src_fields[ifield] = src;
   m_tgt_fields[ifield] = tgt;
@@ -222,13 +219,10 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
 
   auto& f_tgt = m_tgt_fields[ifield]; // Nonconst, since we need to set extra data in the header
   if (src_layout.has_tag(LEV) or src_layout.has_tag(ILEV)) {
-    // Determine if this field can be handled with packs, and whether it's at midpoints
+    // Determine whether this field is at midpoints
     // Add mask tracking to the target field. The mask tracks location of tgt pressure levs that are outside the
     // bounds of the src pressure field, and hence cannot be recovered by interpolation
-    auto& ft = m_field2type[src.name()];
-    ft.midpoints = src.get_header().get_identifier().get_layout().has_tag(LEV);
-    ft.packed    = src.get_header().get_alloc_properties().is_compatible<PackT>() and
-                   tgt.get_header().get_alloc_properties().is_compatible<PackT>();
+    m_field2midpoints[src.name()] = src_layout.has_tag(LEV);
 
     // NOTE: for now we assume that masking is determined only by the COL,LEV location in space
     //       and that fields with multiple components will have the same masking for each component
@@ -238,28 +232,20 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
     // I this mask has already been created, retrieve it, otherwise create it
     const auto mask_name = m_tgt_grid->name() + "_" + ekat::join(src_layout.names(),"_") + "_mask";
     Field tgt_mask;
-    if (m_field2type.count(mask_name)==0) {
+    if (m_field2midpoints.count(mask_name)==0) {
       auto nondim = ekat::units::Units::nondimensional();
-      // Create this src/tgt mask fields, and assign them to these src/tgt fields extra data
+      // Create this tgt mask field, and assign it to the tgt field extra data.
+      // The interp plan will set it to 1 where the tgt pressure is within the src bounds, 0 elsewhere.
 
       FieldIdentifier src_mask_fid (mask_name, src_layout, nondim, m_src_grid->name() );
       FieldIdentifier tgt_mask_fid = create_tgt_fid(src_mask_fid);
 
-      Field src_mask (src_mask_fid);
-      src_mask.allocate_view();
-
       tgt_mask  = Field (tgt_mask_fid);
       tgt_mask.allocate_view();
 
-      // Initialize the src mask values to 1.0
-      src_mask.deep_copy(1.0);
-
-      m_src_masks.push_back(src_mask);
       m_tgt_masks.push_back(tgt_mask);
 
-      auto& mt = m_field2type[src_mask_fid.name()];
-      mt.packed = false;
-      mt.midpoints = src_layout.has_tag(LEV);
+      m_field2midpoints[mask_name] = src_layout.has_tag(LEV);
     } else {
       for (size_t i=0; i<m_tgt_masks.size(); ++i) {
         if (m_tgt_masks[i].name()==mask_name) {
@@ -299,107 +285,63 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
   }
 
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
-    create_lin_interp ();
+    create_interp_plans ();
   }
 }
 
 void VerticalRemapper::do_registration_ends ()
 {
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
-    create_lin_interp ();
+    create_interp_plans ();
   }
 }
 
-void VerticalRemapper::create_lin_interp()
+void VerticalRemapper::create_interp_plans()
 {
-  // Count number fields for each packed-midpoints value
-  auto beg = m_field2type.begin();
-  auto end = m_field2type.end();
-
-  int num_packed_mid =
-    std::count_if(beg,end,[](const std::pair<std::string,FType>& it)
-        {
-          return it.second.midpoints and it.second.packed;
-        });
-  int num_packed_int =
-    std::count_if(beg,end,[](const std::pair<std::string,FType>& it)
-        {
-          return not it.second.midpoints and it.second.packed;
-        });
-  int num_scalar_mid =
-    std::count_if(beg,end,[](const std::pair<std::string,FType>& it)
-        {
-          return it.second.midpoints and not it.second.packed;
-        });
-  int num_scalar_int =
-    std::count_if(beg,end,[](const std::pair<std::string,FType>& it)
-        {
-          return not it.second.midpoints and not it.second.packed;
-        });
-
-  // Create the linear interpolation object
-  const auto ncols     = m_src_grid->get_num_local_dofs();
-  const auto nlevs_src = m_src_grid->get_num_vertical_levels();
-  const auto nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
-
-  if (num_packed_mid>0) {
-    m_lin_interp_mid_packed =
-      std::make_shared<ekat::LinInterp<Real,SCREAM_PACK_SIZE>>(ncols,nlevs_src,nlevs_tgt);
-  }
-  if (num_scalar_mid>0) {
-    m_lin_interp_mid_scalar =
-      std::make_shared<ekat::LinInterp<Real,1>>(ncols,nlevs_src,nlevs_tgt);
-  }
-  if (num_packed_int>0) {
-    m_lin_interp_int_packed =
-      std::make_shared<ekat::LinInterp<Real,SCREAM_PACK_SIZE>>(ncols,nlevs_src,nlevs_tgt);
+  using namespace ShortFieldTagsNames;
+
+  // Create the plans only if some field needs them
+  m_plan_mid = m_plan_int = nullptr;
+  auto get_plan = [&](const bool midpoints) {
+    auto& plan = midpoints ? m_plan_mid : m_plan_int;
+    if (not plan) {
+      plan = std::make_shared<VerticalInterpPlan>(midpoints ? m_src_pmid : m_src_pint,m_tgt_pressure);
+    }
+    return plan;
+  };
+
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& f_src = m_src_fields[i];
+    const auto& f_tgt = m_tgt_fields[i];
+    const auto& tgt_layout = f_tgt.get_header().get_identifier().get_layout();
+    if (tgt_layout.has_tag(LEV)) {
+      get_plan(m_field2midpoints.at(f_src.name()))->add_field(f_src,f_tgt,m_mask_val);
+    }
   }
-  if (num_scalar_int>0) {
-    m_lin_interp_int_scalar =
-      std::make_shared<ekat::LinInterp<Real,1>>(ncols,nlevs_src,nlevs_tgt);
+  for (const auto& mask : m_tgt_masks) {
+    get_plan(m_field2midpoints.at(mask.name()))->add_mask(mask);
   }
 }
 
 void VerticalRemapper::do_remap_fwd ()
 {
-  // 1. Setup any interp object that was created (if nullptr, no fields need it)
-  if (m_lin_interp_mid_packed) {
-    setup_lin_interp(*m_lin_interp_mid_packed,m_src_pmid);
-  }
-  if (m_lin_interp_int_packed) {
-    setup_lin_interp(*m_lin_interp_int_packed,m_src_pint);
-  }
-  if (m_lin_interp_mid_scalar) {
-    setup_lin_interp(*m_lin_interp_mid_scalar,m_src_pmid);
-  }
-  if (m_lin_interp_int_scalar) {
-    setup_lin_interp(*m_lin_interp_int_scalar,m_src_pint);
-  }
-
   using namespace ShortFieldTagsNames;
 
-  // 2. Interpolate the fields
+  // 1. Interpolate all fields with LEV/ILEV (and their masks), with one
+  //    setup and one kernel launch for each src pressure profile
+  for (auto plan : {m_plan_mid, m_plan_int}) {
+    if (plan) {
+      plan->setup();
+      plan->apply();
+    }
+  }
+
+  // 2. Copy the fields that do not need vertical interpolation
   for (int i=0; i<m_num_fields; ++i) {
     const auto& f_src    = m_src_fields[i];
           auto& f_tgt    = m_tgt_fields[i];
     const auto& tgt_layout   = f_tgt.get_header().get_identifier().get_layout();
-    if (tgt_layout.has_tag(LEV)) {
-      const auto& type = m_field2type.at(f_src.name());
-      // Dispatch interpolation to the proper lin interp object
-      if (type.midpoints) {
-        if (type.packed) {
-          apply_vertical_interpolation(*m_lin_interp_mid_packed,f_src,f_tgt,m_src_pmid,m_mask_val);
-        } else {
-          apply_vertical_interpolation(*m_lin_interp_mid_scalar,f_src,f_tgt,m_src_pmid,m_mask_val);
-        }
-      } else {
-        if (type.packed) {
-          apply_vertical_interpolation(*m_lin_interp_int_packed,f_src,f_tgt,m_src_pint,m_mask_val);
-        } else {
-          apply_vertical_interpolation(*m_lin_interp_int_scalar,f_src,f_tgt,m_src_pint,m_mask_val);
-        }
-      }
-    } else {
+    if (not tgt_layout.has_tag(LEV)) {
       // There is nothing to do, this field does not need vertical interpolation,
       // so just copy it over.  Note, if this field has its own mask data make
       // sure that is copied too.
@@ -411,149 +353,6 @@ void VerticalRemapper::do_remap_fwd ()
       }
     }
   }
-
-  // 3. Interpolate the mask fields
-  for (unsigned i=0; i<m_tgt_masks.size(); ++i) {
-          auto& f_src = m_src_masks[i];
-          auto& f_tgt = m_tgt_masks[i];
-    const auto& type = m_field2type.at(f_src.name());
-
-    // Dispatch interpolation to the proper lin interp object
-    if (type.midpoints) {
-      if (type.packed) {
-        apply_vertical_interpolation(*m_lin_interp_mid_packed,f_src,f_tgt,m_src_pmid,0);
-      } else {
-        apply_vertical_interpolation(*m_lin_interp_mid_scalar,f_src,f_tgt,m_src_pmid,0);
-      }
-    } else {
-      if (type.packed) {
-        apply_vertical_interpolation(*m_lin_interp_int_packed,f_src,f_tgt,m_src_pint,0);
-      } else {
-        apply_vertical_interpolation(*m_lin_interp_int_scalar,f_src,f_tgt,m_src_pint,0);
-      }
-    }
-  }
-}
-
-template<int Packsize>
-void VerticalRemapper::
-setup_lin_interp (const ekat::LinInterp<Real,Packsize>& lin_interp,
-                  const Field& p_src) const
-{
-  using LI_t = ekat::LinInterp<Real,Packsize>;
-  using ESU = ekat::ExeSpaceUtils<DefaultDevice::execution_space>;
-  using PackT = ekat::Pack<Real,Packsize>;
-  auto p_src_v = p_src.get_view<const PackT**>();
-  auto p_tgt_v = m_tgt_pressure.get_view<const PackT*>();
-
-  auto lambda = KOKKOS_LAMBDA(typename LI_t::MemberType const& team) {
-    const int icol = team.league_rank();
-    lin_interp.setup(team,ekat::subview(p_src_v,icol),
-                          p_tgt_v);
-  };
-
-  const int ncols = m_src_grid->get_num_local_dofs();
-  const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
-  const int npacks_tgt = ekat::PackInfo<Packsize>::num_packs(nlevs_tgt);
-  auto policy = ESU::get_default_team_policy(ncols,npacks_tgt);
-  Kokkos::parallel_for("VerticalRemapper::interp_setup",policy,lambda);
-  Kokkos::fence();
-}
-
-template<int Packsize>
-void VerticalRemapper::
-apply_vertical_interpolation(const ekat::LinInterp<Real,Packsize>& lin_interp,
-                             const Field& f_src, const Field& f_tgt,
-                             const Field& p_src,
-                             const Real mask_val) const
-{
-  // Note: if Packsize==1, we grab packs of size 1, which are for sure
-  //       compatible with the allocation
-  using LI_t = ekat::LinInterp<Real,Packsize>;
-  using PackT = ekat::Pack<Real,Packsize>;
-  using ESU = ekat::ExeSpaceUtils<DefaultDevice::execution_space>;
-
-  auto p_src_v = p_src.get_view<const PackT**>();
-  auto x_tgt = m_tgt_pressure.get_view<const PackT*>();
-  const auto& f_src_l = f_src.get_header().get_identifier().get_layout();
-  const int ncols = m_src_grid->get_num_local_dofs();
-  const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
-  const int nlevs_src = f_src_l.dims().back();
-  const int npacks_tgt = ekat::PackInfo<Packsize>::num_packs(nlevs_tgt);
-
-  const int last_src_pack_idx = ekat::PackInfo<Packsize>::last_pack_idx(nlevs_src);
-  const int last_src_pack_end = ekat::PackInfo<Packsize>::last_vec_end(nlevs_src);
-  
-  switch(f_src.rank()) {
-    case 2:
-    {
-      auto f_src_v = f_src.get_view<const PackT**>();
-      auto f_tgt_v = f_tgt.get_view<      PackT**>();
-      auto policy = ESU::get_default_team_policy(ncols,npacks_tgt);
-      auto lambda = KOKKOS_LAMBDA(typename LI_t::MemberType const& team) {
-
-        // Interpolate
-        const int icol = team.league_rank();
-        auto x_src = ekat::subview(p_src_v,icol);
-        auto y_src = ekat::subview(f_src_v,icol);
-        auto y_tgt = ekat::subview(f_tgt_v,icol);
-        lin_interp.lin_interp(team,x_src,x_tgt,y_src,y_tgt,icol);
-        team.team_barrier();
-
-        // If x_tgt is extrapolated, set to mask_val
-        auto x_min = x_src[0][0];
-        auto x_max = x_src[last_src_pack_idx][last_src_pack_end-1];
-        auto set_mask = [&](const int ipack) {
-          auto in_range = ekat::range<PackT>(ipack*Packsize) < nlevs_tgt;
-          auto oob = (x_tgt[ipack]<x_min or x_tgt[ipack]>x_max) and in_range;
-          if (oob.any()) {
-            y_tgt[ipack].set(oob,mask_val);
-          }
-        };
-        Kokkos::parallel_for (Kokkos::TeamThreadRange(team,npacks_tgt), set_mask);
-      };
-      Kokkos::parallel_for("VerticalRemapper::apply_vertical_interpolation",policy,lambda);
-      break;
-    }
-    case 3:
-    {
-      auto f_src_v = f_src.get_view<const PackT***>();
-      auto f_tgt_v = f_tgt.get_view<      PackT***>();
-      const auto& layout = f_src.get_header().get_identifier().get_layout();
-      const int ncomps = layout.get_vector_dim();
-      auto policy = ESU::get_default_team_policy(ncols*ncomps,npacks_tgt);
-
-      auto lambda = KOKKOS_LAMBDA(typename LI_t::MemberType const& team)
-      {
-        // Interpolate
-        const int icol = team.league_rank() / ncomps;
-        const int icmp = team.league_rank() % ncomps;
-        auto x_src = ekat::subview(p_src_v,icol);
-        auto y_src = ekat::subview(f_src_v,icol,icmp);
-        auto y_tgt = ekat::subview(f_tgt_v,icol,icmp);
-        lin_interp.lin_interp(team,x_src,x_tgt,y_src,y_tgt,icol);
-        team.team_barrier();
-
-        // If x_tgt is extrapolated, set to mask_val
-        auto x_min = x_src[0][0];
-        auto x_max = x_src[last_src_pack_idx][last_src_pack_end-1];
-        auto set_mask = [&](const int ipack) {
-          auto oob = x_tgt[ipack]<x_min or x_tgt[ipack]>x_max;
-          if (oob.any()) {
-            y_tgt[ipack].set(oob,mask_val);
-          }
-        };
-        Kokkos::parallel_for (Kokkos::TeamThreadRange(team,npacks_tgt), set_mask);
-      };
-      Kokkos::parallel_for("VerticalRemapper::apply_vertical_interpolation",policy,lambda);
-      break;
-    }
-    default:
-      EKAT_ERROR_MSG (
-          "[VerticalRemapper::apply_vertical_interpolation] Error! Unsupported field rank.\n"
-          " - src field name: " + f_src.name() + "\n"
-          " - src field rank: " + std::to_string(f_src.rank()) + "\n");
-  }
 }
 
 } // namespace scream
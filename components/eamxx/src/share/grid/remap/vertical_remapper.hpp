@@ -2,8 +2,7 @@
 #define EAMXX_VERTICAL_REMAPPER_HPP
 
 #include "share/grid/remap/abstract_remapper.hpp"
-
-#include <ekat/util/ekat_lin_interp.hpp>
+#include "share/util/eamxx_vertical_interp_plan.hpp"
 
 namespace scream
 {
@@ -92,30 +91,8 @@ protected:
   void set_pressure_levels (const std::string& map_file);
   void do_print();
 
-#ifdef KOKKOS_ENABLE_CUDA
-public:
-#endif
-  template<int N>
-  void apply_vertical_interpolation (const ekat::LinInterp<Real,N>& lin_interp,
-                                     const Field& f_src, const Field& f_tgt,
-                                     const Field& p_src,
-                                     const Real mask_value) const;
-
-
-  template<int N>
-  void setup_lin_interp (const ekat::LinInterp<Real,N>& lin_interp,
-                         const Field& p_src) const;
-protected:
-
   void set_source_pressure_fields(const Field& pmid, const Field& pint);
-  void create_lin_interp ();
-  
-  using KT = KokkosTypes<DefaultDevice>;
-
-  template<typename T>
-  using view_1d = typename KT::template view_1d<T>;
-  template<typename T>
-  using view_2d = typename KT::template view_2d<T>;
+  void create_interp_plans ();
 
   ekat::Comm            m_comm;
 
@@ -123,7 +100,6 @@ protected:
   std::vector<Field>    m_src_fields;
   std::vector<Field>    m_tgt_fields;
   std::vector<Field>    m_tgt_masks;
-  std::vector<Field>    m_src_masks;
 
   // Vertical profile fields, both for source and target
   Real                  m_mask_val;
@@ -131,20 +107,16 @@ protected:
   Field                 m_src_pmid;  // Src vertical profile for LEV layouts
   Field                 m_src_pint;  // Src vertical profile for ILEV layouts
 
-  // We need to remap mid/int fields separately, and we want to use packs if possible,
-  // so we need to divide input fields into 4 separate categories
+  // We need to remap mid/int fields separately, so we need to divide
+  // input fields (and masks) into 2 separate categories
 
-  // Map field id to whether it's packed/scalar and midpoint/interface
-  struct FType {
-    bool packed = false;
-    bool midpoints = true;
-  };
-  std::map<std::string,FType> m_field2type;
+  // Map field id to whether it's midpoint/interface
+  std::map<std::string,bool> m_field2midpoints;
 
-  std::shared_ptr<ekat::LinInterp<Real,SCREAM_PACK_SIZE>> m_lin_interp_mid_packed;
-  std::shared_ptr<ekat::LinInterp<Real,SCREAM_PACK_SIZE>> m_lin_interp_int_packed;
-  std::shared_ptr<ekat::LinInterp<Real,1>>                m_lin_interp_mid_scalar;
-  std::shared_ptr<ekat::LinInterp<Real,1>>                m_lin_interp_int_scalar;
+  // The interpolation plans for midpoint and interface fields. The brackets/weights
+  // are computed once per remap call, and then applied to all fields at once.
+  std::shared_ptr<VerticalInterpPlan>  m_plan_mid;
+  std::shared_ptr<VerticalInterpPlan>  m_plan_int;
 };
 
 } // namespace scream
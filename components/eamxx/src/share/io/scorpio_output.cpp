@@ -9,7 +9,12 @@
 #include "ekat/util/ekat_units.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 #include "ekat/std_meta/ekat_std_utils.hpp"
+#include "ekat/util/ekat_math_utils.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <numeric>
 #include <fstream>
 
@@ -71,6 +76,39 @@ void combine_and_fill (const Real& new_val, Real& curr_val, const OutputAvgType
   }
 }
 
+// Round the mantissa of x to keepbits bits (round to nearest, ties to even),
+// setting all the trailing bits to zero. This is the "bit-round" quantization,
+// which makes output data much more compressible, while keeping the relative
+// error below 2^-(keepbits+1).
+KOKKOS_INLINE_FUNCTION
+Real bit_round (const Real x, const int keepbits)
+{
+  using uint_t = typename std::conditional<sizeof(Real)==8,std::uint64_t,std::uint32_t>::type;
+  constexpr int mantissa_bits = std::numeric_limits<Real>::digits - 1;
+
+  if (keepbits>=mantissa_bits or ekat::is_invalid(x)) {
+    return x;
+  }
+
+  uint_t bits;
+  memcpy(&bits,&x,sizeof(Real));
+  const int drop = mantissa_bits - keepbits;
+  const uint_t half_minus_one = (uint_t(1) << (drop-1)) - 1;
+  const uint_t mask = ~((uint_t(1) << drop) - 1);
+  const uint_t is_odd = (bits >> drop) & 1;
+  bits = (bits + half_minus_one + is_odd) & mask;
+
+  Real y;
+  memcpy(&y,&bits,sizeof(Real));
+  return y;
+}
+
+// The number of mantissa bits needed to retain nsd significant decimal digits
+int nsd_to_keepbits (const int nsd)
+{
+  return static_cast<int>(std::ceil(nsd*std::log2(10.0)));
+}
+
 // This helper function is used to make sure that the list of fields in
 // m_fields_names is a list of unique strings, otherwise throw an error.
 void sort_and_check(std::vector<std::string>& fields)
@@ -210,6 +248,49 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   if (params.isParameter("fill_threshold")) {
     m_avg_coeff_threshold = params.get<Real>("fill_threshold");
   }
+  if (params.isParameter("remap_policy")) {
+    const auto& remap_policy = params.get<std::string>("remap_policy");
+    m_remap_policy = str2remap_policy(remap_policy);
+    EKAT_REQUIRE_MSG (m_remap_policy!=OutputRemapPolicy::Invalid,
+        "Error! Unsupported remap policy '" + remap_policy + "'.\n"
+        "       Valid options: every_step, on_change, at_write. Case insensitive.\n");
+  }
+  if (m_remap_policy==OutputRemapPolicy::AtWrite) {
+    // Accumulating on the src grid and remapping the accumulated values is only
+    // equivalent to accumulating the remapped values if the remap is linear
+    EKAT_REQUIRE_MSG (m_avg_type==OutputAvgType::Average,
+        "Error! remap_policy=at_write is only supported for Average output.\n"
+        "  - Averaging Type: " + avg_type + "\n");
+    EKAT_REQUIRE_MSG (use_online_remapper or use_horiz_remap_from_file,
+        "Error! remap_policy=at_write requires a horizontal remap.\n");
+    EKAT_REQUIRE_MSG (not use_vertical_remap_from_file and not m_track_avg_cnt,
+        "Error! remap_policy=at_write is not supported with vertical remap or avg count tracking.\n");
+  }
+  if (params.isSublist("compression")) {
+    const auto& c_pl = params.sublist("compression");
+    if (c_pl.isParameter("deflate_level")) {
+      m_deflate_level = c_pl.get<int>("deflate_level");
+      EKAT_REQUIRE_MSG (m_deflate_level>=0 and m_deflate_level<=9,
+          "Error! Invalid value for compression->deflate_level (must be in [0,9]).\n"
+          "  - input value: " + std::to_string(m_deflate_level) + "\n");
+    }
+    if (c_pl.isParameter("shuffle")) {
+      m_shuffle = c_pl.get<bool>("shuffle");
+    }
+
+    // Quantization: a non-positive number of significant digits means no quantization
+    const int nsd = c_pl.isParameter("significant_digits") ? c_pl.get<int>("significant_digits") : -1;
+    const bool has_per_field_nsd = c_pl.isSublist("significant_digits_per_field");
+    for (const auto& fname : m_fields_names) {
+      int fnsd = nsd;
+      if (has_per_field_nsd and c_pl.sublist("significant_digits_per_field").isParameter(fname)) {
+        fnsd = c_pl.sublist("significant_digits_per_field").get<int>(fname);
+      }
+      if (fnsd>0) {
+        m_quantize_keepbits[fname] = nsd_to_keepbits(fnsd);
+      }
+    }
+  }
 
   // Helper lambda, to copy io string attributes. This will be used if any
   // remapper is created, to ensure atts set by atm_procs are not lost
@@ -291,6 +372,27 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
       m_horiz_remapper = grids_mgr->create_remapper(fm_grid,io_grid);
     }
 
+    // With remap_policy=at_write, the remapper src fields are accumulators on the src grid
+    if (m_remap_policy==OutputRemapPolicy::AtWrite) {
+      auto acc_fm = std::make_shared<fm_type>(fm_pre_hremap->get_grid());
+      acc_fm->registration_begins();
+      for (const auto& fname : m_fields_names) {
+        const auto src = get_field(fname,"before_horizontal_remap");
+        EKAT_REQUIRE_MSG (not src.get_header().has_extra_data("mask_data"),
+            "Error! remap_policy=at_write is not supported for masked fields.\n"
+            "  - field name: " + fname + "\n");
+        const auto packsize = src.get_header().get_alloc_properties().get_largest_pack_size();
+        acc_fm->register_field(FieldRequest(src.get_header().get_identifier(),packsize));
+      }
+      acc_fm->registration_ends();
+      for (const auto& fname : m_fields_names) {
+        acc_fm->get_field(fname).deep_copy(0);
+      }
+      set_field_manager(acc_fm,"src_accumulators");
+    }
+    const std::string hremap_src_mode = m_remap_policy==OutputRemapPolicy::AtWrite
+                                      ? "src_accumulators" : "before_horizontal_remap";
+
     // Create a FM on the horiz remapper tgt grid, and register fields on it
     auto io_fm = std::make_shared<fm_type>(io_grid);
     io_fm->registration_begins();
@@ -310,7 +412,7 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
     // Register all output fields in the remapper.
     m_horiz_remapper->registration_begins();
     for (const auto& fname : m_fields_names) {
-      const auto src = get_field(fname,"before_horizontal_remap");
+      const auto src = get_field(fname,hremap_src_mode);
       const auto tgt = io_fm->get_field(src.name());
       EKAT_REQUIRE_MSG(src.data_type()==DataType::RealType,
           "Error! I/O supports only Real data, for now.\n");
@@ -414,6 +516,26 @@ run (const std::string& filename,
     }
   }; // end apply_remap
 
+  // With remap_policy=at_write, we accumulate on the src grid, and remap only at write steps.
+  // Since the remap is linear, the remapped sum equals the sum of the remapped fields.
+  if (m_remap_policy==OutputRemapPolicy::AtWrite) {
+    start_timer("EAMxx::IO::src_accumulate");
+    for (const auto& name : m_fields_names) {
+      const auto src = get_field(name,"before_horizontal_remap");
+            auto acc = get_field(name,"src_accumulators");
+      acc.update(src,Real(1),Real(1));
+
+      const auto& src_t = src.get_header().get_tracking().get_time_stamp();
+      if (src_t.is_valid()) {
+        acc.get_header().get_tracking().update_time_stamp(src_t);
+      }
+    }
+    stop_timer("EAMxx::IO::src_accumulate");
+    if (not is_write_step) {
+      return;
+    }
+  }
+
   // If needed, remap fields from their grid to the unique grid, for I/O
   if (m_vert_remapper) {
     start_timer("EAMxx::IO::vert_remap");
@@ -422,9 +544,22 @@ run (const std::string& filename,
   }
 
   if (m_horiz_remapper) {
-    start_timer("EAMxx::IO::horiz_remap");
-    apply_remap(m_horiz_remapper);
-    stop_timer("EAMxx::IO::horiz_remap");
+    // With remap_policy=on_change, the tgt fields still store the remap of the
+    // src fields if none of the src fields got a new time stamp since last remap
+    bool src_changed = m_remap_policy!=OutputRemapPolicy::OnChange;
+    const int num_remap_fields = m_horiz_remapper->get_num_fields();
+    m_horiz_remap_src_ts.resize(num_remap_fields);
+    for (int i=0; i<num_remap_fields; ++i) {
+      const auto& src_t = m_horiz_remapper->get_src_field(i).get_header().get_tracking().get_time_stamp();
+      src_changed |= not src_t.is_valid() or not (src_t==m_horiz_remap_src_ts[i]);
+      m_horiz_remap_src_ts[i] = src_t;
+    }
+
+    if (src_changed) {
+      start_timer("EAMxx::IO::horiz_remap");
+      apply_remap(m_horiz_remapper);
+      stop_timer("EAMxx::IO::horiz_remap");
+    }
   }
 
   // Update all of the averaging count views (if needed)
@@ -486,7 +621,8 @@ run (const std::string& filename,
         m_avg_type==OutputAvgType::Instant &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
-        not is_diagnostic;
+        not is_diagnostic &&
+        m_quantize_keepbits.count(name)==0;
 
     // Manually update the 'running-tally' views with data from the field,
     // by combining new data with current avg values.
@@ -617,6 +753,16 @@ run (const std::string& filename,
           });
         }
       }
+      // Quantize on device, before the host copy. Checkpoints store running tallies,
+      // which must be restarted exactly, so we only quantize actual output.
+      if (output_step and m_quantize_keepbits.count(name)==1) {
+        const int keepbits = m_quantize_keepbits.at(name);
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+          if (data[i]!=fill_value) {
+            data[i] = bit_round(data[i],keepbits);
+          }
+        });
+      }
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
@@ -627,6 +773,13 @@ run (const std::string& filename,
       duration_write += duration_loc.count();
     }
   }
+  // The src accumulators values are now part of the io-grid running tallies
+  if (is_write_step and m_remap_policy==OutputRemapPolicy::AtWrite) {
+    for (const auto& name : m_fields_names) {
+      get_field(name,"src_accumulators").deep_copy(0);
+    }
+  }
+
   // Handle writing the average count variables to file
   if (is_write_step) {
     for (const auto& name : m_avg_cnt_names) {
@@ -681,6 +834,7 @@ res_dep_memory_footprint () const {
     bool is_diagnostic = (m_diagnostics.find(fn) != m_diagnostics.end());
     bool can_alias_field_view =
         m_avg_type==OutputAvgType::Instant && not is_diagnostic &&
+        m_quantize_keepbits.count(fn)==0 &&
         io_field_mgr->get_field(fn).get_header().get_alloc_properties().get_padding()==0 &&
         io_field_mgr->get_field(fn).get_header().get_parent().expired();
 
@@ -805,12 +959,13 @@ void AtmosphereOutput::register_views()
     // would be strided).
     //
     // We also don't want to alias to a diagnostic output since it could share memory
-    // with another diagnostic.
+    // with another diagnostic, nor if the field is quantized (which is done in place).
     bool can_alias_field_view =
         m_avg_type==OutputAvgType::Instant &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
-        not is_diagnostic;
+        not is_diagnostic &&
+        m_quantize_keepbits.count(name)==0;
 
     const auto layout = m_layouts.at(field.name());
     const auto size = layout.size();
@@ -940,6 +1095,19 @@ register_variables(const std::string& filename,
     }
     return vec_of_dims;
   };
+  bool compression_warned = false;
+  auto set_compression = [&](const std::string& varname) {
+    if (m_deflate_level==0) {
+      return;
+    }
+    const bool ok = scorpio::set_var_compression(filename,varname,m_deflate_level,m_shuffle);
+    if (not ok and not compression_warned and m_atm_logger) {
+      m_atm_logger->warn("[EAMxx::scorpio_output] Compression requested, but the file iotype does not support it.\n"
+                         "  - filename: " + filename + "\n"
+                         "  - supported iotypes: netcdf4c, netcdf4p\n");
+      compression_warned = true;
+    }
+  };
 
   // Cycle through all fields and register.
   for (auto const& name : m_fields_names) {
@@ -987,6 +1155,10 @@ register_variables(const std::string& filename,
     } else {
       scorpio::define_var (filename, name, units, vec_of_dims,
                             "real",fp_precision, m_add_time_dim);
+      set_compression(name);
+      if (m_quantize_keepbits.count(name)==1) {
+        scorpio::set_attribute(filename,name,"quantization_nsb",m_quantize_keepbits.at(name));
+      }
 
       // Add FillValue as an attribute of each variable
       // FillValue is a protected metadata, do not add it if it already existed
@@ -1043,6 +1215,7 @@ register_variables(const std::string& filename,
       auto vec_of_dims   = set_vec_of_dims(layout);
       scorpio::define_var(filename, name, "unitless", vec_of_dims,
                           "real",fp_precision, m_add_time_dim);
+      set_compression(name);
     }
   }
 } // register_variables
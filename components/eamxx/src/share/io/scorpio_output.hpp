@@ -28,6 +28,7 @@
  *  filename_prefix:              STRING
  *  Averaging Type:               STRING
  *  Max Snapshots Per File:       INT                   (default: 1)
+ *  remap_policy:                 STRING                (default: every_step)
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:            ARRAY OF STRINGS
@@ -45,6 +46,12 @@
  *  Restart:
  *    filename_prefix:            STRING                (default: ${filename_prefix})
  *    Perform Restart:            BOOL                  (default: true)
+ *  compression:                                        (optional)
+ *    deflate_level:              INT                   (default: 0)
+ *    shuffle:                    BOOL                  (default: true)
+ *    significant_digits:         INT                   (default: -1)
+ *    significant_digits_per_field:                     (optional)
+ *      FIELD_NAME:               INT
  *  -----
  *  The meaning of these parameters is the following:
  *  - filename_prefix: the output filename root.
@@ -60,6 +67,15 @@
  *        - Field Names: names of fields defined on grid $grid_name that need to be outputed
  *        - IO Grid Name: if provided, remap fields to this grid before output (useful to remap
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
+ *  - remap_policy: if fields are horizontally remapped before output, when to do the remap:
+ *      every_step - remap all fields at every step, and accumulate on the io grid.
+ *      on_change  - like every_step, but skip the remap if none of the fields to remap changed
+ *                   (i.e., got a new time stamp) since the last remap.
+ *      at_write   - accumulate on the src grid, and remap only at write (or checkpoint) steps.
+ *                   Only valid for Average output of unmasked fields without vertical remap,
+ *                   since it relies on the remap being linear. It trades remap cost at every
+ *                   step for the storage of one src-grid accumulator per field, so it pays off
+ *                   for streams averaging over many steps (e.g., monthly averages).
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
  *  - Output: parameters for output control
@@ -75,6 +91,15 @@
  *    - Perform Restart: if this is a restarted run, and Averaging Type is not Instant, this flag
  *      determines whether we want to restart the output history or start from scrach. That is,
  *      you can set this to false to force a fresh new history, even in a restarted run.
+ *  - compression: parameters for compressed and/or reduced-precision output
+ *    - deflate_level: level of lossless (deflate) compression, in [0,9] (0 means no compression).
+ *      Only used if the file iotype is netcdf4c or netcdf4p, ignored otherwise.
+ *    - shuffle: whether to apply the shuffle filter before compression.
+ *    - significant_digits: if positive, the output values of all fields are rounded (on device)
+ *      to the number of mantissa bits needed to retain this many significant decimal digits
+ *      (bit-rounding). The trailing zero bits make the data much more compressible.
+ *      Note: this is lossy, and it is only done for output steps (not for checkpoints).
+ *    - significant_digits_per_field: override significant_digits for specific fields.
 
  *  Notes:
  *   - you can specify lists with either of the two syntaxes:
@@ -190,10 +215,14 @@ protected:
   std::shared_ptr<const grid_type>            m_io_grid;
   std::shared_ptr<remapper_type>              m_horiz_remapper;
   std::shared_ptr<remapper_type>              m_vert_remapper;
+
+  // Time stamps of the horiz remapper src fields at the last remap (for remap_policy=on_change)
+  std::vector<util::TimeStamp>                m_horiz_remap_src_ts;
   std::shared_ptr<const gm_type>              m_grids_manager;
 
   // How to combine multiple snapshots in the output: Instant, Max, Min, Average
   OutputAvgType     m_avg_type;
+  OutputRemapPolicy m_remap_policy = OutputRemapPolicy::EveryStep;
   Real              m_avg_coeff_threshold = 0.5; // % of unfilled values required to not just assign value as FillValue
 
   // Internal maps to the output fields, how the columns are distributed, the file dimensions and the global ids.
@@ -219,6 +248,11 @@ protected:
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
+  // Compression options. For quantized fields, store the number of mantissa bits to keep
+  int                         m_deflate_level = 0;
+  bool                        m_shuffle = true;
+  std::map<std::string,int>   m_quantize_keepbits;
+
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
 
@@ -0,0 +1,266 @@
+#include "share/io/scream_fast_restart.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace scream
+{
+
+namespace {
+
+// Bump this if the format of the file changes
+constexpr char fast_restart_magic[] = "EAMXXFR1";
+constexpr int  fast_restart_magic_len = sizeof(fast_restart_magic)-1;
+
+// A simple FNV-1a hash of the gids owned by this rank along the partitioned dim.
+// This is what determines the I/O decomposition, so if the hash matches,
+// the data stored in the file corresponds to the dofs owned by this rank.
+std::uint64_t gids_fingerprint (const std::shared_ptr<const AbstractGrid>& grid)
+{
+  using gid_type = AbstractGrid::gid_type;
+  auto gids = grid->get_partitioned_dim_gids().get_view<const gid_type*,Host>();
+
+  std::uint64_t h = 14695981039346656037ULL;
+  const auto bytes = reinterpret_cast<const unsigned char*>(gids.data());
+  const size_t nbytes = gids.size()*sizeof(gid_type);
+  for (size_t i=0; i<nbytes; ++i) {
+    h ^= bytes[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+template<typename T>
+void write_pod (std::ofstream& ofs, const T& v) {
+  ofs.write(reinterpret_cast<const char*>(&v),sizeof(T));
+}
+
+void write_str (std::ofstream& ofs, const std::string& s) {
+  write_pod(ofs,static_cast<std::int32_t>(s.size()));
+  ofs.write(s.data(),s.size());
+}
+
+template<typename T>
+bool read_pod (std::ifstream& ifs, T& v) {
+  ifs.read(reinterpret_cast<char*>(&v),sizeof(T));
+  return ifs.good();
+}
+
+bool read_str (std::ifstream& ifs, std::string& s) {
+  std::int32_t len;
+  if (not read_pod(ifs,len) or len<0) {
+    return false;
+  }
+  s.resize(len);
+  ifs.read(&s[0],len);
+  return ifs.good();
+}
+
+std::vector<Field> get_restart_fields (const FieldManager& fm)
+{
+  std::vector<Field> fields;
+  if (fm.has_group("RESTART")) {
+    for (const auto& fn : fm.get_groups_info().at("RESTART")->m_fields_names) {
+      fields.push_back(fm.get_field(fn));
+    }
+  }
+  return fields;
+}
+
+} // anonymous namespace
+
+std::string fast_restart_filename (const std::string& restart_filename, const int rank)
+{
+  std::stringstream ss;
+  ss << restart_filename << ".fast." << std::setw(6) << std::setfill('0') << rank << ".bin";
+  return ss.str();
+}
+
+void write_fast_restart (const std::string& restart_filename,
+                         const ekat::Comm& comm,
+                         const std::vector<std::shared_ptr<const FieldManager>>& field_mgrs)
+{
+  const auto filename = fast_restart_filename(restart_filename,comm.rank());
+  std::ofstream ofs(filename,std::ios::binary | std::ios::trunc);
+  EKAT_REQUIRE_MSG (ofs.good(),
+      "Error! Could not open fast restart file for writing.\n"
+      " - filename: " + filename + "\n");
+
+  // Header
+  ofs.write(fast_restart_magic,fast_restart_magic_len);
+  write_pod(ofs,static_cast<std::int32_t>(comm.size()));
+  write_pod(ofs,static_cast<std::int32_t>(comm.rank()));
+
+  std::int32_t ngrids = 0;
+  for (const auto& fm : field_mgrs) {
+    ngrids += fm->has_group("RESTART") ? 1 : 0;
+  }
+  write_pod(ofs,ngrids);
+
+  for (const auto& fm : field_mgrs) {
+    if (not fm->has_group("RESTART")) {
+      continue;
+    }
+    const auto& grid = fm->get_grid();
+    const auto fields = get_restart_fields(*fm);
+
+    write_str(ofs,grid->name());
+    write_pod(ofs,gids_fingerprint(grid));
+    write_pod(ofs,static_cast<std::int32_t>(fields.size()));
+
+    for (const auto& f : fields) {
+      // Clone the field, so that we get a contiguous host copy of its data,
+      // regardless of whether f is a subfield or not. The clone copies the
+      // host view of f too, which may be stale, so sync the copy to host.
+      const auto f_copy = f.clone();
+      f_copy.sync_to_host();
+      const auto& fap = f_copy.get_header().get_alloc_properties();
+      const std::int64_t nbytes = fap.get_alloc_size();
+
+      write_str(ofs,f.name());
+      write_str(ofs,f.get_header().get_identifier().get_layout().to_string());
+      write_pod(ofs,nbytes);
+      ofs.write(static_cast<const char*>(f_copy.get_internal_view_data_unsafe<void,Host>()),nbytes);
+    }
+  }
+
+  EKAT_REQUIRE_MSG (ofs.good(),
+      "Error! Something went wrong while writing the fast restart file.\n"
+      " - filename: " + filename + "\n");
+}
+
+void remove_fast_restart (const std::string& restart_filename,
+                          const ekat::Comm& comm)
+{
+  // The file may not be there (e.g., it was written by a previous run), so ignore errors
+  std::remove(fast_restart_filename(restart_filename,comm.rank()).c_str());
+}
+
+bool read_fast_restart (const std::string& restart_filename,
+                        const ekat::Comm& comm,
+                        const std::vector<std::shared_ptr<const FieldManager>>& field_mgrs)
+{
+  // The fields we need to read, along with a contiguous buffer for each of them
+  struct Entry {
+    Field f;
+    Field buf;
+    bool found = false;
+  };
+  std::map<std::string,std::map<std::string,Entry>> entries;
+  std::map<std::string,std::shared_ptr<const AbstractGrid>> grids;
+  for (const auto& fm : field_mgrs) {
+    if (not fm->has_group("RESTART")) {
+      continue;
+    }
+    const auto& gname = fm->get_grid()->name();
+    grids[gname] = fm->get_grid();
+    for (const auto& f : get_restart_fields(*fm)) {
+      entries[gname][f.name()].f = f;
+    }
+  }
+
+  // Phase 1: load all the data in temporaries, checking that the file content
+  //          matches the current decomposition and field specs.
+  auto load = [&]() -> bool {
+    std::ifstream ifs(fast_restart_filename(restart_filename,comm.rank()),std::ios::binary);
+    if (not ifs.good()) {
+      return false;
+    }
+
+    char magic[fast_restart_magic_len];
+    ifs.read(magic,fast_restart_magic_len);
+    if (not ifs.good() or std::string(magic,fast_restart_magic_len)!=fast_restart_magic) {
+      return false;
+    }
+
+    std::int32_t size, rank, ngrids;
+    if (not read_pod(ifs,size) or size!=comm.size() or
+        not read_pod(ifs,rank) or rank!=comm.rank() or
+        not read_pod(ifs,ngrids)) {
+      return false;
+    }
+
+    for (int igrid=0; igrid<ngrids; ++igrid) {
+      std::string gname;
+      std::uint64_t fingerprint;
+      std::int32_t nfields;
+      if (not read_str(ifs,gname) or
+          not read_pod(ifs,fingerprint) or
+          not read_pod(ifs,nfields)) {
+        return false;
+      }
+
+      // We may not need all the grids in the file
+      const bool need_grid = grids.count(gname)==1;
+      if (need_grid and fingerprint!=gids_fingerprint(grids.at(gname))) {
+        // The decomposition has changed
+        return false;
+      }
+
+      for (int ifield=0; ifield<nfields; ++ifield) {
+        std::string fname, layout;
+        std::int64_t nbytes;
+        if (not read_str(ifs,fname) or
+            not read_str(ifs,layout) or
+            not read_pod(ifs,nbytes)) {
+          return false;
+        }
+
+        if (not need_grid or entries.at(gname).count(fname)==0) {
+          ifs.seekg(nbytes,std::ios::cur);
+          continue;
+        }
+
+        auto& e = entries.at(gname).at(fname);
+        if (layout!=e.f.get_header().get_identifier().get_layout().to_string()) {
+          return false;
+        }
+
+        e.buf = e.f.clone();
+        if (nbytes!=e.buf.get_header().get_alloc_properties().get_alloc_size()) {
+          return false;
+        }
+        ifs.read(static_cast<char*>(e.buf.get_internal_view_data_unsafe<void,Host>()),nbytes);
+        if (not ifs.good()) {
+          return false;
+        }
+        e.found = true;
+      }
+    }
+
+    // Make sure we got everything we need
+    for (const auto& g : entries) {
+      for (const auto& it : g.second) {
+        if (not it.second.found) {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+
+  // All ranks must succeed, otherwise we must fall back to the standard restart
+  int success = load() ? 1 : 0;
+  comm.all_reduce(&success,1,MPI_MIN);
+  if (success==0) {
+    return false;
+  }
+
+  // Phase 2: copy the data into the actual fields
+  for (auto& g : entries) {
+    for (auto& it : g.second) {
+      auto& e = it.second;
+      e.buf.sync_to_dev();
+      e.f.deep_copy<Device>(e.buf);
+      e.f.sync_to_host();
+    }
+  }
+  return true;
+}
+
+} // namespace scream
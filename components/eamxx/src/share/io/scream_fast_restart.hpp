@@ -0,0 +1,59 @@
+#ifndef SCREAM_FAST_RESTART_HPP
+#define SCREAM_FAST_RESTART_HPP
+
+#include "share/field/field_manager.hpp"
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <string>
+#include <vector>
+
+/*
+ * Utilities for the "fast restart" option of the model restart.
+ *
+ * Along with the (netcdf) model restart file, each rank can dump all the
+ * fields of the RESTART group(s) in a per-rank raw binary file. Upon restart,
+ * if the MPI decomposition has not changed (same number of ranks, and same
+ * dofs on each rank), the fields can be read back directly from those files,
+ * bypassing the collective reads (and the rearrangement) done by scorpio.
+ *
+ * The binary files store, for each grid, a fingerprint of the local dofs gids,
+ * as well as name, layout and size of each field, so that any mismatch is
+ * detected, in which case the reader reports a failure, and the caller can
+ * fall back to the standard scorpio-based restart.
+ *
+ * The binary files are only meant to speed up the restart from the latest
+ * checkpoint: when the model restart output writes a new set of files, it
+ * removes the set it wrote at the previous checkpoint. Files written by a
+ * previous run (including the ones the current run restarted from) are not
+ * removed, and must be cleaned up by the user, if needed. Restarting from a
+ * checkpoint whose binary files were removed simply uses the netcdf file.
+ */
+
+namespace scream
+{
+
+// The name of the fast restart file of a given rank, for a given model restart file
+std::string fast_restart_filename (const std::string& restart_filename, const int rank);
+
+// Write all the fields of the RESTART group of the input field managers
+// in this rank's fast restart file.
+void write_fast_restart (const std::string& restart_filename,
+                         const ekat::Comm& comm,
+                         const std::vector<std::shared_ptr<const FieldManager>>& field_mgrs);
+
+// Remove this rank's fast restart file for the given model restart file (if any)
+void remove_fast_restart (const std::string& restart_filename,
+                          const ekat::Comm& comm);
+
+// Read all the fields of the RESTART group of the input field managers from
+// this rank's fast restart file. The read is all-or-nothing: fields are
+// modified only if *all* ranks could find (and validate) all the data they need.
+// Returns true if fields were read, false otherwise.
+bool read_fast_restart (const std::string& restart_filename,
+                        const ekat::Comm& comm,
+                        const std::vector<std::shared_ptr<const FieldManager>>& field_mgrs);
+
+} // namespace scream
+
+#endif // SCREAM_FAST_RESTART_HPP
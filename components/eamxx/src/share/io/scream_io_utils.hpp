@@ -59,6 +59,40 @@ inline OutputAvgType str2avg (const std::string& s) {
   return OAT::Invalid;
 }
 
+// When an output stream remaps fields (horizontally) before writing them,
+// this determines when the remap is done, and on which grid we accumulate:
+//  - EveryStep: remap at every step, and accumulate on the io grid
+//  - OnChange: like EveryStep, but skip the remap if no src field changed since the last remap
+//  - AtWrite: accumulate on the src grid, and remap only at write steps (requires a linear remap)
+enum class OutputRemapPolicy {
+  EveryStep,
+  OnChange,
+  AtWrite,
+  Invalid
+};
+
+inline std::string e2str(const OutputRemapPolicy rp) {
+  using ORP = OutputRemapPolicy;
+  switch (rp) {
+    case ORP::EveryStep:  return "EVERY_STEP";
+    case ORP::OnChange:   return "ON_CHANGE";
+    case ORP::AtWrite:    return "AT_WRITE";
+    default:              return "INVALID";
+  }
+}
+
+inline OutputRemapPolicy str2remap_policy (const std::string& s) {
+  auto s_ci = ekat::upper_case(s);
+  using ORP = OutputRemapPolicy;
+  for (auto e : {ORP::EveryStep, ORP::OnChange, ORP::AtWrite}) {
+    if (s_ci==e2str(e)) {
+      return e;
+    }
+  }
+
+  return ORP::Invalid;
+}
+
 std::string find_filename_in_rpointer (
     const std::string& casename,
     const bool model_restart,
@@ -1,6 +1,7 @@
 #include "scream_output_manager.hpp"
 
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_fast_restart.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/scream_config.hpp"
@@ -64,6 +65,12 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   // Read input parameters and setup internal data
   set_params(params,field_mgrs);
 
+  if (m_is_model_restart_output and m_params.get("fast_restart",false)) {
+    for (const auto& it : field_mgrs) {
+      m_fast_restart_field_mgrs.push_back(it.second);
+    }
+  }
+
   // Here, store if PG2 fields will be present in output streams.
   // Will be useful if multiple grids are defined (see below).
   bool pg2_grid_in_io_streams = false;
@@ -452,6 +459,16 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   }
   stop_timer(timer_root+"::run_output_streams");
 
+  if (is_output_step and m_fast_restart_field_mgrs.size()>0) {
+    start_timer(timer_root+"::fast_restart");
+    write_fast_restart(m_output_file_specs.filename,m_io_comm,m_fast_restart_field_mgrs);
+    if (m_last_fast_restart_file!="" and m_last_fast_restart_file!=m_output_file_specs.filename) {
+      remove_fast_restart(m_last_fast_restart_file,m_io_comm);
+    }
+    m_last_fast_restart_file = m_output_file_specs.filename;
+    stop_timer(timer_root+"::fast_restart");
+  }
+
   if (is_write_step) {
     if (m_time_bnds.size()>0) {
       m_time_bnds[1] = timestamp.days_from(m_case_t0);
@@ -158,6 +158,13 @@ protected:
   // Whether this OutputManager handles a model restart file, or normal model output.
   bool m_is_model_restart_output;
 
+  // If not empty, model restart output also dumps the RESTART group of these
+  // field managers in per-rank binary files (see scream_fast_restart.hpp)
+  std::vector<std::shared_ptr<const fm_type>> m_fast_restart_field_mgrs;
+  // The model restart file of the last fast restart dump, whose binary files
+  // are removed once the next dump is done
+  std::string m_last_fast_restart_file;
+
   // Frequency of output and checkpointing
   // See scream_io_utils.hpp for details.
   IOControl m_output_control;
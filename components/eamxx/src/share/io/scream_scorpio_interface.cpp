@@ -31,17 +31,19 @@ public:
   strmap_t<PIOFile>                     files;
   strmap_t<std::shared_ptr<PIODecomp>>  decomps;
 
-  // In the above map, we would like to label decomps as dtype_dim1$N1_dim2$N2...
-  // where N$i is the global length of dim$i. However, it *may* happen that we use
-  // two different decompositions for the same global layout, which would clash
-  // the names. For this reason, we append at the end an increasing counter,
-  // which disambiguate between globally-equivalent partitions.
-  // When adding a new decomp, we check this map to see if another decomp
-  // already exists with the same global layout. If so, we first check to see
-  // if that decomp is equivalent to the new one *on all ranks*. If yes, we
-  // recycle it, otherwise we create a new PIO decomp.
-  // strmap_t<std::list<std::string>>    decomp_global_layout_to_decomp_name;
-  // strmap_t<int>                       decomp_global_layout_to_counter;
+  // In the above map, we label decomps as dtype-dim1<N1>_dim2<N2>..., where N$i is
+  // the global length of dim$i. However, it *may* happen that we use two different
+  // partitions of the same global layout (e.g., the same dim partitioned differently
+  // in two files), which would clash the names. For this reason, we also append the
+  // id of the partition of the decomposed dim. Partitions are stored here, for each
+  // dim name/length. When a dim decomp is set, we check if an equivalent partition
+  // (on *all* ranks) is already stored, and, if so, we recycle it (and all the PIO
+  // decomps built on top of it), otherwise we add a new one.
+  // Partitions are ref-counted via the shared_ptr: dims (in open files, or in the
+  // stored decomps) hold a copy, so once the use count drops to 1 nobody is using
+  // it, and we free it. The id is not recycled, so that it is never ambiguous.
+  using partition_ptr_t = std::shared_ptr<const std::vector<offset_t>>;
+  strmap_t<std::vector<partition_ptr_t>>  dim_partitions;
 
   int         pio_sysid        = -1;
   int         pio_type_default = -1;
@@ -104,6 +106,23 @@ void check_scorpio_noerr (const int err,
       " - calling PIOc function: " + pioc_func_name + "\n");
 }
 
+// Convert our IOType to the corresponding PIO iotype
+int pio_iotype (const IOType iotype, const int pio_type_default)
+{
+  int t;
+  switch (iotype) {
+    case DefaultIOType: t = pio_type_default;       break;
+    case NetCDF4c:      t = PIO_IOTYPE_NETCDF4C;    break;
+    case NetCDF4p:      t = PIO_IOTYPE_NETCDF4P;    break;
+    case Invalid:
+      EKAT_ERROR_MSG ("Error! Invalid/unsupported iotype: " + iotype2str(iotype) + "\n");
+    default:
+      // The other iotypes are passed to PIO as they have always been
+      t = static_cast<int>(iotype);
+  }
+  return t;
+}
+
 // Return name of a shared ptr to PIO entity (to use inside ekat::join)
 std::string get_entity_name (const std::shared_ptr<const PIOEntity>& e)
 {
@@ -288,6 +307,19 @@ PIOVar& get_var (const std::string& filename,
   return *f.vars.at(varname);
 }
 
+// Free the dims partitions that are no longer used by any dim
+void free_unused_partitions ()
+{
+  auto& s = ScorpioSession::instance();
+  for (auto& it : s.dim_partitions) {
+    for (auto& p : it.second) {
+      if (p.use_count()==1) {
+        p = nullptr;
+      }
+    }
+  }
+}
+
 } // namespace impl
 
 // ====================== Global IO operations ======================= // 
@@ -361,6 +393,7 @@ void finalize_subsystem ()
     check_scorpio_noerr(err,"finalize_subsystem","freedecomp");
   }
   s.decomps.clear();
+  s.dim_partitions.clear();
 
 #ifndef SCREAM_CIME_BUILD
   // Don't finalize in CIME builds, since the coupler will take care of it
@@ -395,9 +428,7 @@ void register_file (const std::string& filename,
   if (f.mode == Unset) {
     // First time we ask for this file. Call PIO open routine(s)
     int err;
-    int iotype_int = iotype==IOType::DefaultIOType
-                   ? s.pio_type_default
-                   : static_cast<int>(iotype);
+    int iotype_int = pio_iotype(iotype,s.pio_type_default);
     if (mode & Read) {
       auto write = mode & Write ? PIO_WRITE : PIO_NOWRITE;
       err = PIOc_openfile(s.pio_sysid,&f.ncid,&iotype_int,filename.c_str(),write);
@@ -415,6 +446,7 @@ void register_file (const std::string& filename,
 
     f.mode = mode;
     f.iotype = iotype;
+    f.pio_iotype = iotype_int;
     f.name = filename;
 
     if (mode & Read) {
@@ -524,6 +556,8 @@ void release_file  (const std::string& filename)
 
   auto& s = ScorpioSession::instance();
   s.files.erase(filename);
+
+  impl::free_unused_partitions();
 }
 
 void flush_file (const std::string &filename)
@@ -732,13 +766,14 @@ void set_var_decomp (PIOVar& var,
       " - varname   : " + var.name  + "\n"
       " - var decomp: " + var.decomp->name  + "\n");
 
-  // Create decomp name: dtype-dim1<len1>_dim2<len2>_..._dimk<lenN>
+  // Create decomp name: dtype-dim1<len1>_dim2<len2>_..._dimk<lenN>-p<partition_id>
   std::shared_ptr<const PIODim> decomp_dim;
   std::string decomp_tag = var.dtype + "-";
   for (auto d : var.dims) {
     decomp_tag += d->name + "<" + std::to_string(d->length) + ">_";
   }
   decomp_tag.pop_back(); // remove trailing underscore
+  decomp_tag += "-p" + std::to_string(var.dims[0]->partition_id);
 
   // Check if a decomp with this name already exists
   auto& s = ScorpioSession::instance();
@@ -863,7 +898,30 @@ void set_dim_decomp (const std::string& filename,
         " - offset  : " + std::to_string(o) + "\n");
   }
 
-  dim.offsets = std::make_shared<std::vector<offset_t>>(my_offsets);
+  // Check if this partition of the dim was already used (possibly in another file).
+  // Each rank looks for the first match, then we check all ranks agree.
+  auto& partitions = s.dim_partitions[dimname + "<" + std::to_string(dim.length) + ">"];
+  int pid = -1;
+  for (size_t i=0; i<partitions.size(); ++i) {
+    if (partitions[i]!=nullptr and *partitions[i]==my_offsets) {
+      pid = i;
+      break;
+    }
+  }
+  // Use a single reduction to get both min and max of pid across ranks
+  int min_pid[2] = {pid, -pid};
+  s.comm.all_reduce(min_pid,2,MPI_MIN);
+  if (min_pid[0]==-min_pid[1] and min_pid[0]>=0) {
+    dim.partition_id = min_pid[0];
+  } else {
+    // Since all ranks add a partition, the lists have the same length on all ranks
+    dim.partition_id = partitions.size();
+    partitions.push_back(std::make_shared<std::vector<offset_t>>(my_offsets));
+  }
+  dim.offsets = partitions[dim.partition_id];
+
+  // If we reset the decomp, the old partition may have no users left
+  impl::free_unused_partitions();
 
   // If vars were already defined, we need to process them,
   // and create the proper PIODecomp objects.
@@ -1012,6 +1070,34 @@ void define_var (const std::string& filename, const std::string& varname,
   define_var(filename,varname,"",dimensions,dtype,dtype,time_dependent);
 }
 
+bool set_var_compression (const std::string& filename, const std::string& varname,
+                          const int deflate_level, const bool shuffle)
+{
+  auto& f = impl::get_file(filename,"scorpio::set_var_compression");
+  auto& var = impl::get_var(filename,varname,"scorpio::set_var_compression");
+
+  EKAT_REQUIRE_MSG (not f.enddef,
+      "Error! Cannot set variable compression after enddef.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  EKAT_REQUIRE_MSG (deflate_level>=0 and deflate_level<=9,
+      "Error! Invalid deflate level (must be in [0,9]).\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n"
+      " - level   : " + std::to_string(deflate_level) + "\n");
+
+  if (f.pio_iotype!=PIO_IOTYPE_NETCDF4C and f.pio_iotype!=PIO_IOTYPE_NETCDF4P) {
+    // Only NetCDF4 files support filters
+    return false;
+  }
+
+  const int do_shuffle = shuffle ? 1 : 0;
+  const int do_deflate = deflate_level>0 ? 1 : 0;
+  int err = PIOc_def_var_deflate(f.ncid,var.ncid,do_shuffle,do_deflate,deflate_level);
+  check_scorpio_noerr(err,f.name,"variable",varname,"set_var_compression","def_var_deflate");
+  return true;
+}
+
 // This overload is not exposed externally. Also, filename is only
 // used to print it in case there are errors
 void change_var_dtype (PIOVar& var,
@@ -153,6 +153,14 @@ void define_var (const std::string& filename, const std::string& varname,
                  const std::string& dtype,
                  const bool time_dependent = false);
 
+// Enable lossless (deflate) compression of a variable. Must be called after define_var,
+// and before enddef. Compression is only available for NetCDF4 files (iotype netcdf4c
+// or netcdf4p); for other formats, this call is a no-op, and returns false.
+// Note: the shuffle filter rearranges bytes before compression; it usually improves
+//       the compression ratio of floating point data, at little cost.
+bool set_var_compression (const std::string& filename, const std::string& varname,
+                          const int deflate_level, const bool shuffle = true);
+
 // This is useful when reading data sets. E.g., if the pio file is storing
 // a var as float, but we need to read it as double, we need to call this.
 // NOTE: read_var/write_var automatically change the dtype if the input
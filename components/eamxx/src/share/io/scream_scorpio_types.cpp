@@ -34,6 +34,10 @@ IOType str2iotype(const std::string &str)
     return IOType::Adios;
   } else if(str == "hdf5") {
     return IOType::Hdf5;
+  } else if(str == "netcdf4c") {
+    return IOType::NetCDF4c;
+  } else if(str == "netcdf4p") {
+    return IOType::NetCDF4p;
   } else {
     return IOType::Invalid;
   }
@@ -48,6 +52,8 @@ std::string iotype2str(const IOType iotype)
     case IOType::PnetCDF:       s = "pnetcdf";  break;
     case IOType::Adios:         s = "adios";    break;
     case IOType::Hdf5:          s = "hdf5";     break;
+    case IOType::NetCDF4c:      s = "netcdf4c"; break;
+    case IOType::NetCDF4p:      s = "netcdf4p"; break;
     case IOType::Invalid:       s = "invalid";  break;
     default:
       EKAT_ERROR_MSG ("Unrecognized iotype.\n");
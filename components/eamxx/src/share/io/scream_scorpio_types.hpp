@@ -26,6 +26,8 @@ enum IOType {
   PnetCDF,
   Adios,
   Hdf5,
+  NetCDF4c,   // NetCDF4/HDF5 format, serial writes (supports compression)
+  NetCDF4p,   // NetCDF4/HDF5 format, parallel writes (supports compression)
   Invalid
 };
 
@@ -68,7 +70,12 @@ struct PIODim : public PIOFileEntity {
   // the owned offsets on this rank
   // NOTE: use a pointer, so we can detect if a decomposition already
   //       existed or not when we set one.
-  std::shared_ptr<std::vector<offset_t>> offsets;
+  std::shared_ptr<const std::vector<offset_t>> offsets;
+
+  // A globally consistent id of the partition stored in offsets. Two dims with
+  // the same name/length and the same partition_id are decomposed in the same
+  // way on all ranks, so they can share PIO decompositions (even across files).
+  int partition_id = -1;
 };
 
 // A decomposition
@@ -122,6 +129,7 @@ struct PIOFile : public PIOEntity {
   std::shared_ptr<PIODim> time_dim;
   FileMode mode;
   IOType   iotype;
+  int      pio_iotype = -1; // The actual PIO iotype (DefaultIOType is resolved)
   bool enddef = false;
 
   // We keep track of how many places are currently using this file, so that we
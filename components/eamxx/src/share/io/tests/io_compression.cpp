@@ -0,0 +1,150 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scorpio_input.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cmath>
+
+namespace scream {
+
+util::TimeStamp get_t0 () {
+  return util::TimeStamp({2023,2,17},{0,0,0});
+}
+
+std::shared_ptr<const GridsManager>
+get_gm (const ekat::Comm& comm)
+{
+  const int ngcols = 2*comm.size();
+  const int nlevs = 8;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  return gm;
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  // Use values spanning a few orders of magnitude, with full mantissa
+  std::mt19937_64 engine(seed);
+  std::uniform_real_distribution<Real> pdf(-1e3,1e3);
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+
+  auto fm = std::make_shared<FieldManager>(grid);
+  const auto units = ekat::units::Units::nondimensional();
+  for (const std::string& n : {"f_exact","f_nsd3","f_nsd5"}) {
+    FID fid(n,FL({COL,LEV},{nlcols,nlevs}),units,grid->name());
+    Field f(fid);
+    f.allocate_view();
+    randomize (f,engine,pdf);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+  }
+
+  return fm;
+}
+
+TEST_CASE ("io_compression") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+  auto t0 = get_t0();
+
+  const std::vector<std::string> fnames = {"f_exact","f_nsd3","f_nsd5"};
+
+  // Write output, with quantization and (if the iotype allows it) compression
+  auto fm = get_fm(grid,t0,seed);
+  {
+    ekat::ParameterList om_pl;
+    om_pl.set("MPI Ranks in Filename",true);
+    om_pl.set("filename_prefix",std::string("io_compression"));
+    om_pl.set("Field Names",fnames);
+    om_pl.set("Averaging Type", std::string("INSTANT"));
+    om_pl.set("Floating Point Precision",std::string("real"));
+    auto& ctrl_pl = om_pl.sublist("output_control");
+    ctrl_pl.set("frequency_units",std::string("nsteps"));
+    ctrl_pl.set("Frequency",1);
+    ctrl_pl.set("save_grid_data",false);
+    auto& c_pl = om_pl.sublist("compression");
+    c_pl.set("deflate_level",1);
+    c_pl.set("significant_digits",3);
+    c_pl.sublist("significant_digits_per_field").set("f_nsd5",5);
+    c_pl.sublist("significant_digits_per_field").set("f_exact",0);
+
+    OutputManager om;
+    om.setup(comm,om_pl,fm,gm,t0,t0,false);
+    om.finalize();
+  }
+
+  // The model fields must not be touched by the quantization
+  auto fm0 = get_fm(grid,t0,seed);
+  for (const auto& fn : fnames) {
+    REQUIRE (views_are_equal(fm->get_field(fn),fm0->get_field(fn)));
+  }
+
+  // Read back, and check the error is within the bit-rounding bounds
+  auto fm_read = get_fm(grid,t0,-seed-1);
+  const auto filename = "io_compression.INSTANT.nsteps_x1.np" + std::to_string(comm.size())
+                      + "." + t0.to_string() + ".nc";
+  ekat::ParameterList reader_pl;
+  reader_pl.set("Filename",filename);
+  reader_pl.set("Field Names",fnames);
+  AtmosphereInput reader(reader_pl,fm_read);
+  reader.read_variables(0);
+
+  auto check = [&](const std::string& fn, const int nsd) {
+    auto f0 = fm0->get_field(fn);
+    auto f  = fm_read->get_field(fn);
+    f.sync_to_host();
+    auto v0 = f0.get_view<const Real**,Host>();
+    auto v  = f.get_view<const Real**,Host>();
+
+    const int keepbits = static_cast<int>(std::ceil(nsd*std::log2(10.0)));
+    const Real tol = std::pow(Real(2),-keepbits-1);
+    for (int i=0; i<v.extent_int(0); ++i) {
+      for (int j=0; j<v.extent_int(1); ++j) {
+        if (nsd<=0) {
+          REQUIRE (v(i,j)==v0(i,j));
+        } else {
+          REQUIRE (std::abs(v(i,j)-v0(i,j))<=tol*std::abs(v0(i,j)));
+        }
+      }
+    }
+    if (nsd>0) {
+      REQUIRE (scorpio::get_attribute<int>(filename,fn,"quantization_nsb")==keepbits);
+    }
+  };
+
+  check("f_exact",0);
+  check("f_nsd3",3);
+  check("f_nsd5",5);
+
+  reader.finalize();
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
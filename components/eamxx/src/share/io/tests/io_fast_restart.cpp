@@ -0,0 +1,113 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_fast_restart.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+namespace scream {
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const std::list<std::string>& fnames,
+        const int seed)
+{
+  using namespace ekat::units;
+  using FR = FieldRequest;
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  // Use different layouts and pack sizes, to exercise padding
+  auto scalar_2d = grid->get_2d_scalar_layout();
+  auto scalar_3d = grid->get_3d_scalar_layout(true);
+  auto vector_3d = grid->get_3d_vector_layout(false,2);
+
+  const auto& gn = grid->name();
+  fm->registration_begins();
+  for (const auto& n : fnames) {
+    if (n=="f_2d") {
+      fm->register_field(FR(n,scalar_2d,m,gn,"RESTART"));
+    } else if (n=="f_3d") {
+      fm->register_field(FR(n,scalar_3d,kg,gn,"RESTART",SCREAM_PACK_SIZE));
+    } else {
+      fm->register_field(FR(n,vector_3d,m/s,gn,"RESTART",2));
+    }
+  }
+  fm->registration_ends();
+
+  std::mt19937_64 engine(seed);
+  std::uniform_real_distribution<Real> pdf(0,1);
+  for (const auto& n : fnames) {
+    randomize(fm->get_field(n),engine,pdf);
+  }
+  return fm;
+}
+
+TEST_CASE ("fast_restart") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto seed = get_random_test_seed(&comm);
+
+  const int nlcols = 3;
+  const int nlevs  = 13;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,nlcols*comm.size());
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  const std::string restart_file = "io_fast_restart.np" + std::to_string(comm.size()) + ".nc";
+  const std::list<std::string> fnames = {"f_2d","f_3d","f_vec"};
+
+  // Write fields. Change them on device only first, to make sure that
+  // the writer does not use stale host data.
+  auto fm_src = get_fm(grid,fnames,seed);
+  for (const auto& n : fnames) {
+    fm_src->get_field(n).scale(Real(2));
+  }
+  write_fast_restart(restart_file,comm,{fm_src});
+
+  SECTION ("matching_specs") {
+    auto fm_tgt = get_fm(grid,fnames,seed+1);
+    REQUIRE (read_fast_restart(restart_file,comm,{fm_tgt}));
+    for (const auto& n : fnames) {
+      REQUIRE (views_are_equal(fm_src->get_field(n),fm_tgt->get_field(n)));
+    }
+  }
+
+  SECTION ("subset_of_fields") {
+    // Fields in the file but not requested are simply skipped
+    auto fm_tgt = get_fm(grid,{"f_vec"},seed+1);
+    REQUIRE (read_fast_restart(restart_file,comm,{fm_tgt}));
+    REQUIRE (views_are_equal(fm_src->get_field("f_vec"),fm_tgt->get_field("f_vec")));
+  }
+
+  SECTION ("missing_field") {
+    // A field is not in the file: nothing should be read
+    auto fm_tgt = get_fm(grid,{"f_2d","f_missing"},seed+1);
+    auto f_2d = fm_tgt->get_field("f_2d").clone();
+    REQUIRE (not read_fast_restart(restart_file,comm,{fm_tgt}));
+    REQUIRE (views_are_equal(f_2d,fm_tgt->get_field("f_2d")));
+  }
+
+  SECTION ("missing_file") {
+    auto fm_tgt = get_fm(grid,fnames,seed+1);
+    REQUIRE (not read_fast_restart("not_a_file.nc",comm,{fm_tgt}));
+  }
+
+  SECTION ("removed_file") {
+    const std::string tmp_file = "io_fast_restart_rm.np" + std::to_string(comm.size()) + ".nc";
+    write_fast_restart(tmp_file,comm,{fm_src});
+    remove_fast_restart(tmp_file,comm);
+    auto fm_tgt = get_fm(grid,fnames,seed+1);
+    REQUIRE (not read_fast_restart(tmp_file,comm,{fm_tgt}));
+  }
+}
+
+} // namespace scream
@@ -0,0 +1,229 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+namespace scream {
+
+constexpr int freq = 4;
+constexpr int nlevs = 3;
+
+std::shared_ptr<const GridsManager>
+get_gm (const ekat::Comm& comm, const int ngcols)
+{
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  return gm;
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  // Use integers, so that the remapped sums are exact with dyadic weights,
+  // and all remap policies give bfb identical answers
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_int_distribution<int> pdf (0,100);
+    Real v = pdf(engine);
+    return v;
+  };
+
+  const int nlcols = grid->get_num_local_dofs();
+  std::vector<FL> layouts =
+  {
+    FL({COL    }, {nlcols       }),
+    FL({COL,LEV}, {nlcols, nlevs})
+  };
+
+  auto fm = std::make_shared<FieldManager>(grid);
+  const auto units = ekat::units::Units::nondimensional();
+  int count=0;
+  for (const auto& fl : layouts) {
+    FID fid("f_"+std::to_string(count),fl,units,grid->name());
+    Field f(fid);
+    f.allocate_view();
+    randomize (f,engine,my_pdf);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+    ++count;
+  }
+
+  return fm;
+}
+
+// Map every 2 consecutive src columns to one tgt column
+std::string create_map_file (const ekat::Comm& comm, const int ncols_src_l)
+{
+  const int ncols_src = ncols_src_l*comm.size();
+  const int ncols_tgt_l = ncols_src_l/2;
+  std::vector<int> col, row;
+  std::vector<Real> S;
+  for (int ii=0; ii<ncols_tgt_l; ++ii) {
+    const int src_col = 2*ii + ncols_src_l*comm.rank();
+    const int tgt_row = 1 + ii + ncols_tgt_l*comm.rank();
+    row.push_back(tgt_row);
+    row.push_back(tgt_row);
+    col.push_back(1+src_col);
+    col.push_back(1+src_col+1);
+    S.push_back(0.25);
+    S.push_back(0.75);
+  }
+
+  const std::string filename = "remap_policy_map_np" + std::to_string(comm.size()) + ".nc";
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+  scorpio::define_dim(filename,"n_a",ncols_src);
+  scorpio::define_dim(filename,"n_b",ncols_src/2);
+  scorpio::define_dim(filename,"n_s",ncols_src);
+  scorpio::define_var(filename,"col",{"n_s"},"int");
+  scorpio::define_var(filename,"row",{"n_s"},"int");
+  scorpio::define_var(filename,"S",  {"n_s"},"real");
+  scorpio::set_dim_decomp(filename,"n_s",comm.rank()*ncols_src_l,ncols_src_l);
+  scorpio::enddef(filename);
+  scorpio::write_var(filename,"row",row.data());
+  scorpio::write_var(filename,"col",col.data());
+  scorpio::write_var(filename,"S",  S.data());
+  scorpio::release_file(filename);
+
+  return filename;
+}
+
+TEST_CASE ("io_remap_policy") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  const int ncols_src_l = 8;
+  const int ncols_src = ncols_src_l*comm.size();
+  auto gm = get_gm(comm,ncols_src);
+  auto grid = gm->get_grid("Point Grid");
+  const auto map_file = create_map_file(comm,ncols_src_l);
+
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+  const int dt = 10;
+  const int nsteps = 2*freq;
+  const int seed = 7;
+
+  auto fm = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames;
+  for (auto it : *fm) {
+    fnames.push_back(it.second->name());
+  }
+
+  // Write the same fields with all remap policies
+  const std::vector<std::string> policies = {"every_step", "on_change", "at_write"};
+  std::vector<std::shared_ptr<OutputManager>> oms;
+  for (const auto& policy : policies) {
+    ekat::ParameterList om_pl;
+    om_pl.set("MPI Ranks in Filename",true);
+    om_pl.set("filename_prefix","io_remap_policy_"+policy);
+    om_pl.set("Field Names",fnames);
+    om_pl.set("Averaging Type",std::string("Average"));
+    om_pl.set("Floating Point Precision",std::string("real"));
+    om_pl.set("horiz_remap_file",map_file);
+    om_pl.set("remap_policy",policy);
+    auto& ctrl_pl = om_pl.sublist("output_control");
+    ctrl_pl.set("frequency_units",std::string("nsteps"));
+    ctrl_pl.set("Frequency",freq);
+    ctrl_pl.set("save_grid_data",false);
+
+    oms.push_back(std::make_shared<OutputManager>());
+    oms.back()->setup(comm,om_pl,fm,gm,t0,t0,false);
+  }
+
+  // at_write requires Average output
+  {
+    ekat::ParameterList om_pl;
+    om_pl.set("filename_prefix",std::string("io_remap_policy_bad"));
+    om_pl.set("Field Names",fnames);
+    om_pl.set("Averaging Type",std::string("Max"));
+    om_pl.set("horiz_remap_file",map_file);
+    om_pl.set("remap_policy",std::string("at_write"));
+    auto& ctrl_pl = om_pl.sublist("output_control");
+    ctrl_pl.set("frequency_units",std::string("nsteps"));
+    ctrl_pl.set("Frequency",freq);
+    OutputManager om;
+    REQUIRE_THROWS (om.setup(comm,om_pl,fm,gm,t0,t0,false));
+  }
+
+  auto t = t0;
+  for (int n=0; n<nsteps; ++n) {
+    for (auto& om : oms) {
+      om->init_timestep(t,dt);
+    }
+    t += dt;
+
+    // Only change the fields on odd steps, so that on_change has something to skip
+    if (n % 2 == 1) {
+      for (const auto& name : fnames) {
+        auto f = fm->get_field(name);
+        auto data = f.get_internal_view_data<Real,Host>();
+        const auto nscalars = f.get_header().get_alloc_properties().get_num_scalars();
+        for (int i=0; i<nscalars; ++i) {
+          data[i] += n;
+        }
+        f.sync_to_dev();
+        f.get_header().get_tracking().update_time_stamp(t);
+      }
+    }
+
+    for (auto& om : oms) {
+      om->run(t);
+    }
+  }
+  for (auto& om : oms) {
+    om->finalize();
+  }
+
+  // Read back all files, and check they are identical
+  auto gm_tgt = get_gm(comm,ncols_src/2);
+  auto grid_tgt = gm_tgt->get_grid("Point Grid");
+  std::vector<std::shared_ptr<FieldManager>> fms;
+  std::vector<std::shared_ptr<AtmosphereInput>> readers;
+  for (const auto& policy : policies) {
+    fms.push_back(get_fm(grid_tgt,t0,seed+1));
+    ekat::ParameterList reader_pl;
+    const auto filename = "io_remap_policy_" + policy
+                        + ".AVERAGE.nsteps_x" + std::to_string(freq)
+                        + ".np" + std::to_string(comm.size())
+                        + "." + t0.to_string() + ".nc";
+    reader_pl.set("Filename",filename);
+    reader_pl.set("Field Names",fnames);
+    readers.push_back(std::make_shared<AtmosphereInput>(reader_pl,fms.back()));
+  }
+  for (int isnap=0; isnap<nsteps/freq; ++isnap) {
+    for (auto& reader : readers) {
+      reader->read_variables(isnap);
+    }
+    for (size_t i=1; i<fms.size(); ++i) {
+      for (const auto& fn : fnames) {
+        REQUIRE (views_are_equal(fms[0]->get_field(fn),fms[i]->get_field(fn)));
+      }
+    }
+  }
+  for (auto& reader : readers) {
+    reader->finalize();
+  }
+
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
@@ -210,4 +210,73 @@ TEST_CASE ("write_and_read") {
   finalize_subsystem ();
 }
 
+TEST_CASE ("decomps_reuse") {
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  init_subsystem (comm);
+
+  const int ldim = 3;
+  const int gdim = ldim*comm.size();
+
+  // Two different partitions of the same dimension: contiguous and strided
+  std::vector<offset_t> contiguous, strided;
+  for (int i=0; i<ldim; ++i) {
+    contiguous.push_back(ldim*comm.rank() + i);
+    strided.push_back(comm.rank() + i*comm.size());
+  }
+
+  // Write two files with the same dim/var, but with different partitions.
+  // Each entry stores its global offset, so we can check reads regardless
+  // of the partition used.
+  auto write = [&](const std::string& filename, const std::vector<offset_t>& offsets) {
+    register_file (filename,Write);
+    define_dim (filename,"dim",gdim);
+    set_dim_decomp (filename,"dim",offsets);
+    define_var (filename,"var",{"dim"},"double",false);
+    enddef (filename);
+
+    std::vector<double> data (offsets.begin(),offsets.end());
+    write_var (filename,"var",data.data());
+    release_file (filename);
+  };
+
+  auto read = [&](const std::string& filename, const std::vector<offset_t>& offsets) {
+    register_file (filename,Read);
+    set_dim_decomp (filename,"dim",offsets);
+    std::vector<double> data (ldim), tgt (offsets.begin(),offsets.end());
+    read_var (filename,"var",data.data());
+    release_file (filename);
+    return data==tgt;
+  };
+
+  const std::string suffix = "_np" + std::to_string(comm.size()) + ".nc";
+  write ("scorpio_decomps_contiguous"+suffix,contiguous);
+  write ("scorpio_decomps_strided"+suffix,strided);
+
+  // Both decomps are now cached, and must not be confused with each other
+  REQUIRE (read("scorpio_decomps_contiguous"+suffix,contiguous));
+  REQUIRE (read("scorpio_decomps_contiguous"+suffix,strided));
+  REQUIRE (read("scorpio_decomps_strided"+suffix,contiguous));
+  REQUIRE (read("scorpio_decomps_strided"+suffix,strided));
+
+  // Resetting the decomp releases the old partition. A partition set afterwards
+  // must not be confused with the released one.
+  {
+    const std::string filename = "scorpio_decomps_contiguous"+suffix;
+    register_file (filename,Read);
+    std::vector<double> data (ldim);
+    set_dim_decomp (filename,"dim",strided);
+    read_var (filename,"var",data.data());
+    REQUIRE (data==std::vector<double>(strided.begin(),strided.end()));
+
+    set_dim_decomp (filename,"dim",contiguous,true);
+    read_var (filename,"var",data.data());
+    REQUIRE (data==std::vector<double>(contiguous.begin(),contiguous.end()));
+    release_file (filename);
+  }
+  REQUIRE (read("scorpio_decomps_strided"+suffix,strided));
+
+  finalize_subsystem ();
+}
+
 } // namespace scream
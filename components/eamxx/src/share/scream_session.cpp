@@ -1,5 +1,7 @@
 #include "scream_session.hpp"
 #include "scream_config.hpp"
+#include "share/util/scream_node_shared_tables.hpp"
+#include "share/util/eamxx_column_cost.hpp"
 
 #include "ekat/ekat_assert.hpp"
 #include "ekat/ekat_session.hpp"
@@ -43,6 +45,9 @@ void initialize_scream_session (int argc, char **argv, bool print_config) {
 
 extern "C" {
 void finalize_scream_session () {
+  // Shared tables hold MPI windows and kokkos views, so release them first
+  free_node_shared_tables();
+  free_column_costs();
   ekat::finalize_ekat_session();
 }
 } // extern "C"
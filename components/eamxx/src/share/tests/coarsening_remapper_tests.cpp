@@ -64,6 +64,25 @@ public:
   view_1d<int>::HostMirror get_send_pid_lids_start () const {
     return cmvdc(m_send_pid_lids_start);
   }
+
+  // Used to check the fused/ELL mat-vec against the field-by-field CRS one.
+  // Note: must be called before registration_ends().
+  void disable_fused_mat_vec () {
+    m_allow_fused = false;
+  }
+  void disable_ell () {
+    m_nnz_per_row = -1;
+  }
+  int get_nnz_per_row () const {
+    return m_nnz_per_row;
+  }
+
+protected:
+  bool can_fuse_mat_vec (const int ifield) const override {
+    return m_allow_fused and CoarseningRemapper::can_fuse_mat_vec(ifield);
+  }
+
+  bool m_allow_fused = true;
 };
 
 void root_print (const std::string& msg, const ekat::Comm& comm) {
@@ -262,6 +281,65 @@ void create_remap_file(const std::string& filename, const int ngdofs_tgt)
   scorpio::release_file(filename);
 }
 
+// Helper function to create a random remap file. If nnz_per_row>0, all rows
+// have that many nonzeros (ELL format), otherwise the number of nonzeros is random.
+template<typename Engine>
+void create_random_remap_file(const std::string& filename,
+                              const int ngdofs_src, const int ngdofs_tgt,
+                              const int nnz_per_row,
+                              const ekat::Comm& comm, Engine& engine)
+{
+  // Generate the triplets on root, since each rank has a different rng seed
+  std::vector<int> row_nnz(ngdofs_tgt,nnz_per_row);
+  if (comm.am_i_root() and nnz_per_row<=0) {
+    std::uniform_int_distribution<int> nnz_pdf (1,4);
+    for (auto& n : row_nnz) {
+      n = nnz_pdf(engine);
+    }
+  }
+  comm.broadcast(row_nnz.data(),ngdofs_tgt,comm.root_rank());
+  const int nnz = std::accumulate(row_nnz.begin(),row_nnz.end(),0);
+
+  // As in create_field, use weights of the form 2^-n, so that the products are
+  // exact, and the result does not depend on the order of the sums.
+  std::vector<int> col(nnz), row(nnz);
+  std::vector<double> S(nnz);
+  if (comm.am_i_root()) {
+    std::uniform_int_distribution<int> exp_pdf (0,4);
+    std::vector<int> src_gids(ngdofs_src);
+    std::iota(src_gids.begin(),src_gids.end(),0);
+    for (int i=0,k=0; i<ngdofs_tgt; ++i) {
+      std::shuffle(src_gids.begin(),src_gids.end(),engine);
+      for (int j=0; j<row_nnz[i]; ++j,++k) {
+        row[k] = i;
+        col[k] = src_gids[j];
+        S[k] = std::pow(2.0,-exp_pdf(engine));
+      }
+    }
+  }
+  comm.broadcast(row.data(),nnz,comm.root_rank());
+  comm.broadcast(col.data(),nnz,comm.root_rank());
+  comm.broadcast(S.data(),nnz,comm.root_rank());
+
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+
+  scorpio::define_dim(filename,"n_a", ngdofs_src);
+  scorpio::define_dim(filename,"n_b", ngdofs_tgt);
+  scorpio::define_dim(filename,"n_s", nnz);
+
+  scorpio::define_var(filename,"col",{"n_s"},"int");
+  scorpio::define_var(filename,"row",{"n_s"},"int");
+  scorpio::define_var(filename,"S"  ,{"n_s"},"double");
+
+  scorpio::enddef(filename);
+
+  scorpio::write_var(filename,"row",row.data());
+  scorpio::write_var(filename,"col",col.data());
+  scorpio::write_var(filename,"S",    S.data());
+
+  scorpio::release_file(filename);
+}
+
 TEST_CASE("coarsening_remap")
 {
   auto& catch_capture = Catch::getResultCapture();
@@ -502,4 +580,80 @@ TEST_CASE("coarsening_remap")
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE("coarsening_remap_fused")
+{
+  // Check that the fused mat-vec kernel (with both ELL and CRS sparse matrix)
+  // gives the same results as the field-by-field CRS mat-vec, on random maps.
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  root_print ("\n +---------------------------------------+\n",comm);
+  root_print (" |   Testing fused coarsening mat-vec    |\n",comm);
+  root_print (" +---------------------------------------+\n\n",comm);
+
+  scorpio::init_subsystem(comm);
+  auto engine = setup_random_test (&comm);
+
+  const int ngdofs_tgt = 3*comm.size();
+  const int ngdofs_src = 4*comm.size() + 1;
+  auto src_grid = build_src_grid(comm, ngdofs_src, engine);
+
+  const std::vector<LayoutType> layouts = {
+    LayoutType::Scalar2D, LayoutType::Vector2D, LayoutType::Tensor2D,
+    LayoutType::Scalar3D, LayoutType::Vector3D, LayoutType::Tensor3D
+  };
+
+  // Fixed nnz per row (ELL format), then random nnz per row (CRS format)
+  for (int nnz_per_row : {3, -1}) {
+    const std::string fmt = nnz_per_row>0 ? "ell" : "crs";
+    root_print (" -> Map format: " + fmt + "\n",comm);
+
+    std::string filename = "cr_fused_tests_map_" + fmt + "." + std::to_string(comm.size()) + ".nc";
+    create_random_remap_file(filename, ngdofs_src, ngdofs_tgt, nnz_per_row, comm, engine);
+
+    // The reference remapper does all fields one at a time, with the CRS kernel
+    auto remap_ref = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+    auto remap_ell = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+    auto remap_crs = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+    remap_ref->disable_fused_mat_vec();
+    remap_crs->disable_ell();
+    if (nnz_per_row>0 and comm.size()==1) {
+      REQUIRE (remap_ell->get_nnz_per_row()==nnz_per_row);
+    }
+    std::vector<std::shared_ptr<CoarseningRemapperTester>> remaps = {remap_ref,remap_ell,remap_crs};
+
+    // Use the same src fields for all remappers
+    std::vector<Field> src_f;
+    std::vector<std::vector<Field>> tgt_f(remaps.size());
+    for (auto lt : layouts) {
+      for (bool midpoints : {true,false}) {
+        const std::string name = e2str(lt) + (midpoints ? "_m" : "_i");
+        src_f.push_back(create_field(name,lt,*src_grid,midpoints,engine));
+        for (size_t ir=0; ir<remaps.size(); ++ir) {
+          tgt_f[ir].push_back(create_field(name,lt,*remaps[ir]->get_coarse_grid(),midpoints));
+        }
+      }
+    }
+
+    for (size_t ir=0; ir<remaps.size(); ++ir) {
+      auto& r = remaps[ir];
+      r->registration_begins();
+      for (size_t i=0; i<src_f.size(); ++i) {
+        r->register_field(src_f[i],tgt_f[ir][i]);
+      }
+      r->registration_ends();
+      r->remap(true);
+    }
+
+    for (size_t i=0; i<src_f.size(); ++i) {
+      root_print ("   -> Checking field " + src_f[i].name() + "\n",comm);
+      REQUIRE (views_are_equal(tgt_f[0][i],tgt_f[1][i],&comm));
+      REQUIRE (views_are_equal(tgt_f[0][i],tgt_f[2][i],&comm));
+    }
+  }
+
+  // Clean up scorpio stuff
+  scorpio::finalize_subsystem();
+}
+
 } // namespace scream
@@ -624,6 +624,37 @@ TEST_CASE("tracers_bundle", "") {
   REQUIRE (qv_ptr->equivalent(qv));
   REQUIRE (qc_ptr->equivalent(qc));
   REQUIRE (qr_ptr->equivalent(qr));
+
+  // The bundled view aliases Q
+  auto Qv = group.get_bundled_view<Real***>();
+  REQUIRE (Qv.data()==Q.get_internal_view_data<Real>());
+
+  // Pack in both layouts, and check values
+  using BL = FieldGroup::BundleLayout;
+  FieldGroup::KT::view_3d<Real> lev_fastest, fld_fastest;
+  group.pack(lev_fastest,BL::LevFastest);
+  group.pack(fld_fastest,BL::FieldFastest);
+  REQUIRE (fld_fastest.extent_int(1)==nlevs);
+  REQUIRE (fld_fastest.extent_int(2)==3);
+  auto lev_fastest_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),lev_fastest);
+  auto fld_fastest_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),fld_fastest);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      REQUIRE (lev_fastest_h(icol,idx_v,ilev)==qvh(icol,ilev));
+      REQUIRE (fld_fastest_h(icol,ilev,idx_c)==qch(icol,ilev));
+      REQUIRE (fld_fastest_h(icol,ilev,idx_r)==qrh(icol,ilev));
+    }
+  }
+
+  // Modify the packed view, unpack, and check the q's
+  Kokkos::deep_copy(fld_fastest,2.0);
+  group.unpack(fld_fastest,BL::FieldFastest);
+  qv.sync_to_host();
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      REQUIRE (qvh(icol,ilev)==2.0);
+    }
+  }
 }
 
 TEST_CASE("multiple_bundles") {
@@ -4,6 +4,7 @@
 #include "share/grid/se_grid.hpp"
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/grid_utils.hpp"
+#include "share/grid/gid_directory.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/scream_types.hpp"
 
@@ -218,4 +219,64 @@ TEST_CASE ("get_remote_pids_and_lids") {
   }
 }
 
+TEST_CASE ("gid_directory") {
+  using gid_type = AbstractGrid::gid_type;
+  using gid_view_h = AbstractGrid::gid_view_h;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const int nranks = comm.size();
+  const int num_local_dofs = 10;
+  const int num_global_dofs = num_local_dofs*nranks;
+
+  // Each rank holds its block of gids, plus the first gid of the next rank's block
+  // (except the last rank), so that some gids are held by two ranks.
+  const int offset = num_local_dofs*comm.rank();
+  std::vector<gid_type> my_gids (num_local_dofs);
+  std::iota(my_gids.begin(),my_gids.end(),offset);
+  const bool has_overlap = comm.rank()<nranks-1;
+  if (has_overlap) {
+    my_gids.push_back(offset+num_local_dofs);
+  }
+
+  GidDirectory dir_ov (comm,gid_view_h(my_gids.data(),my_gids.size()));
+  REQUIRE (dir_ov.all_unique()==(nranks==1));
+
+  // Query all gids, plus one that nobody holds
+  std::vector<gid_type> query (num_global_dofs+1);
+  std::iota(query.begin(),query.end(),0);
+  std::vector<int> num_holders, pids, lids;
+  dir_ov.lookup(gid_view_h(query.data(),query.size()),num_holders,pids,lids);
+  for (int i=0; i<num_global_dofs; ++i) {
+    const int owner = i / num_local_dofs;
+    const bool shared = i%num_local_dofs==0 && owner>0;
+    REQUIRE (num_holders[i]==(shared ? 2 : 1));
+    REQUIRE (pids[i]==(shared ? owner-1 : owner));
+    REQUIRE (lids[i]==(shared ? num_local_dofs : i%num_local_dofs));
+  }
+  REQUIRE (num_holders[num_global_dofs]==0);
+  REQUIRE (pids[num_global_dofs]==-1);
+  REQUIRE (lids[num_global_dofs]==-1);
+
+  // Removing the overlap makes all gids unique
+  GidDirectory dir (comm,gid_view_h(my_gids.data(),num_local_dofs));
+  REQUIRE (dir.all_unique());
+
+  // The grid queries are built on top of the directory
+  auto grid = std::make_shared<PointGrid>("grid",my_gids.size(),0,comm);
+  auto dofs = grid->get_dofs_gids();
+  auto dofs_h = dofs.get_view<gid_type*,Host>();
+  std::copy(my_gids.begin(),my_gids.end(),dofs_h.data());
+  dofs.sync_to_dev();
+  REQUIRE (grid->is_unique()==(nranks==1));
+  const auto unique_gids = grid->get_unique_gids();
+  int num_unique_gids = unique_gids.size();
+  comm.all_reduce(&num_unique_gids,1,MPI_SUM);
+  REQUIRE (num_unique_gids==num_global_dofs);
+  if (nranks>1) {
+    // All ranks hold at least one shared gid
+    REQUIRE_THROWS (grid->get_owners(my_gids));
+  }
+}
+
 } // anonymous namespace
@@ -5,7 +5,17 @@
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_node_shared_tables.hpp"
+#include "share/util/eamxx_column_cost.hpp"
+#include "share/util/scream_tridiag.hpp"
 #include "share/scream_config.hpp"
+#include "share/scream_types.hpp"
+
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+#include <ekat/kokkos/ekat_subview_utils.hpp>
+
+#include <cmath>
+#include <limits>
 
 TEST_CASE("contiguous_superset") {
   using namespace scream;
@@ -250,3 +260,175 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("node_shared_tables") {
+  using namespace scream;
+  using KT = KokkosTypes<DefaultDevice>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  using table_2d_t = KT::view_2d<const Real>;
+  using table_1d_t = KT::view<const int[5]>;
+
+  const int n0 = 3, n1 = 4;
+  int nfills = 0;
+  auto fill_2d = [&](const auto& t) {
+    ++nfills;
+    for (int i=0; i<n0; ++i) {
+      for (int j=0; j<n1; ++j) {
+        t(i,j) = i*n1+j;
+      }
+    }
+  };
+  auto t2d = get_node_shared_table<table_2d_t>("t2d",comm,fill_2d,n0,n1);
+  auto t1d = get_node_shared_table<table_1d_t>("t1d",comm,
+      [&](const auto& t) {
+        ++nfills;
+        for (int i=0; i<5; ++i) {
+          t(i) = -i;
+        }
+      });
+  REQUIRE (t2d.extent_int(0)==n0);
+  REQUIRE (t2d.extent_int(1)==n1);
+
+  // Only one rank per node fills the tables
+  int tot_fills;
+  comm.all_reduce(&nfills,&tot_fills,1,MPI_SUM);
+  REQUIRE (tot_fills<=2*comm.size());
+  REQUIRE ((nfills==0 or nfills==2));
+
+  auto t2d_h = Kokkos::create_mirror_view(t2d);
+  auto t1d_h = Kokkos::create_mirror_view(t1d);
+  Kokkos::deep_copy(t2d_h,t2d);
+  Kokkos::deep_copy(t1d_h,t1d);
+  for (int i=0; i<n0; ++i) {
+    for (int j=0; j<n1; ++j) {
+      REQUIRE (t2d_h(i,j)==i*n1+j);
+    }
+  }
+  for (int i=0; i<5; ++i) {
+    REQUIRE (t1d_h(i)==-i);
+  }
+
+  // Requesting the same table again does not fill it again, and returns the same data
+  auto t2d_again = get_node_shared_table<table_2d_t>("t2d",comm,fill_2d,n0,n1);
+  REQUIRE (t2d_again.data()==t2d.data());
+  REQUIRE ((nfills==0 or nfills==2));
+
+  // Requesting a table with the same name but a different size is an error
+  REQUIRE_THROWS (get_node_shared_table<table_2d_t>("t2d",comm,fill_2d,n0+1,n1));
+
+  free_node_shared_tables();
+}
+
+TEST_CASE ("column_cost") {
+  using namespace scream;
+
+  const int ncols = 6;
+  const int nelems = 3;
+  const std::string grid = "my_grid";
+
+  REQUIRE (not column_cost_enabled(grid));
+  REQUIRE_THROWS (get_column_cost(grid));
+
+  enable_column_cost(grid,ncols);
+  REQUIRE (column_cost_enabled(grid));
+  // Enabling again is fine, as long as ncols is the same
+  enable_column_cost(grid,ncols);
+  REQUIRE_THROWS (enable_column_cost(grid,ncols+1));
+
+  // Two "processes" report cost on odd columns, over two steps
+  auto cost = get_column_cost(grid);
+  const int nsteps = 2;
+  for (int n=0; n<nsteps; ++n) {
+    for (int p=0; p<2; ++p) {
+      Kokkos::parallel_for(ncols, KOKKOS_LAMBDA (const int icol) {
+        cost(icol) += icol % 2;
+      });
+    }
+  }
+  Kokkos::fence();
+
+  // Cols (0,1)->elem 2, (2,3)->elem 0, (4,5)->elem 1
+  std::vector<int> col2elem = {2,2,0,0,1,1};
+  auto w = compute_elem_weights(cost,nsteps,col2elem,nelems);
+  REQUIRE (static_cast<int>(w.size())==nelems);
+  for (int ie=0; ie<nelems; ++ie) {
+    // Base cost of 1 per col, plus 2 per odd column
+    REQUIRE (w[ie]==4);
+  }
+
+  // No steps means only base cost
+  w = compute_elem_weights(cost,0,col2elem,nelems);
+  for (int ie=0; ie<nelems; ++ie) {
+    REQUIRE (w[ie]==2);
+  }
+
+  col2elem[0] = nelems;
+  REQUIRE_THROWS (compute_elem_weights(cost,nsteps,col2elem,nelems));
+
+  free_column_costs();
+  REQUIRE (not column_cost_enabled(grid));
+}
+
+TEST_CASE ("tridiag_batched") {
+  using namespace scream;
+  using KT = KokkosTypes<DefaultDevice>;
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+
+  const int ncols = 3;
+  const int nrhs = 5;
+  const int nrow = 20;
+
+  // Diagonally dominant matrices, different in each column, and X(icol,j,i) = x_true
+  KT::view_2d<Real> dl("dl",ncols,nrow), d("d",ncols,nrow), du("du",ncols,nrow);
+  KT::view_3d<Real> X("X",ncols,nrhs,nrow);
+  auto dl_h = Kokkos::create_mirror_view(dl);
+  auto d_h  = Kokkos::create_mirror_view(d);
+  auto du_h = Kokkos::create_mirror_view(du);
+  auto X_h  = Kokkos::create_mirror_view(X);
+  auto x_true = [](const int icol, const int j, const int i) {
+    return std::sin(icol + 0.1*j + 0.01*i);
+  };
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int i=0; i<nrow; ++i) {
+      dl_h(icol,i) = i>0      ? -0.5 - 0.01*icol : 0;
+      du_h(icol,i) = i<nrow-1 ? -0.3 - 0.02*i    : 0;
+      d_h(icol,i)  = 2 + 0.1*icol;
+    }
+    // Set the rhs to A*x_true
+    for (int j=0; j<nrhs; ++j) {
+      for (int i=0; i<nrow; ++i) {
+        Real b = d_h(icol,i)*x_true(icol,j,i);
+        if (i>0)      b += dl_h(icol,i)*x_true(icol,j,i-1);
+        if (i<nrow-1) b += du_h(icol,i)*x_true(icol,j,i+1);
+        X_h(icol,j,i) = b;
+      }
+    }
+  }
+  Kokkos::deep_copy(dl,dl_h);
+  Kokkos::deep_copy(d,d_h);
+  Kokkos::deep_copy(du,du_h);
+  Kokkos::deep_copy(X,X_h);
+
+  auto policy = ESU::get_default_team_policy(ncols,nrhs);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+    const int icol = team.league_rank();
+    auto dl_c = ekat::subview(dl,icol);
+    auto d_c  = ekat::subview(d,icol);
+    auto du_c = ekat::subview(du,icol);
+    tridiag::factorize(team,dl_c,d_c,du_c);
+    team.team_barrier();
+    tridiag::solve_batched(team,dl_c,d_c,du_c,ekat::subview(X,icol));
+  });
+  Kokkos::deep_copy(X_h,X);
+
+  const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int j=0; j<nrhs; ++j) {
+      for (int i=0; i<nrow; ++i) {
+        REQUIRE (X_h(icol,j,i)==Approx(x_true(icol,j,i)).margin(tol));
+      }
+    }
+  }
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include "share/util/eamxx_vertical_interp_plan.hpp"
+#include "share/field/field.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+
+namespace {
+
+TEST_CASE("vertical_interp_plan") {
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+  using namespace ekat::units;
+
+  constexpr int ncols = 4;
+  constexpr int ncmps = 3;
+  constexpr int nlevs_src = 10;
+  constexpr int nlevs_tgt = 7;
+  constexpr Real mask_val = -999;
+
+  auto create_field = [](const std::string& name,
+                         const std::vector<FieldTag>& tags,
+                         const std::vector<int>& dims) {
+    Field f(FieldIdentifier(name,FieldLayout(tags,dims),Pa,"some_grid"));
+    f.allocate_view();
+    return f;
+  };
+
+  // Src pressure: p(icol,k) = 1000*(k+1) + icol. Tgt pressure: from 500 to 11500,
+  // so that the first and last tgt levels are out of bounds for all columns
+  auto p_src = create_field("p_src",{COL,LEV},{ncols,nlevs_src});
+  auto p_tgt = create_field("p_tgt",{LEV},{nlevs_tgt});
+  auto p_src_h = p_src.get_view<Real**,Host>();
+  auto p_tgt_h = p_tgt.get_view<Real*,Host>();
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int k=0; k<nlevs_src; ++k) {
+      p_src_h(icol,k) = 1000*(k+1) + icol;
+    }
+  }
+  for (int k=0; k<nlevs_tgt; ++k) {
+    p_tgt_h(k) = 500 + k*11000.0/(nlevs_tgt-1);
+  }
+  p_src.sync_to_dev();
+  p_tgt.sync_to_dev();
+
+  // Fields are linear in p, so interpolation/extrapolation is exact
+  auto data = [](const Real p, const int icol, const int icmp) {
+    return 2*p + 10*icol + 100*icmp;
+  };
+
+  auto s_src = create_field("s_src",{COL,LEV},{ncols,nlevs_src});
+  auto v_src = create_field("v_src",{COL,CMP,LEV},{ncols,ncmps,nlevs_src});
+  auto s_tgt = create_field("s_tgt",{COL,LEV},{ncols,nlevs_tgt});
+  auto v_tgt = create_field("v_tgt",{COL,CMP,LEV},{ncols,ncmps,nlevs_tgt});
+  auto mask  = create_field("mask", {COL,LEV},{ncols,nlevs_tgt});
+
+  // Use a subfield of v_src as src too
+  auto v1_src = v_src.subfield(1,1);
+  auto v1_tgt = create_field("v1_tgt",{COL,LEV},{ncols,nlevs_tgt});
+
+  auto s_src_h = s_src.get_view<Real**,Host>();
+  auto v_src_h = v_src.get_view<Real***,Host>();
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int k=0; k<nlevs_src; ++k) {
+      s_src_h(icol,k) = data(p_src_h(icol,k),icol,0);
+      for (int icmp=0; icmp<ncmps; ++icmp) {
+        v_src_h(icol,icmp,k) = data(p_src_h(icol,k),icol,icmp);
+      }
+    }
+  }
+  s_src.sync_to_dev();
+  v_src.sync_to_dev();
+
+  VerticalInterpPlan plan(p_src,p_tgt);
+  plan.add_field(s_src,s_tgt);
+  plan.add_field(v_src,v_tgt,mask_val);
+  plan.add_field(v1_src,v1_tgt);
+  plan.add_mask(mask);
+  REQUIRE (plan.num_fields()==4);
+
+  // Incompatible layouts
+  auto bad = create_field("bad",{COL,LEV},{ncols,nlevs_src+1});
+  REQUIRE_THROWS (plan.add_field(bad,s_tgt));
+  REQUIRE_THROWS (plan.add_field(s_src,bad));
+
+  plan.setup();
+  plan.apply();
+
+  s_tgt.sync_to_host();
+  v_tgt.sync_to_host();
+  v1_tgt.sync_to_host();
+  mask.sync_to_host();
+  auto s_tgt_h  = s_tgt.get_view<const Real**,Host>();
+  auto v_tgt_h  = v_tgt.get_view<const Real***,Host>();
+  auto v1_tgt_h = v1_tgt.get_view<const Real**,Host>();
+  auto mask_h   = mask.get_view<const Real**,Host>();
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int k=0; k<nlevs_tgt; ++k) {
+      const Real p = p_tgt_h(k);
+      const bool oob = p<p_src_h(icol,0) or p>p_src_h(icol,nlevs_src-1);
+      REQUIRE (mask_h(icol,k)==(oob ? 0 : 1));
+
+      // Not masked, so extrapolated
+      REQUIRE (s_tgt_h(icol,k)==Approx(data(p,icol,0)));
+      REQUIRE (v1_tgt_h(icol,k)==Approx(data(p,icol,1)));
+      for (int icmp=0; icmp<ncmps; ++icmp) {
+        if (oob) {
+          REQUIRE (v_tgt_h(icol,icmp,k)==mask_val);
+        } else {
+          REQUIRE (v_tgt_h(icol,icmp,k)==Approx(data(p,icol,icmp)));
+        }
+      }
+    }
+  }
+}
+
+} // anonymous namespace
@@ -0,0 +1,81 @@
+#include "share/util/eamxx_column_cost.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <map>
+
+namespace scream {
+
+namespace {
+
+std::map<std::string,column_cost_view_t>& column_costs () {
+  static std::map<std::string,column_cost_view_t> costs;
+  return costs;
+}
+
+} // anonymous namespace
+
+void enable_column_cost (const std::string& grid_name, const int ncols)
+{
+  auto& costs = column_costs();
+  auto it = costs.find(grid_name);
+  if (it!=costs.end()) {
+    EKAT_REQUIRE_MSG (it->second.extent_int(0)==ncols,
+        "Error! Column cost already enabled with a different number of columns.\n"
+        " - grid name    : " + grid_name + "\n"
+        " - stored ncols : " + std::to_string(it->second.extent_int(0)) + "\n"
+        " - input ncols  : " + std::to_string(ncols) + "\n");
+    return;
+  }
+  costs[grid_name] = column_cost_view_t("column_cost_"+grid_name,ncols);
+}
+
+bool column_cost_enabled (const std::string& grid_name)
+{
+  return column_costs().count(grid_name)==1;
+}
+
+column_cost_view_t get_column_cost (const std::string& grid_name)
+{
+  auto& costs = column_costs();
+  auto it = costs.find(grid_name);
+  EKAT_REQUIRE_MSG (it!=costs.end(),
+      "Error! Column cost is not enabled for grid '" + grid_name + "'.\n");
+  return it->second;
+}
+
+std::vector<Real> compute_elem_weights (const column_cost_view_t& cost,
+                                        const int nsteps,
+                                        const std::vector<int>& col2elem,
+                                        const int nelems)
+{
+  const int ncols = cost.extent_int(0);
+  EKAT_REQUIRE_MSG (static_cast<int>(col2elem.size())==ncols,
+      "Error! Column->element map size does not match the number of columns.\n"
+      " - ncols         : " + std::to_string(ncols) + "\n"
+      " - col2elem size : " + std::to_string(col2elem.size()) + "\n");
+
+  auto cost_h = Kokkos::create_mirror_view(cost);
+  Kokkos::deep_copy(cost_h,cost);
+
+  std::vector<Real> weights(nelems,0);
+  for (int icol=0; icol<ncols; ++icol) {
+    const int ie = col2elem[icol];
+    EKAT_REQUIRE_MSG (ie>=0 && ie<nelems,
+        "Error! Invalid element index in column->element map.\n"
+        " - column : " + std::to_string(icol) + "\n"
+        " - element: " + std::to_string(ie) + "\n");
+    weights[ie] += 1;
+    if (nsteps>0) {
+      weights[ie] += cost_h(icol) / nsteps;
+    }
+  }
+  return weights;
+}
+
+void free_column_costs ()
+{
+  column_costs().clear();
+}
+
+} // namespace scream
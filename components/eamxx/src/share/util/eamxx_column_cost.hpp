@@ -0,0 +1,50 @@
+#ifndef EAMXX_COLUMN_COST_HPP
+#define EAMXX_COLUMN_COST_HPP
+
+#include "share/scream_types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A registry of per-column physics cost, used to load-balance the dynamics.
+ *
+ * Some physics processes have a cost that varies a lot across columns (e.g.,
+ * microphysics in cloudy vs clear columns, or shortwave radiation in sunlit
+ * vs dark columns). If cost tracking is enabled for a grid, these processes
+ * can add an estimate of the cost of each column to an accumulator. The units
+ * are arbitrary, but the convention is that a value of 1 corresponds to the
+ * cost of the whole physics in a "cheap" column, so that costs reported by
+ * different processes can be added together.
+ *
+ * The accumulated cost can be turned into element weights (via a column->element
+ * map), which the dynamics can use to partition the elements at the next run.
+ */
+
+using column_cost_view_t = KokkosTypes<DefaultDevice>::view_1d<Real>;
+
+// Start tracking the cost of the columns of a grid. The cost is initialized to 0.
+void enable_column_cost (const std::string& grid_name, const int ncols);
+
+bool column_cost_enabled (const std::string& grid_name);
+
+// Get the accumulator for the given grid. Processes reporting their cost
+// should add to (not overwrite) the entries of this view.
+column_cost_view_t get_column_cost (const std::string& grid_name);
+
+// Compute the weight of each element, given the accumulated column cost over
+// nsteps physics steps, and the (local) element index of each column. Each
+// column has an additional base cost of 1, so that all weights are positive.
+std::vector<Real> compute_elem_weights (const column_cost_view_t& cost,
+                                        const int nsteps,
+                                        const std::vector<int>& col2elem,
+                                        const int nelems);
+
+// Release all accumulators. Must be called before finalizing kokkos
+void free_column_costs ();
+
+} // namespace scream
+
+#endif // EAMXX_COLUMN_COST_HPP
@@ -49,19 +49,7 @@ void TimeInterpolation::finalize()
  */
 void TimeInterpolation::perform_time_interpolation(const TimeStamp& time_in)
 {
-  // Declare the output map
-  std::map<std::string,Field> interpolated_fields;
-
-  // If data is handled by files we need to check that the timestamps are still relevant
-  if (m_file_data_triplets.size()>0) {
-    check_and_update_data(time_in);
-  }
-
-  // Gather weights for interpolation.  Note, timestamp differences are integers and we need a
-  // real defined weight.
-  const Real w_num = m_time1 - time_in;
-  const Real w_den = m_time1 - m_time0;
-  const Real weight0 = w_num/w_den;
+  const Real weight0 = update_data_and_get_weight0(time_in);
   const Real weight1 = 1.0-weight0;
 
   // Cycle through all stored fields and conduct the time interpolation
@@ -75,6 +63,30 @@ void TimeInterpolation::perform_time_interpolation(const TimeStamp& time_in)
   }
 }
 /*-----------------------------------------------------------------------------------------------*/
+/* Function which makes sure the interpolation data brackets the input time, reading new data
+ * from file if needed, and returns the time interpolation weight of the time0 data.
+ * Input:
+ *   time_in - A timestamp to interpolate onto.
+ * Output:
+ *   The weight w such that y* = w*y0 + (1-w)*y1
+ *
+ * Useful for users that do not need the interpolated fields themselves, e.g., if they
+ * process each snap of data via the read callback, and interpolate the processed data.
+ */
+Real TimeInterpolation::update_data_and_get_weight0(const TimeStamp& time_in)
+{
+  // If data is handled by files we need to check that the timestamps are still relevant
+  if (m_file_data_triplets.size()>0) {
+    check_and_update_data(time_in);
+  }
+
+  // Gather weights for interpolation.  Note, timestamp differences are integers and we need a
+  // real defined weight.
+  const Real w_num = m_time1 - time_in;
+  const Real w_den = m_time1 - m_time0;
+  return w_num/w_den;
+}
+/*-----------------------------------------------------------------------------------------------*/
 /* Function which registers a field in the local field managers.
  * Input:
  *   field_in - Is a field with the appropriate dimensions and metadata to match the interpolation
@@ -380,6 +392,14 @@ void TimeInterpolation::read_data()
   }
   m_file_data_atm_input->read_variables(triplet_curr.time_idx);
   m_time1 = triplet_curr.timestamp;
+
+  if (m_read_callback) {
+    std::map<std::string,Field> new_data;
+    for (const auto& name : m_field_names) {
+      new_data.emplace(name,m_fm_time1->get_field(name));
+    }
+    m_read_callback(new_data);
+  }
 }
 /*-----------------------------------------------------------------------------------------------*/
 /* Function to check the current set of interpolation data against a timestamp and, if needed,
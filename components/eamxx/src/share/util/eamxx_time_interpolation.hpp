@@ -10,6 +10,8 @@
 
 #include "share/io/scorpio_input.hpp"
 
+#include <functional>
+
 namespace scream{
 namespace util {
 
@@ -18,6 +20,7 @@ public:
    using grid_ptr_type = std::shared_ptr<const AbstractGrid>;
    using vos_type = std::vector<std::string>;
    using fm_type = std::shared_ptr<FieldManager>;
+   using read_callback_type = std::function<void(const std::map<std::string,Field>&)>;
 
   // Constructors & Destructor
   TimeInterpolation() = default;
@@ -32,6 +35,7 @@ public:
   void update_data_from_field(const Field& field_in);
   void update_timestamp(const TimeStamp& ts_in);
   void perform_time_interpolation(const TimeStamp& time_in);
+  Real update_data_and_get_weight0(const TimeStamp& time_in);
   void finalize();
 
   // Build interpolator
@@ -45,6 +49,13 @@ public:
   // Informational
   void print();
 
+  // Option to add a callback, invoked every time a new snap of data is read from file.
+  // The input map contains the fields holding the new data (i.e., the time1 data).
+  // This allows to process each snap of data only once, rather than at every interpolation.
+  void set_read_callback(const read_callback_type& cb) {
+    m_read_callback = cb;
+  }
+
   // Option to add a logger
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& logger,
                   const std::string& header) {
@@ -94,6 +105,8 @@ protected:
 
   std::shared_ptr<ekat::logger::LoggerBase>  m_logger;
   std::string                                m_header;
+
+  read_callback_type                         m_read_callback;
 }; // class TimeInterpolation
 
 } // namespace util
@@ -0,0 +1,270 @@
+#include "share/util/eamxx_vertical_interp_plan.hpp"
+
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+#include <ekat/util/ekat_upper_bound.hpp>
+#include <ekat/ekat_assert.hpp>
+
+namespace scream {
+
+namespace {
+
+// Get the data pointer and the col/cmp strides of a field with layout (COL,[CMP,]LEV),
+// or (COL[,CMP]) if has_lev=false. Also checks that LEV is the fastest striding dim.
+template<typename ST>
+void get_raw_data (const Field& f, const bool has_lev,
+                   ST*& data, int& col_stride, int& cmp_stride, int& ncmps)
+{
+  using namespace ShortFieldTagsNames;
+
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  const int rank = fl.rank();
+  EKAT_REQUIRE_MSG (rank>0 and fl.tag(0)==COL and rank<=(has_lev ? 3 : 2),
+      "[VerticalInterpPlan] Error! Unsupported field layout.\n"
+      " - field name  : " + f.name() + "\n"
+      " - field layout: " + fl.to_string() + "\n");
+
+  bool lev_stride_one = true;
+  cmp_stride = 0;
+  ncmps = 1;
+  if (rank==1) {
+    auto v = f.get_strided_view<ST*>();
+    data = v.data();
+    col_stride = v.stride(0);
+  } else if (rank==2) {
+    auto v = f.get_strided_view<ST**>();
+    data = v.data();
+    col_stride = v.stride(0);
+    if (has_lev) {
+      lev_stride_one = v.stride(1)==1;
+    } else {
+      cmp_stride = v.stride(1);
+      ncmps = v.extent(1);
+    }
+  } else {
+    auto v = f.get_strided_view<ST***>();
+    data = v.data();
+    col_stride = v.stride(0);
+    cmp_stride = v.stride(1);
+    ncmps = v.extent(1);
+    lev_stride_one = v.stride(2)==1;
+  }
+  EKAT_REQUIRE_MSG (lev_stride_one,
+      "[VerticalInterpPlan] Error! The LEV dimension must have unit stride.\n"
+      " - field name: " + f.name() + "\n");
+}
+
+} // anonymous namespace
+
+VerticalInterpPlan::
+VerticalInterpPlan (const Field& p_src, const Field& p_tgt)
+ : m_p_src (p_src)
+ , m_p_tgt (p_tgt)
+{
+  using namespace ShortFieldTagsNames;
+
+  const auto& src_l = p_src.get_header().get_identifier().get_layout();
+  const auto& tgt_l = p_tgt.get_header().get_identifier().get_layout();
+  const bool src_has_col = src_l.rank()==2 and src_l.tag(0)==COL;
+  const bool tgt_has_col = tgt_l.rank()==2 and tgt_l.tag(0)==COL;
+  EKAT_REQUIRE_MSG ((src_has_col or src_l.rank()==1) and (tgt_has_col or tgt_l.rank()==1),
+      "[VerticalInterpPlan] Error! Pressure fields must have layout (COL,LEV) or (LEV).\n"
+      " - p_src layout: " + src_l.to_string() + "\n"
+      " - p_tgt layout: " + tgt_l.to_string() + "\n");
+  EKAT_REQUIRE_MSG (src_has_col or tgt_has_col,
+      "[VerticalInterpPlan] Error! At least one pressure field must have the COL dimension.\n"
+      " - p_src layout: " + src_l.to_string() + "\n"
+      " - p_tgt layout: " + tgt_l.to_string() + "\n");
+  EKAT_REQUIRE_MSG (not src_has_col or not tgt_has_col or src_l.dim(0)==tgt_l.dim(0),
+      "[VerticalInterpPlan] Error! Source and target pressure have different number of columns.\n"
+      " - p_src layout: " + src_l.to_string() + "\n"
+      " - p_tgt layout: " + tgt_l.to_string() + "\n");
+
+  m_ncols = src_has_col ? src_l.dim(0) : tgt_l.dim(0);
+  m_nlevs_src = src_l.dims().back();
+  m_nlevs_tgt = tgt_l.dims().back();
+  EKAT_REQUIRE_MSG (m_nlevs_src>=2,
+      "[VerticalInterpPlan] Error! Source pressure must have at least two levels.\n");
+
+  m_idx = KT::view_2d<int> ("vinterp_plan_idx",m_ncols,m_nlevs_tgt);
+  m_w   = KT::view_2d<Real>("vinterp_plan_w",  m_ncols,m_nlevs_tgt);
+  m_oob = KT::view_2d<bool>("vinterp_plan_oob",m_ncols,m_nlevs_tgt);
+}
+
+void VerticalInterpPlan::setup ()
+{
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using MemberType = KT::MemberType;
+
+  // Treat 1d pressure as 2d, with zero column stride
+  auto get_pressure = [](const Field& p, int& col_stride) {
+    if (p.rank()==1) {
+      col_stride = 0;
+      return p.get_strided_view<const Real*>().data();
+    }
+    auto v = p.get_strided_view<const Real**>();
+    col_stride = v.stride(0);
+    return v.data();
+  };
+  int src_cs, tgt_cs;
+  const Real* p_src = get_pressure(m_p_src,src_cs);
+  const Real* p_tgt = get_pressure(m_p_tgt,tgt_cs);
+
+  const int nlevs_src = m_nlevs_src;
+  const int nlevs_tgt = m_nlevs_tgt;
+  auto idx = m_idx;
+  auto w   = m_w;
+  auto oob = m_oob;
+  auto policy = ESU::get_default_team_policy(m_ncols,nlevs_tgt);
+  Kokkos::parallel_for("VerticalInterpPlan::setup",policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+    const Real* x_src = p_src + icol*src_cs;
+    const Real* x_tgt = p_tgt + icol*tgt_cs;
+    const Real* end = x_src + nlevs_src;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt),
+                         [&](const int k) {
+      const Real x = x_tgt[k];
+      // Find the interval [k0,k0+1] containing x. If x is out of bounds, use the
+      // first/last interval, which will cause a linear extrapolation
+      int k0 = (ekat::upper_bound(x_src,end,x) - x_src) - 1;
+      k0 = k0<0 ? 0 : (k0>nlevs_src-2 ? nlevs_src-2 : k0);
+      // Guard against zero-width intervals (e.g., from padding), which give
+      // constant extrapolation
+      const Real dx = x_src[k0+1] - x_src[k0];
+      idx(icol,k) = k0;
+      w(icol,k)   = dx>0 ? (x - x_src[k0]) / dx : Real(0);
+      oob(icol,k) = x<x_src[0] or x>x_src[nlevs_src-1];
+    });
+  });
+}
+
+void VerticalInterpPlan::
+add_field (const Field& f_src, const Field& f_tgt)
+{
+  add_entry(make_entry(f_src,f_tgt));
+}
+
+void VerticalInterpPlan::
+add_field (const Field& f_src, const Field& f_tgt, const Real mask_val)
+{
+  auto e = make_entry(f_src,f_tgt);
+  e.masked = true;
+  e.mask_val = mask_val;
+  add_entry(e);
+}
+
+void VerticalInterpPlan::add_mask (const Field& mask)
+{
+  const bool has_lev = mask.rank()==2;
+  EKAT_REQUIRE_MSG (has_lev or m_nlevs_tgt==1,
+      "[VerticalInterpPlan] Error! Mask field without LEV dimension, but more than one target level.\n"
+      " - mask field name: " + mask.name() + "\n");
+
+  Entry e;
+  int ncmps;
+  get_raw_data(mask,has_lev,e.tgt,e.tgt_col_stride,e.tgt_cmp_stride,ncmps);
+  check_tgt_layout(mask,has_lev);
+  add_entry(e);
+}
+
+VerticalInterpPlan::Entry VerticalInterpPlan::
+make_entry (const Field& f_src, const Field& f_tgt) const
+{
+  const bool tgt_has_lev = f_tgt.rank()==f_src.rank();
+  EKAT_REQUIRE_MSG (tgt_has_lev or m_nlevs_tgt==1,
+      "[VerticalInterpPlan] Error! Target field without LEV dimension, but more than one target level.\n"
+      " - tgt field name: " + f_tgt.name() + "\n");
+
+  Entry e;
+  int src_ncmps, tgt_ncmps;
+  get_raw_data(f_src,true,e.src,e.src_col_stride,e.src_cmp_stride,src_ncmps);
+  get_raw_data(f_tgt,tgt_has_lev,e.tgt,e.tgt_col_stride,e.tgt_cmp_stride,tgt_ncmps);
+
+  const auto& src_l = f_src.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (src_l.dim(0)==m_ncols and src_l.dims().back()==m_nlevs_src,
+      "[VerticalInterpPlan] Error! Source field layout incompatible with source pressure.\n"
+      " - src field name  : " + f_src.name() + "\n"
+      " - src field layout: " + src_l.to_string() + "\n");
+  check_tgt_layout(f_tgt,tgt_has_lev);
+  EKAT_REQUIRE_MSG (src_ncmps==tgt_ncmps,
+      "[VerticalInterpPlan] Error! Source and target fields have different number of components.\n"
+      " - src field name: " + f_src.name() + "\n"
+      " - tgt field name: " + f_tgt.name() + "\n");
+  e.ncmps = src_ncmps;
+
+  return e;
+}
+
+void VerticalInterpPlan::
+check_tgt_layout (const Field& f_tgt, const bool has_lev) const
+{
+  const auto& tgt_l = f_tgt.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (tgt_l.dim(0)==m_ncols and (not has_lev or tgt_l.dims().back()==m_nlevs_tgt),
+      "[VerticalInterpPlan] Error! Target field layout incompatible with target pressure.\n"
+      " - tgt field name  : " + f_tgt.name() + "\n"
+      " - tgt field layout: " + tgt_l.to_string() + "\n");
+}
+
+void VerticalInterpPlan::add_entry (const Entry& e)
+{
+  m_entries_h.push_back(e);
+  m_max_ncmps = std::max(m_max_ncmps,e.ncmps);
+
+  m_entries = KT::view_1d<Entry>("vinterp_plan_entries",m_entries_h.size());
+  auto entries_h = Kokkos::create_mirror_view(m_entries);
+  std::copy(m_entries_h.begin(),m_entries_h.end(),entries_h.data());
+  Kokkos::deep_copy(m_entries,entries_h);
+}
+
+void VerticalInterpPlan::apply () const
+{
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using MemberType = KT::MemberType;
+
+  const int nentries = m_entries_h.size();
+  if (nentries==0) {
+    return;
+  }
+
+  const int ncols = m_ncols;
+  const int nlevs_tgt = m_nlevs_tgt;
+  auto entries = m_entries;
+  auto idx = m_idx;
+  auto w   = m_w;
+  auto oob = m_oob;
+
+  // One team per (field,col) pair, with threads spanning the components,
+  // and vector lanes spanning the target levels.
+  auto policy = ESU::get_default_team_policy(nentries*ncols,m_max_ncmps*nlevs_tgt);
+  Kokkos::parallel_for("VerticalInterpPlan::apply",policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int ientry = team.league_rank() / ncols;
+    const int icol   = team.league_rank() % ncols;
+    const auto& e = entries(ientry);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,e.ncmps),
+                         [&](const int icmp) {
+      Real* y_tgt = e.tgt + icol*e.tgt_col_stride + icmp*e.tgt_cmp_stride;
+      if (e.src==nullptr) {
+        // This is a mask
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,nlevs_tgt),
+                             [&](const int k) {
+          y_tgt[k] = oob(icol,k) ? 0 : 1;
+        });
+        return;
+      }
+      const Real* y_src = e.src + icol*e.src_col_stride + icmp*e.src_cmp_stride;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,nlevs_tgt),
+                           [&](const int k) {
+        if (e.masked and oob(icol,k)) {
+          y_tgt[k] = e.mask_val;
+        } else {
+          const int k0 = idx(icol,k);
+          y_tgt[k] = y_src[k0] + w(icol,k)*(y_src[k0+1]-y_src[k0]);
+        }
+      });
+    });
+  });
+}
+
+} // namespace scream
@@ -0,0 +1,100 @@
+#ifndef EAMXX_VERTICAL_INTERP_PLAN_HPP
+#define EAMXX_VERTICAL_INTERP_PLAN_HPP
+
+#include "share/field/field.hpp"
+#include "share/scream_types.hpp"
+
+#include <vector>
+
+namespace scream {
+
+/*
+ * A reusable plan for linear interpolation along the vertical direction.
+ *
+ * Given a source and a target pressure profile, setup() computes, for each column
+ * and target level, the source interval bracketing the target pressure, and the
+ * corresponding linear interpolation weight. The plan can then be applied to all
+ * the fields defined on the source levels, with a single kernel launch, so that
+ * the (binary) search over the source levels is done once, rather than once per field.
+ *
+ * Source and target pressure can have layout (COL,LEV) or (LEV), but at least
+ * one of them must have the COL dimension. Pressure must be increasing along LEV.
+ *
+ * Fields must have layout (COL,LEV) or (COL,CMP,LEV). For target fields, the LEV
+ * dimension can be omitted if there is only one target level. Subfields are allowed,
+ * as long as LEV is the fastest striding dimension.
+ *
+ * Target levels outside the source pressure range are linearly extrapolated using
+ * the first/last source interval, unless a mask value is provided for the field,
+ * in which case such entries are set to the mask value.
+ */
+
+class VerticalInterpPlan {
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  VerticalInterpPlan (const Field& p_src, const Field& p_tgt);
+  ~VerticalInterpPlan () = default;
+
+  // Compute bracketing indices and weights, using the current values of p_src/p_tgt.
+  // Must be called every time p_src or p_tgt change.
+  void setup ();
+
+  // Add a pair of fields to the set of fields interpolated by apply()
+  void add_field (const Field& f_src, const Field& f_tgt);
+  void add_field (const Field& f_src, const Field& f_tgt, const Real mask_val);
+
+  // Add a field to be set to 1 where the target pressure is within the
+  // source pressure bounds, and 0 elsewhere. Layout must be (COL,LEV) or (COL).
+  void add_mask (const Field& mask);
+
+  // Interpolate all fields (and set all masks) added so far, with one kernel launch
+  void apply () const;
+
+  int num_fields () const { return m_entries_h.size(); }
+
+#ifndef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
+protected:
+#endif
+
+  // Raw data of a src/tgt fields pair, seen as a (ncols,ncmps,nlevs) array
+  struct Entry {
+    const Real* src = nullptr;  // nullptr for masks
+    Real*       tgt = nullptr;
+    int src_col_stride = 0;
+    int src_cmp_stride = 0;
+    int tgt_col_stride = 0;
+    int tgt_cmp_stride = 0;
+    int ncmps = 1;
+    bool masked = false;
+    Real mask_val = 0;
+  };
+
+  Entry make_entry (const Field& f_src, const Field& f_tgt) const;
+  void check_tgt_layout (const Field& f_tgt, const bool has_lev) const;
+  void add_entry (const Entry& e);
+
+protected:
+
+  int m_ncols;
+  int m_nlevs_src;
+  int m_nlevs_tgt;
+
+  Field m_p_src;
+  Field m_p_tgt;
+
+  // For each (col,tgt_lev), the index k of the src interval [k,k+1] used for the
+  // interpolation, the weight of the src level k+1, and whether p_tgt is out of bounds
+  KT::view_2d<int>   m_idx;
+  KT::view_2d<Real>  m_w;
+  KT::view_2d<bool>  m_oob;
+
+  std::vector<Entry>          m_entries_h;
+  KT::view_1d<Entry>          m_entries;
+  int                         m_max_ncmps = 1;
+};
+
+} // namespace scream
+
+#endif // EAMXX_VERTICAL_INTERP_PLAN_HPP
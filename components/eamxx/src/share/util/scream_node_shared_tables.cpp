@@ -0,0 +1,111 @@
+#include "share/util/scream_node_shared_tables.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <map>
+
+namespace scream {
+
+namespace {
+
+struct NodeSharedBuffer {
+  MPI_Comm    node_comm = MPI_COMM_NULL;
+  MPI_Win     win       = MPI_WIN_NULL;
+  const void* data      = nullptr;
+  size_t      nbytes    = 0;
+};
+
+using dev_buffer_t = KokkosTypes<DefaultDevice>::view_1d<char>;
+
+std::map<std::string,NodeSharedBuffer>& host_buffers () {
+  static std::map<std::string,NodeSharedBuffer> buffers;
+  return buffers;
+}
+
+std::map<std::string,dev_buffer_t>& device_buffers () {
+  static std::map<std::string,dev_buffer_t> buffers;
+  return buffers;
+}
+
+} // anonymous namespace
+
+const void* get_node_shared_buffer (const std::string& name,
+                                    const ekat::Comm& comm,
+                                    const size_t nbytes,
+                                    const std::function<void(void*)>& fill)
+{
+  auto& buffers = host_buffers();
+  auto it = buffers.find(name);
+  if (it!=buffers.end()) {
+    EKAT_REQUIRE_MSG (it->second.nbytes==nbytes,
+        "Error! Node-shared table requested with a different size than the stored one.\n"
+        " - table name : " + name + "\n"
+        " - stored size: " + std::to_string(it->second.nbytes) + "\n"
+        " - input size : " + std::to_string(nbytes) + "\n");
+    return it->second.data;
+  }
+
+  auto& b = buffers[name];
+  b.nbytes = nbytes;
+
+  // Group the ranks that can share memory (i.e., the ranks on the same node)
+  MPI_Comm_split_type(comm.mpi_comm(),MPI_COMM_TYPE_SHARED,comm.rank(),MPI_INFO_NULL,&b.node_comm);
+  int node_rank;
+  MPI_Comm_rank(b.node_comm,&node_rank);
+
+  // Only the first rank on the node allocates memory, the other ranks query its address
+  void* base;
+  const MPI_Aint my_size = node_rank==0 ? nbytes : 0;
+  int err = MPI_Win_allocate_shared(my_size,1,MPI_INFO_NULL,b.node_comm,&base,&b.win);
+  EKAT_REQUIRE_MSG (err==MPI_SUCCESS,
+      "Error! Could not allocate node-shared memory for table.\n"
+      " - table name: " + name + "\n"
+      " - num bytes : " + std::to_string(nbytes) + "\n");
+
+  MPI_Aint size;
+  int disp_unit;
+  MPI_Win_shared_query(b.win,0,&size,&disp_unit,&base);
+
+  MPI_Win_fence(0,b.win);
+  if (node_rank==0) {
+    fill(base);
+  }
+  MPI_Win_fence(0,b.win);
+
+  b.data = base;
+  return b.data;
+}
+
+const void* get_device_table_copy (const std::string& name,
+                                   const void* host_buffer,
+                                   const size_t nbytes)
+{
+  auto& buffers = device_buffers();
+  auto it = buffers.find(name);
+  if (it==buffers.end()) {
+    using host_buffer_t = Kokkos::View<const char*,Kokkos::HostSpace,Kokkos::MemoryUnmanaged>;
+    dev_buffer_t d(name,nbytes);
+    Kokkos::deep_copy(d,host_buffer_t(static_cast<const char*>(host_buffer),nbytes));
+    it = buffers.emplace(name,d).first;
+  }
+  EKAT_REQUIRE_MSG (it->second.size()==nbytes,
+      "Error! Device copy of node-shared table has a different size than requested.\n"
+      " - table name : " + name + "\n"
+      " - stored size: " + std::to_string(it->second.size()) + "\n"
+      " - input size : " + std::to_string(nbytes) + "\n");
+  return it->second.data();
+}
+
+void free_node_shared_tables ()
+{
+  device_buffers().clear();
+
+  for (auto& it : host_buffers()) {
+    auto& b = it.second;
+    MPI_Win_free(&b.win);
+    MPI_Comm_free(&b.node_comm);
+  }
+  host_buffers().clear();
+}
+
+} // namespace scream
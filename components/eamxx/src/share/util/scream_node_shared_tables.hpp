@@ -0,0 +1,81 @@
+#ifndef SCREAM_NODE_SHARED_TABLES_HPP
+#define SCREAM_NODE_SHARED_TABLES_HPP
+
+#include "share/scream_types.hpp"
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <functional>
+#include <string>
+
+namespace scream {
+
+/*
+ * A registry for read-only data tables (e.g., physics lookup tables).
+ *
+ * Tables are identified by name. The first time a table is requested, a host
+ * buffer is allocated in MPI-3 shared memory, and filled by one rank per node.
+ * All ranks on the same node then access the same buffer, so that the table is
+ * stored only once per node, rather than once per rank.
+ *
+ * If the requested view lives in a memory space that is not accessible from host
+ * (e.g., on GPU), each process makes one device copy of the node-shared buffer,
+ * and all requests for the same table within the process get that copy.
+ *
+ * All calls are collective over the input comm, and all ranks must request the
+ * tables in the same order. The returned views must be treated as read-only, and
+ * must not be used after free_node_shared_tables is called.
+ */
+
+// Get a host buffer of nbytes bytes, shared by all ranks of comm on the same node.
+// The input function is called only on one rank per node, to fill the buffer.
+const void* get_node_shared_buffer (const std::string& name,
+                                    const ekat::Comm& comm,
+                                    const size_t nbytes,
+                                    const std::function<void(void*)>& fill);
+
+// Get a device copy of a node-shared buffer (copied only at the first call)
+const void* get_device_table_copy (const std::string& name,
+                                   const void* host_buffer,
+                                   const size_t nbytes);
+
+// Get a read-only table as a view of type ViewT, with the given runtime extents.
+// The fill functor is called on one rank per node with an (unmanaged) host view
+// with the same data type and layout of ViewT, which it must fill.
+template<typename ViewT, typename FillFunc, typename... Dims>
+ViewT get_node_shared_table (const std::string& name,
+                             const ekat::Comm& comm,
+                             FillFunc&& fill,
+                             const Dims... dims)
+{
+  using data_t   = typename ViewT::non_const_data_type;
+  using layout_t = typename ViewT::array_layout;
+  using mem_t    = typename ViewT::memory_space;
+  using host_view_t = Kokkos::View<data_t,layout_t,Kokkos::HostSpace,Kokkos::MemoryUnmanaged>;
+  using ptr_t    = typename ViewT::pointer_type;
+  using value_t  = typename ViewT::non_const_value_type;
+
+  const size_t nbytes = host_view_t::required_allocation_size(dims...);
+  const void* host_buf = get_node_shared_buffer(name,comm,nbytes,
+    [&](void* buf) {
+      fill(host_view_t(static_cast<value_t*>(buf),dims...));
+    });
+
+  constexpr bool host_accessible = Kokkos::SpaceAccessibility<Kokkos::HostSpace,mem_t>::accessible;
+  if (host_accessible) {
+    return ViewT(static_cast<ptr_t>(const_cast<void*>(host_buf)),dims...);
+  }
+
+  static_assert (host_accessible ||
+                 std::is_same<mem_t,typename DefaultDevice::memory_space>::value,
+                 "Error! Node-shared tables can only be stored on host or on the default device.\n");
+  const void* dev_buf = get_device_table_copy(name,host_buf,nbytes);
+  return ViewT(static_cast<ptr_t>(const_cast<void*>(dev_buf)),dims...);
+}
+
+// Release all tables. Must be called before finalizing kokkos/MPI
+void free_node_shared_tables ();
+
+} // namespace scream
+
+#endif // SCREAM_NODE_SHARED_TABLES_HPP
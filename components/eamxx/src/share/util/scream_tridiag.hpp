@@ -0,0 +1,87 @@
+#ifndef SCREAM_TRIDIAG_HPP
+#define SCREAM_TRIDIAG_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cassert>
+
+namespace scream {
+namespace tridiag {
+
+/*
+ * Team-level batched Thomas solver for A x_j = b_j, j=0..nrhs-1, where the
+ * scalar tridiagonal matrix A is the same for all right hand sides.
+ *
+ * The nxn matrix A is stored as (dl, d, du), with the same conventions of
+ * ekat::tridiag: the lower diagonal is in dl(1:n-1), the diagonal in d(0:n-1),
+ * and the upper diagonal in du(0:n-2).
+ *
+ * Unlike ekat::tridiag, which expects X(nrow,nrhs), each right hand side is a
+ * contiguous array of length nrow, so that fields stored as (nrhs,nrow), e.g.,
+ * tracers with LEV as the fastest dimension, can be solved in place, without
+ * transposing them. The matrix is factorized once per team, and the right hand
+ * sides are then solved in parallel over the team threads and vector lanes.
+ *
+ * On input X = B, on output X = A \ B. The diagonals are overwritten by the
+ * factorization. The arithmetic is the same of ekat::tridiag::thomas.
+ */
+
+// Factorize A in place. The caller must provide a team_barrier after this call,
+// before calling solve_batched.
+template <typename TeamMember, typename TridiagDiag>
+KOKKOS_INLINE_FUNCTION
+void factorize (const TeamMember& team,
+                const TridiagDiag& dl, const TridiagDiag& d, const TridiagDiag& du) {
+  const int nrow = d.extent_int(0);
+  assert(dl.extent_int(0) == nrow);
+  assert(du.extent_int(0) == nrow);
+  Kokkos::single(Kokkos::PerTeam(team), [&] () {
+    for (int i = 1; i < nrow; ++i) {
+      dl(i) /= d(i-1);
+      d (i) -= dl(i) * du(i-1);
+    }
+  });
+}
+
+// Solve with a factorized A for the contiguous right hand side x.
+template <typename TridiagDiag, typename XT>
+KOKKOS_INLINE_FUNCTION
+void solve (const TridiagDiag& dl, const TridiagDiag& d, const TridiagDiag& du,
+            XT* const x) {
+  const int nrow = d.extent_int(0);
+  for (int i = 1; i < nrow; ++i)
+    x[i] -= dl(i) * x[i-1];
+  x[nrow-1] /= d(nrow-1);
+  for (int i = nrow-1; i > 0; --i)
+    x[i-1] = (x[i-1] - du(i-1) * x[i]) / d(i-1);
+}
+
+// Solve with a factorized A for the nrhs right hand sides get_rhs(j), j=0..nrhs-1.
+// get_rhs(j) must return a pointer to a contiguous array of length nrow.
+template <typename TeamMember, typename TridiagDiag, typename RhsGetter>
+KOKKOS_INLINE_FUNCTION
+void solve_batched (const TeamMember& team,
+                    const TridiagDiag& dl, const TridiagDiag& d, const TridiagDiag& du,
+                    const int nrhs, const RhsGetter& get_rhs) {
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nrhs), [&] (const int j) {
+    solve(dl, d, du, get_rhs(j));
+  });
+}
+
+// Same as above, with right hand sides X(j,0:nrow-1), j=0..nrhs-1. X must be
+// LayoutRight, but its extent along dim 1 can exceed nrow (e.g., due to padding).
+template <typename TeamMember, typename TridiagDiag, typename DataArray>
+KOKKOS_INLINE_FUNCTION
+void solve_batched (const TeamMember& team,
+                    const TridiagDiag& dl, const TridiagDiag& d, const TridiagDiag& du,
+                    const DataArray& X) {
+  static_assert(DataArray::rank == 2, "Error! X must be a rank-2 view.\n");
+  assert(X.extent_int(1) >= d.extent_int(0));
+  solve_batched(team, dl, d, du, X.extent_int(0),
+                [&] (const int j) { return &X(j,0); });
+}
+
+} // namespace tridiag
+} // namespace scream
+
+#endif // SCREAM_TRIDIAG_HPP
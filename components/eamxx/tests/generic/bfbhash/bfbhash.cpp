@@ -5,6 +5,7 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 namespace scream {
 
@@ -54,6 +55,23 @@ TEST_CASE("bfbhash")
   testeq<float>();
   testeq<double>();
 
+  { // Hierarchical hashing: combining per-column hashes in any order gives
+    // the hash of the whole field.
+    const int ncols = 5, nlevs = 7;
+    HashType flat = 0, cols = 0, cols_rev = 0;
+    std::vector<HashType> col_hashes(ncols, 0);
+    for (int i = 0; i < ncols; ++i)
+      for (int k = 0; k < nlevs; ++k) {
+        const double v = std::sin(i*nlevs + k);
+        hash(v, flat);
+        hash(v, col_hashes[i]);
+      }
+    for (int i = 0; i < ncols; ++i) hash(col_hashes[i], cols);
+    for (int i = ncols-1; i >= 0; --i) hash(col_hashes[i], cols_rev);
+    REQUIRE(flat == cols);
+    REQUIRE(flat == cols_rev);
+  }
+
   {
     ekat::Comm comm(MPI_COMM_WORLD);
     HashType a = comm.rank();
@@ -62,6 +80,17 @@ TEST_CASE("bfbhash")
     HashType c = 0;
     for (int i = 0, n = comm.size(); i < n; ++i) hash(HashType(i), c);
     REQUIRE(b == c);
+
+    // Several hashes reduced in a single collective
+    const int n = 3;
+    HashType as[n], bs[n];
+    for (int i = 0; i < n; ++i) as[i] = comm.rank() + i;
+    all_reduce_HashType(MPI_COMM_WORLD, as, bs, n);
+    for (int i = 0; i < n; ++i) {
+      HashType ci = 0;
+      for (int r = 0; r < comm.size(); ++r) hash(HashType(r + i), ci);
+      REQUIRE(bs[i] == ci);
+    }
   }
 }
 
@@ -0,0 +1,145 @@
+#include <catch2/catch.hpp>
+
+#include "physics/ml_correction/ml_correction_column_mlp.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <random>
+
+namespace scream {
+
+TEST_CASE("ml_correction_column_mlp") {
+  using MLP = ColumnMLP;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto engine = setup_random_test(&comm);
+  std::uniform_real_distribution<Real> pdf(-1,1);
+
+  const int ncols = 5;
+  const int nlevs = 7;
+  const int nin   = 2*nlevs + 1;   // T_mid, qv, lat
+  const int nout  = 2*nlevs;       // dQ1, dQ2
+  const std::vector<int> widths = {nin, 16, 9, nout};
+  const std::vector<std::string> acts = {"relu", "tanh", "linear"};
+
+  // Generate a model, and write it to file
+  std::vector<Real> in_mean(nin), in_std(nin), out_mean(nout), out_std(nout);
+  std::vector<std::vector<Real>> W(acts.size()), b(acts.size());
+  for (auto& m : in_mean)  m = pdf(engine);
+  for (auto& s : in_std)   s = 1.5 + pdf(engine);
+  for (auto& m : out_mean) m = pdf(engine);
+  for (auto& s : out_std)  s = 1.5 + pdf(engine);
+
+  const std::string filename = "column_mlp_np" + std::to_string(comm.size())
+                             + "_rank" + std::to_string(comm.rank()) + ".txt";
+  {
+    std::ofstream ofs(filename);
+    ofs.precision(17);
+    ofs << "eamxx_column_mlp_v1  # a comment\n";
+    ofs << "inputs 3\n  T_mid " << nlevs << "\n  qv " << nlevs << "\n  lat 1\n";
+    ofs << "outputs 2\n  dQ1 " << nlevs << "\n  dQ2 " << nlevs << "\n";
+    ofs << "input_scaling\n";
+    for (auto m : in_mean)  ofs << m << " ";
+    ofs << "\n";
+    for (auto s : in_std)   ofs << s << " ";
+    ofs << "\noutput_scaling\n";
+    for (auto m : out_mean) ofs << m << " ";
+    ofs << "\n";
+    for (auto s : out_std)  ofs << s << " ";
+    ofs << "\nlayers " << acts.size() << "\n";
+    for (size_t l=0; l<acts.size(); ++l) {
+      const int lin = widths[l];
+      const int lout = widths[l+1];
+      ofs << "# layer " << l << "\n";
+      ofs << "dense " << lin << " " << lout << " " << acts[l] << "\n";
+      W[l].resize(lin*lout);
+      b[l].resize(lout);
+      for (auto& w : W[l]) { w = pdf(engine); ofs << w << " "; }
+      ofs << "\n";
+      for (auto& v : b[l]) { v = pdf(engine); ofs << v << " "; }
+      ofs << "\n";
+    }
+  }
+
+  MLP mlp(filename);
+  REQUIRE (mlp.num_inputs()==nin);
+  REQUIRE (mlp.num_outputs()==nout);
+  REQUIRE (mlp.inputs().size()==3);
+  REQUIRE (mlp.inputs()[2].name=="lat");
+  REQUIRE (mlp.inputs()[2].offset==2*nlevs);
+  REQUIRE (mlp.outputs()[1].name=="dQ2");
+  REQUIRE (mlp.outputs()[1].offset==nlevs);
+
+  // Run on device
+  MLP::view_2d<Real> x("x",ncols,nin), y("y",ncols,nout);
+  auto x_h = Kokkos::create_mirror_view(x);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int i=0; i<nin; ++i) {
+      x_h(icol,i) = 10*pdf(engine);
+    }
+  }
+  Kokkos::deep_copy(x,x_h);
+  mlp.predict(x,y);
+
+  // Calling it twice must give the same result (work arrays are reused)
+  MLP::view_2d<Real> y2("y2",ncols,nout);
+  mlp.predict(x,y2);
+
+  auto y_h  = Kokkos::create_mirror_view(y);
+  auto y2_h = Kokkos::create_mirror_view(y2);
+  Kokkos::deep_copy(y_h,y);
+  Kokkos::deep_copy(y2_h,y2);
+
+  // Compare against a host implementation
+  const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+  for (int icol=0; icol<ncols; ++icol) {
+    std::vector<Real> a(nin);
+    for (int i=0; i<nin; ++i) {
+      a[i] = (x_h(icol,i)-in_mean[i]) / in_std[i];
+    }
+    for (size_t l=0; l<acts.size(); ++l) {
+      const int lin = widths[l];
+      const int lout = widths[l+1];
+      std::vector<Real> next(lout);
+      for (int o=0; o<lout; ++o) {
+        Real sum = b[l][o];
+        for (int i=0; i<lin; ++i) {
+          sum += W[l][o*lin+i]*a[i];
+        }
+        if (acts[l]=="relu") {
+          next[o] = std::max(sum,Real(0));
+        } else if (acts[l]=="tanh") {
+          next[o] = std::tanh(sum);
+        } else {
+          next[o] = sum;
+        }
+      }
+      a = next;
+    }
+    for (int o=0; o<nout; ++o) {
+      const Real expected = a[o]*out_std[o] + out_mean[o];
+      REQUIRE (std::abs(y_h(icol,o)-expected)<=tol*std::max(Real(1),std::abs(expected)));
+      REQUIRE (y_h(icol,o)==y2_h(icol,o));
+    }
+  }
+
+  // Wrong input size must be caught
+  MLP::view_2d<Real> x_bad("x_bad",ncols,nin+1);
+  REQUIRE_THROWS (mlp.predict(x_bad,y));
+
+  // Bad files must be caught
+  {
+    std::ofstream ofs(filename);
+    ofs << "eamxx_column_mlp_v1\ninputs 1\n a 2\noutputs 1\n b 1\n"
+        << "input_scaling\n 0 0 1 1\noutput_scaling\n 0 1\n"
+        << "layers 1\n dense 3 1 relu\n 1 1 1 0\n";
+  }
+  REQUIRE_THROWS (MLP(filename));
+}
+
+} // namespace scream
@@ -0,0 +1,196 @@
+#include <catch2/catch.hpp>
+
+#include "physics/ml_correction/eamxx_ml_correction_process_interface.hpp"
+#include "physics/ml_correction/ml_correction_zenith.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/scream_config.hpp"
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+namespace scream {
+
+TEST_CASE("ml_correction_zenith") {
+  using TS = util::TimeStamp;
+
+  // Days are counted in the model calendar: 2000 is a leap year only if the model has leap years
+  const TS j2000 ({2000,1,1},{12,0,0});
+  const int leap = use_leap_year() ? 1 : 0;
+  REQUIRE (days_from_j2000(j2000)==0);
+  REQUIRE (days_from_j2000(TS({2000,1,2},{0,0,0}))==0.5);
+  REQUIRE (days_from_j2000(TS({2001,1,1},{12,0,0}))==365+leap);
+  REQUIRE (days_from_j2000(TS({1999,12,31},{12,0,0}))==-1);
+
+  const double days = days_from_j2000(TS({2021,10,12},{12,30,0}));
+  const int leap_days = use_leap_year() ? 6 : 0;  // 2000, 2004, ..., 2020
+  REQUIRE (std::abs(days-(7949+leap_days+1800/86400.0))<1e-10);
+
+  // Reference values of vcm.cos_zenith_angle, for given days since J2000, lon, lat
+  struct Case { double days, lon, lat, cosz; };
+  const std::vector<Case> cases = {
+    {0.0,                     0.0, -23.0,  0.99991046626409164},
+    {0.0,                   180.0,  45.0, -0.92733210941993849},
+    {7949.0+1800/86400.0, -105.0,  40.0, -0.11966829600584736},
+    {7955.0+1800/86400.0, -105.0,  40.0, -0.13939861846985088},
+    {7949.0+1800/86400.0,   30.0, -60.0,  0.45897170234162454}
+  };
+  for (const auto& c : cases) {
+    REQUIRE (std::abs(cos_zenith_angle(c.days,c.lon,c.lat)-c.cosz)<1e-12);
+  }
+}
+
+TEST_CASE("ml_correction_native") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const int ngcols = 3*comm.size();
+  const int nlevs  = 8;
+  const int dt     = 1800;
+  const util::TimeStamp t0 ({2021,10,12},{12,30,0});
+
+  // A tiny model, with known outputs: dQ1 = wt*T_mid + wz*cos_zenith_angle, dQ2 = bq
+  const Real wt = 1e-6;
+  const Real wz = 1e-3;
+  const Real bq = 1e-9;
+  const int nin  = nlevs+1;
+  const int nout = 2*nlevs;
+  const std::string filename = "ml_native_np" + std::to_string(comm.size())
+                             + "_rank" + std::to_string(comm.rank()) + ".txt";
+  {
+    std::ofstream ofs(filename);
+    ofs.precision(17);
+    ofs << "eamxx_column_mlp_v1\n";
+    ofs << "inputs 2\n  T_mid " << nlevs << "\n  cos_zenith_angle 1\n";
+    ofs << "outputs 2\n  dQ1 " << nlevs << "\n  dQ2 " << nlevs << "\n";
+    ofs << "input_scaling\n";
+    for (int i=0; i<nin; ++i)  ofs << "0 ";
+    ofs << "\n";
+    for (int i=0; i<nin; ++i)  ofs << "1 ";
+    ofs << "\noutput_scaling\n";
+    for (int o=0; o<nout; ++o) ofs << "0 ";
+    ofs << "\n";
+    for (int o=0; o<nout; ++o) ofs << "1 ";
+    ofs << "\nlayers 1\n";
+    ofs << "dense " << nin << " " << nout << " linear\n";
+    for (int o=0; o<nout; ++o) {
+      for (int i=0; i<nin; ++i) {
+        Real w = 0;
+        if (o<nlevs) {
+          w = i==o ? wt : (i==nlevs ? wz : 0);
+        }
+        ofs << w << " ";
+      }
+      ofs << "\n";
+    }
+    for (int o=0; o<nout; ++o) ofs << (o<nlevs ? 0 : bq) << " ";
+    ofs << "\n";
+  }
+
+  // The grid, with lat/lon
+  ekat::ParameterList gm_params;
+  gm_params.set("grids_names",std::vector<std::string>{"Physics"});
+  auto& pl = gm_params.sublist("Physics");
+  pl.set("type",std::string("point_grid"));
+  pl.set("number_of_global_columns",ngcols);
+  pl.set("number_of_vertical_levels",nlevs);
+  auto gm = create_mesh_free_grids_manager(comm,gm_params);
+  gm->build_grids();
+
+  auto grid = gm->get_grid_nonconst("Physics");
+  const int ncols = grid->get_num_local_dofs();
+  const auto nondim = ekat::units::Units::nondimensional();
+  auto lat = grid->create_geometry_data("lat",grid->get_2d_scalar_layout(),nondim);
+  auto lon = grid->create_geometry_data("lon",grid->get_2d_scalar_layout(),nondim);
+  auto lat_h = lat.get_view<Real*,Host>();
+  auto lon_h = lon.get_view<Real*,Host>();
+  for (int icol=0; icol<ncols; ++icol) {
+    lat_h(icol) = 40 - 25*icol;
+    lon_h(icol) = -105 + 60*icol;
+  }
+  lat.sync_to_dev();
+  lon.sync_to_dev();
+
+  // The process
+  ekat::ParameterList params("MLCorrection");
+  params.set<std::string>("ML_model_path_tq",filename);
+  params.set<std::string>("ML_model_path_uv","NONE");
+  params.set<std::string>("ML_model_path_sfc_fluxes","NONE");
+  params.set<std::vector<std::string>>("ML_output_fields",{"qv","T_mid"});
+  params.set("ML_correction_unit_test",false);
+  params.set<std::string>("ML_inference_backend","native");
+  auto ml = std::make_shared<MLCorrection>(comm,params);
+  ml->set_grids(gm);
+
+  // Create the fields, and hand them to the process
+  FieldManager fm(grid);
+  fm.registration_begins();
+  for (const auto& req : ml->get_required_field_requests()) {
+    fm.register_field(req);
+  }
+  for (const auto& req : ml->get_computed_field_requests()) {
+    fm.register_field(req);
+  }
+  for (const auto& req : ml->get_required_group_requests()) {
+    fm.register_group(req);
+  }
+  for (const auto& req : ml->get_computed_group_requests()) {
+    fm.register_group(req);
+  }
+  fm.registration_ends();
+  fm.init_fields_time_stamp(t0);
+
+  for (const auto& req : ml->get_computed_field_requests()) {
+    ml->set_computed_field(fm.get_field(req.fid));
+  }
+  for (const auto& req : ml->get_computed_group_requests()) {
+    ml->set_computed_group(fm.get_field_group(req.name));
+  }
+  for (const auto& req : ml->get_required_group_requests()) {
+    ml->set_required_group(fm.get_field_group(req.name).get_const());
+  }
+  for (const auto& req : ml->get_required_field_requests()) {
+    ml->set_required_field(fm.get_field(req.fid).get_const());
+  }
+
+  for (auto it : fm) {
+    it.second->deep_copy(0);
+  }
+  auto T_mid = fm.get_field("T_mid");
+  auto qv    = fm.get_field("qv");
+  auto T_h   = T_mid.get_view<Real**,Host>();
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      T_h(icol,ilev) = 280 + icol + 0.5*ilev;
+    }
+  }
+  T_mid.sync_to_dev();
+  qv.deep_copy(0.01);
+  fm.get_field("pseudo_density").deep_copy(1000);
+
+  ml->initialize(t0,RunType::Initial);
+  ml->run(dt);
+
+  // Check the outputs. The zenith angle must be the one of the model date
+  T_mid.sync_to_host();
+  qv.sync_to_host();
+  const auto qv_h = qv.get_view<const Real**,Host>();
+  const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+  const double days = days_from_j2000(t0);
+  for (int icol=0; icol<ncols; ++icol) {
+    const Real cosz = cos_zenith_angle(days,lon_h(icol),lat_h(icol));
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      const Real T0 = 280 + icol + 0.5*ilev;
+      const Real T_expected  = T0 + (wt*T0 + wz*cosz)*dt;
+      const Real qv_expected = 0.01 + bq*dt;
+      REQUIRE (std::abs(T_h(icol,ilev)-T_expected)<=tol*T_expected);
+      REQUIRE (std::abs(qv_h(icol,ilev)-qv_expected)<=tol);
+    }
+  }
+
+  ml->finalize();
+}
+
+} // namespace scream
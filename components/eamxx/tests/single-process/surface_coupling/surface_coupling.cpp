@@ -48,6 +48,78 @@ private:
   std::vector<std::string> m_list_of_files;
 };
 
+// Exporter that can replay the export sequence used before the export kernels were
+// fused (zero the cpl buffer, set each constant export and copy each surface flux
+// with its own deep_copy, then copy the exports field by field into the buffer).
+// This allows to check that the fused kernels are BFB with the unfused ones.
+class SurfaceCouplingExporterTester : public SurfaceCouplingExporter
+{
+public:
+  SurfaceCouplingExporterTester (const ekat::Comm& comm, const ekat::ParameterList& params)
+   : SurfaceCouplingExporter(comm,params)
+  {}
+
+  KokkosTypes<HostDevice>::view_2d<Real>
+  unfused_export_to_cpl (const bool called_during_initialization) const
+  {
+    using policy_type = KT::RangePolicy;
+
+    // Exports that were copied from surface fluxes with a deep_copy
+    const std::map<std::string,std::string> sfc_fluxes = {
+      {"Faxa_swndr","sfc_flux_dir_nir"},
+      {"Faxa_swvdr","sfc_flux_dir_vis"},
+      {"Faxa_swndf","sfc_flux_dif_nir"},
+      {"Faxa_swvdf","sfc_flux_dif_vis"},
+      {"Faxa_swnet","sfc_flux_sw_net"},
+      {"Faxa_lwdn" ,"sfc_flux_lw_dn"}
+    };
+
+    // Any field not exported by scream, or not exported during initialization, is 0
+    KokkosTypes<DefaultDevice>::view_2d<Real> cpl_exports ("",m_num_cols,m_num_cpl_exports);
+    KokkosTypes<DefaultDevice>::view_1d<Real> tmp ("",m_num_cols);
+    for (int i=0; i<m_num_scream_exports; ++i) {
+      const auto& info = m_column_info_h(i);
+      if (called_during_initialization and not info.transfer_during_initialization) {
+        continue;
+      }
+
+      const auto& fname = m_export_field_names_vector[i];
+      if (m_export_source_h(i)==CONSTANT) {
+        Kokkos::deep_copy(tmp,m_export_constants.at(fname));
+      } else if (m_export_source_h(i)==FROM_MODEL and sfc_fluxes.count(fname)==1) {
+        Kokkos::deep_copy(tmp,get_field_in(sfc_fluxes.at(fname)).get_view<const Real*>());
+      } else {
+        const auto col_info = m_column_info_d;
+        Kokkos::parallel_for(policy_type(0,m_num_cols), KOKKOS_LAMBDA(const int& icol) {
+          const auto& info_d = col_info(i);
+          tmp(icol) = info_d.data[icol*info_d.col_stride + info_d.col_offset];
+        });
+      }
+
+      const auto icpl = info.cpl_indx;
+      const auto mult = info.constant_multiple;
+      Kokkos::parallel_for(policy_type(0,m_num_cols), KOKKOS_LAMBDA(const int& icol) {
+        cpl_exports(icol,icpl) = mult*tmp(icol);
+      });
+    }
+    return Kokkos::create_mirror_view_and_copy(HostDevice(),cpl_exports);
+  }
+};
+
+// Check the cpl exports against the ones of the unfused export sequence, including
+// the cpl fields that are not exported by scream.
+void test_exports_bfb (const SurfaceCouplingExporterTester& exporter,
+                       const KokkosTypes<HostDevice>::view_2d<Real> export_data_view,
+                       const bool called_directly_after_init = false)
+{
+  const auto ref = exporter.unfused_export_to_cpl(called_directly_after_init);
+  for (int i=0; i<int(export_data_view.extent(0)); ++i) {
+    for (int j=0; j<int(export_data_view.extent(1)); ++j) {
+      EKAT_REQUIRE(export_data_view(i,j) == ref(i,j));
+    }
+  }
+}
+
 std::vector<std::string> create_from_file_test_data(const ekat::Comm& comm, const util::TimeStamp& t0, const int ncols )
 { 
   // Create a grids manager on the fly
@@ -496,7 +568,7 @@ TEST_CASE("surface-coupling", "") {
   // Need to register products in the factory *before* we create any atm process or grids manager.
   auto& proc_factory = AtmosphereProcessFactory::instance();
   proc_factory.register_product("SurfaceCouplingImporter",&create_atmosphere_process<SurfaceCouplingImporter>);
-  proc_factory.register_product("SurfaceCouplingExporter",&create_atmosphere_process<SurfaceCouplingExporter>);
+  proc_factory.register_product("SurfaceCouplingExporter",&create_atmosphere_process<SurfaceCouplingExporterTester>);
   register_mesh_free_grids_manager();
   register_diagnostics();
 
@@ -623,12 +695,16 @@ TEST_CASE("surface-coupling", "") {
   ad.initialize_atm_procs ();
 
   const auto fm = ad.get_field_mgr("Physics");
+  const auto exporter = std::dynamic_pointer_cast<SurfaceCouplingExporterTester>(
+      ad.get_atm_processes()->get_process_nonconst("SurfaceCouplingExporter"));
+  REQUIRE (exporter!=nullptr);
 
   // Verify any initial imports/exports were done as expected
   test_imports(*fm, import_data_view, import_cpl_indices_view,
                import_constant_multiple_view, true);
   test_exports(*fm, export_data_view, export_cpl_indices_view,
                export_constant_multiple_view,  exp_const_params, dt, true);
+  test_exports_bfb(*exporter, export_data_view, true);
 
   // Run the AD
   ad.run(dt);
@@ -638,6 +714,7 @@ TEST_CASE("surface-coupling", "") {
                import_constant_multiple_view);
   test_exports(*fm, export_data_view, export_cpl_indices_view,
                export_constant_multiple_view, exp_const_params, dt);
+  test_exports_bfb(*exporter, export_data_view);
 
   // Finalize  the AD
   ad.finalize();
@@ -8,6 +8,7 @@
 #include "FunctorsBuffersManager.hpp"
 #include "HyperviscosityFunctorImpl.hpp"
 #include "profiling.hpp"
+#include "utilities/FusedLaunchUtils.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
 #include "mpi/MpiBuffersManager.hpp"
@@ -128,12 +129,24 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   m_data.eta_ave_w = eta_ave_w;
 
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
+    // The second laplacian and the pre-exchange update only need data from
+    // the same element, so we run them in a single kernel
     GPTLstart("hvf-bhwk");
-    biharmonic_wk_dp3d ();
-    GPTLstop("hvf-bhwk");
-    // dispatch parallel_for for first kernel
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    if (m_fuse_kernels) {
+      first_laplace_and_exchange ();
+      if ( m_data.consthv ) {
+        parallel_for_fused<TagSecondLaplaceConstHV,TagHyperPreExchange>(
+            "hvf second laplace + pre-exchange", m_state.num_elems(), *this);
+      } else {
+        parallel_for_fused<TagSecondLaplaceTensorHV,TagHyperPreExchange>(
+            "hvf second laplace + pre-exchange", m_state.num_elems(), *this);
+      }
+    } else {
+      biharmonic_wk_dp3d ();
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    }
     Kokkos::fence();
+    GPTLstop("hvf-bhwk");
 
     // Exchange
     assert (m_be->is_registration_completed());
@@ -149,17 +162,7 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
 
 void HyperviscosityFunctorImpl::biharmonic_wk_dp3d() const
 {
-  // For the first laplacian we use a differnt kernel, which uses directly the states
-  // at timelevel np1 as inputs. This way we avoid copying the states to *tens buffers.
-  
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
-  Kokkos::fence();
-
-  // Exchange
-  assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  first_laplace_and_exchange();
 
   // TODO: update m_data.nu_ratio if nu_div!=nu
   // Compute second laplacian, tensor or const hv
@@ -173,4 +176,19 @@ void HyperviscosityFunctorImpl::biharmonic_wk_dp3d() const
   Kokkos::fence();
 }
 
+void HyperviscosityFunctorImpl::first_laplace_and_exchange() const
+{
+  // For the first laplacian we use a differnt kernel, which uses directly the states
+  // at timelevel np1 as inputs. This way we avoid copying the states to *tens buffers.
+  
+  Kokkos::parallel_for(m_policy_first_laplace, *this);
+  Kokkos::fence();
+
+  // Exchange
+  assert (m_be->is_registration_completed());
+  GPTLstart("hvf-bexch");
+  m_be->exchange(m_geometry.m_rspheremp);
+  GPTLstop("hvf-bexch");
+}
+
 } // namespace Homme
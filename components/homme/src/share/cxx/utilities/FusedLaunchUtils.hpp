@@ -0,0 +1,78 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_FUSED_LAUNCH_UTILS_HPP
+#define HOMMEXX_FUSED_LAUNCH_UTILS_HPP
+
+#include "Types.hpp"
+#include "ExecSpaceDefs.hpp"
+
+#include <string>
+
+namespace Homme {
+
+// Runs the tagged team operators of a functor one after the other, within
+// the same team, with a team barrier in between. Launching this functor
+// replaces a sequence of launches of the same functor with different tags
+// (each followed by a fence) with a single launch.
+//
+// This is only correct if the tags share the same iteration space, and if
+// each tag only needs the results of the previous tags for the same league
+// index (e.g., the same element). In particular, there cannot be a boundary
+// exchange (or any other cross-team dependency) between two fused tags.
+//
+// This is why, for now, only the second laplacian and the pre-exchange update
+// of the hyperviscosity are fused: the other back-to-back launches either have
+// a boundary exchange in between (the two laplacians and the state update in
+// the hyperviscosity, the pre/post-exchange stages of Caar and of the tracer
+// biharmonic), or do not run over the same teams (the element and the
+// element-tracer policies of EulerStep, the element-level pre/post processing
+// and the per-column remap of RemapFunctor).
+template<typename Functor, typename... Tags>
+struct FusedTagsFunctor {
+  static_assert (sizeof...(Tags)>0, "Error! FusedTagsFunctor needs at least one tag.\n");
+
+  Functor m_functor;
+
+  explicit FusedTagsFunctor (const Functor& functor)
+   : m_functor(functor)
+  {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TeamMember& team) const {
+    run_tags<Tags...>(team);
+  }
+
+private:
+  template<typename Tag>
+  KOKKOS_INLINE_FUNCTION
+  void run_tags (const TeamMember& team) const {
+    m_functor(Tag(),team);
+  }
+
+  template<typename Tag, typename Next, typename... Rest>
+  KOKKOS_INLINE_FUNCTION
+  void run_tags (const TeamMember& team) const {
+    m_functor(Tag(),team);
+    team.team_barrier();
+    run_tags<Next,Rest...>(team);
+  }
+};
+
+// Launch the given tags of the functor as a single kernel over league_size teams.
+// Like other Homme kernels, this does not fence.
+template<typename... Tags, typename Functor>
+void parallel_for_fused (const std::string& name, const int league_size,
+                         const Functor& functor,
+                         const ThreadPreferences tp = ThreadPreferences())
+{
+  const auto policy = get_default_team_policy<ExecSpace>(league_size,tp);
+  Kokkos::parallel_for(name, policy, FusedTagsFunctor<Functor,Tags...>(functor));
+}
+
+} // namespace Homme
+
+#endif // HOMMEXX_FUSED_LAUNCH_UTILS_HPP
@@ -9,6 +9,7 @@
 #include "Context.hpp"
 #include "FunctorsBuffersManager.hpp"
 #include "profiling.hpp"
+#include "utilities/FusedLaunchUtils.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
 #include "mpi/MpiBuffersManager.hpp"
@@ -267,12 +268,24 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   Kokkos::fence();
 
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
+    // The second laplacian and the pre-exchange update only need data from
+    // the same element, so we run them in a single kernel
     GPTLstart("hvf-bhwk");
-    biharmonic_wk_theta ();
-    GPTLstop("hvf-bhwk");
-
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    if (m_fuse_kernels) {
+      first_laplace_and_exchange ();
+      if ( m_data.consthv ) {
+        parallel_for_fused<TagSecondLaplaceConstHV,TagHyperPreExchange>(
+            "hvf second laplace + pre-exchange", m_num_elems, *this);
+      } else {
+        parallel_for_fused<TagSecondLaplaceTensorHV,TagHyperPreExchange>(
+            "hvf second laplace + pre-exchange", m_num_elems, *this);
+      }
+    } else {
+      biharmonic_wk_theta ();
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    }
     Kokkos::fence();
+    GPTLstop("hvf-bhwk");
 
     // Exchange
     assert (m_be->is_registration_completed());
@@ -352,17 +365,7 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
 
 void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
 {
-  // For the first laplacian we use a differnt kernel, which uses directly the states
-  // at timelevel np1 as inputs, and subtracts the reference states.
-  // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
-  Kokkos::fence();
-
-  // Exchange
-  assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  first_laplace_and_exchange();
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
@@ -376,6 +379,21 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   Kokkos::fence();
 } //biharmonic
 
+void HyperviscosityFunctorImpl::first_laplace_and_exchange() const
+{
+  // For the first laplacian we use a differnt kernel, which uses directly the states
+  // at timelevel np1 as inputs, and subtracts the reference states.
+  // This way we avoid copying the states to *tens buffers.
+  Kokkos::parallel_for(m_policy_first_laplace, *this);
+  Kokkos::fence();
+
+  // Exchange
+  assert (m_be->is_registration_completed());
+  GPTLstart("hvf-bexch");
+  m_be->exchange(m_geometry.m_rspheremp);
+  GPTLstop("hvf-bexch");
+}
+
 // Laplace for nu_top
 KOKKOS_INLINE_FUNCTION
 void HyperviscosityFunctorImpl::operator() (const TagNutopLaplace&, const TeamMember& team) const {
@@ -105,8 +105,15 @@ public:
 
   void run (const int np1, const Real dt, const Real eta_ave_w);
 
+  // If false, run() launches the second laplacian and the pre-exchange update
+  // as two separate kernels (as it used to). Only meant for testing.
+  void set_fuse_kernels (const bool fuse) { m_fuse_kernels = fuse; }
+
   void biharmonic_wk_theta () const;
 
+  // The first laplacian of the biharmonic operator, followed by its DSS
+  void first_laplace_and_exchange () const;
+
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagFirstLaplaceHV&, const TeamMember& team) const {
@@ -387,6 +394,8 @@ public:
 protected:
 
   const int             m_num_elems;
+
+  bool                  m_fuse_kernels = true;
   HyperviscosityData    m_data;
   ElementsState         m_state;
   ElementsDerivedState  m_derived;
@@ -0,0 +1,95 @@
+#include <catch2/catch.hpp>
+
+#include "Types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace Homme;
+using rngAlg = std::mt19937_64;
+
+extern "C" void genspacepart_weighted_c_callable(
+  const int& nelem, const int& npart, const Real* sfcweights, int* rank2sfc);
+
+namespace {
+
+// Split the SFC with the given weights, check that the parts are contiguous and
+// non empty, and return the total weight of each part
+std::vector<Real> split (const std::vector<Real>& w, const int npart,
+                         std::vector<int>& nelem_part) {
+  const int nelem = w.size();
+  std::vector<int> rank2sfc(npart+1,-1);
+  genspacepart_weighted_c_callable(nelem,npart,w.data(),rank2sfc.data());
+
+  REQUIRE (rank2sfc[0]==0);
+  REQUIRE (rank2sfc[npart]==nelem);
+  nelem_part.resize(npart);
+  std::vector<Real> wpart(npart,0);
+  for (int p=0; p<npart; ++p) {
+    nelem_part[p] = rank2sfc[p+1]-rank2sfc[p];
+    REQUIRE (nelem_part[p]>=1);
+    for (int s=rank2sfc[p]; s<rank2sfc[p+1]; ++s) {
+      wpart[p] += w[s];
+    }
+  }
+  return wpart;
+}
+
+} // anonymous namespace
+
+TEST_CASE("genspacepart_weighted", "partition") {
+  const int nelem = 384;
+  const int npart = 7;
+  std::vector<int> nelem_part;
+
+  SECTION ("uniform") {
+    // Same as the count-based split: part sizes differ by at most one element
+    const std::vector<Real> w(nelem,2.5);
+    split(w,npart,nelem_part);
+    const auto mm = std::minmax_element(nelem_part.begin(),nelem_part.end());
+    REQUIRE (*mm.second-*mm.first<=1);
+  }
+
+  SECTION ("random") {
+    // Each cut is the closest one to its target, so each part is within
+    // one (max) element weight of the average part weight
+    rngAlg engine(12345);
+    std::uniform_real_distribution<Real> dist(0.1,10.0);
+    std::vector<Real> w(nelem);
+    for (auto& x : w) { x = dist(engine); }
+
+    const auto wpart = split(w,npart,nelem_part);
+    const Real total = std::accumulate(w.begin(),w.end(),Real(0));
+    const Real wmax = *std::max_element(w.begin(),w.end());
+    for (int p=0; p<npart; ++p) {
+      REQUIRE (std::abs(wpart[p]-total/npart)<=wmax);
+    }
+    REQUIRE (std::accumulate(nelem_part.begin(),nelem_part.end(),0)==nelem);
+  }
+
+  SECTION ("two_costs") {
+    // The first half of the curve is 4x as expensive, so the parts there get
+    // (about) 4x fewer elements than the parts in the second half
+    std::vector<Real> w(nelem,1.0);
+    std::fill(w.begin(),w.begin()+nelem/2,4.0);
+
+    const auto wpart = split(w,npart,nelem_part);
+    const Real total = 2.5*nelem;
+    for (int p=0; p<npart; ++p) {
+      REQUIRE (std::abs(wpart[p]-total/npart)<=4.0);
+    }
+    REQUIRE (nelem_part.front()*3<nelem_part.back());
+  }
+
+  SECTION ("one_elem_per_part") {
+    // With as many parts as elements, each part gets one element, no matter the weights
+    std::vector<Real> w(npart,1.0);
+    w[0] = 1000.0;
+    split(w,npart,nelem_part);
+    for (int p=0; p<npart; ++p) {
+      REQUIRE (nelem_part[p]==1);
+    }
+  }
+}
@@ -580,8 +580,60 @@ TEST_CASE("hvf", "biharmonic") {
         // Set the viscosity params
         hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
 
+        // Run the cxx functor without fusing the second laplacian and the
+        // pre-exchange update, then restore the inputs. The fused run below
+        // must give the same answers, bit for bit.
+        auto v_in       = Kokkos::create_mirror_view(state.m_v);
+        auto w_in       = Kokkos::create_mirror_view(state.m_w_i);
+        auto vtheta_in  = Kokkos::create_mirror_view(state.m_vtheta_dp);
+        auto dp_in      = Kokkos::create_mirror_view(state.m_dp3d);
+        auto phinh_in   = Kokkos::create_mirror_view(state.m_phinh_i);
+        auto dpdiss_in  = Kokkos::create_mirror_view(derived.m_dpdiss_ave);
+        auto dpdissb_in = Kokkos::create_mirror_view(derived.m_dpdiss_biharmonic);
+        Kokkos::deep_copy(v_in,       state.m_v);
+        Kokkos::deep_copy(w_in,       state.m_w_i);
+        Kokkos::deep_copy(vtheta_in,  state.m_vtheta_dp);
+        Kokkos::deep_copy(dp_in,      state.m_dp3d);
+        Kokkos::deep_copy(phinh_in,   state.m_phinh_i);
+        Kokkos::deep_copy(dpdiss_in,  derived.m_dpdiss_ave);
+        Kokkos::deep_copy(dpdissb_in, derived.m_dpdiss_biharmonic);
+
+        hvf.set_fuse_kernels(false);
+        Kokkos::Timer timer;
+        hvf.run(np1,dt,eta_ave_w);
+        const double time_unfused = timer.seconds();
+
+        auto v_unfused      = Kokkos::create_mirror_view(state.m_v);
+        auto w_unfused      = Kokkos::create_mirror_view(state.m_w_i);
+        auto vtheta_unfused = Kokkos::create_mirror_view(state.m_vtheta_dp);
+        auto dp_unfused     = Kokkos::create_mirror_view(state.m_dp3d);
+        auto phinh_unfused  = Kokkos::create_mirror_view(state.m_phinh_i);
+        Kokkos::deep_copy(v_unfused,      state.m_v);
+        Kokkos::deep_copy(w_unfused,      state.m_w_i);
+        Kokkos::deep_copy(vtheta_unfused, state.m_vtheta_dp);
+        Kokkos::deep_copy(dp_unfused,     state.m_dp3d);
+        Kokkos::deep_copy(phinh_unfused,  state.m_phinh_i);
+
+        Kokkos::deep_copy(state.m_v,                  v_in);
+        Kokkos::deep_copy(state.m_w_i,                w_in);
+        Kokkos::deep_copy(state.m_vtheta_dp,          vtheta_in);
+        Kokkos::deep_copy(state.m_dp3d,               dp_in);
+        Kokkos::deep_copy(state.m_phinh_i,            phinh_in);
+        Kokkos::deep_copy(derived.m_dpdiss_ave,       dpdiss_in);
+        Kokkos::deep_copy(derived.m_dpdiss_biharmonic,dpdissb_in);
+
         // Run the cxx functor
+        hvf.set_fuse_kernels(true);
+        timer.reset();
         hvf.run(np1,dt,eta_ave_w);
+        const double time_fused = timer.seconds();
+
+        // Per subcycle, the unfused run launches first laplace, second laplace,
+        // pre-exchange and update states kernels; the fused run merges the
+        // second and third one.
+        std::cout << "     kernel launches per subcycle (unfused/fused): 4/3\n"
+                  << "     run time [s] (unfused/fused): "
+                  << time_unfused << "/" << time_fused << "\n";
 
         // Run the f90 functor
         advance_hypervis_f90(np1+1,dt,eta_ave_w, hv_scaling, hydrostatic,
@@ -614,6 +666,7 @@ TEST_CASE("hvf", "biharmonic") {
                   printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,0,igp,jgp));
                 }
                 REQUIRE (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,0,igp,jgp));
+                REQUIRE (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]==v_unfused(ie,np1,0,igp,jgp,ilev)[ivec]);
 
                 if (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,1,igp,jgp)) {
                   printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
@@ -621,6 +674,7 @@ TEST_CASE("hvf", "biharmonic") {
                   printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,1,igp,jgp));
                 }
                 REQUIRE (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,1,igp,jgp));
+                REQUIRE (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]==v_unfused(ie,np1,1,igp,jgp,ilev)[ivec]);
 
                 if (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]!=dp_f90(ie,np1,k,igp,jgp)) {
                   printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
@@ -628,6 +682,7 @@ TEST_CASE("hvf", "biharmonic") {
                   printf ("dp_f90: %3.16f\n",dp_f90(ie,np1,k,igp,jgp));
                 }
                 REQUIRE (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]==dp_f90(ie,np1,k,igp,jgp));
+                REQUIRE (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]==dp_unfused(ie,np1,igp,jgp,ilev)[ivec]);
 
                 if (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]!=vtheta_f90(ie,np1,k,igp,jgp)) {
                   printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
@@ -635,6 +690,7 @@ TEST_CASE("hvf", "biharmonic") {
                   printf ("vtheta_f90: %3.16f\n",vtheta_f90(ie,np1,k,igp,jgp));
                 }
                 REQUIRE (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]==vtheta_f90(ie,np1,k,igp,jgp));
+                REQUIRE (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]==vtheta_unfused(ie,np1,igp,jgp,ilev)[ivec]);
 
                 if (hvf.process_nh_vars()) {
                   if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
@@ -643,6 +699,7 @@ TEST_CASE("hvf", "biharmonic") {
                     printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
                   }
                   REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
+                  REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_unfused(ie,np1,igp,jgp,ilev)[ivec]);
 
                   if (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]!=phinh_f90(ie,np1,k,igp,jgp)) {
                     printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
@@ -650,6 +707,7 @@ TEST_CASE("hvf", "biharmonic") {
                     printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
                   }
                   REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
+                  REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_unfused(ie,np1,igp,jgp,ilev)[ivec]);
                 }
               }
 
@@ -665,6 +723,7 @@ TEST_CASE("hvf", "biharmonic") {
                   printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
                 }
                 REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
+                REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_unfused(ie,np1,igp,jgp,ilev)[ivec]);
 
                 if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
                   printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
@@ -672,6 +731,7 @@ TEST_CASE("hvf", "biharmonic") {
                   printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
                 }
                 REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
+                REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_unfused(ie,np1,igp,jgp,ilev)[ivec]);
               }
             }
           }